@@ -50,29 +50,40 @@
 		using to_char_t         = std::conditional_t<TO_N == 8, char, ztd_char##TO_N##_t>;                           \
 		using UFromErrorHandler = ztd::remove_cvref_t<FromErrorHandler>;                                             \
 		using UToErrorHandler   = ztd::remove_cvref_t<ToErrorHandler>;                                               \
-		if constexpr (ztd::text::is_ignorable_error_handler_v<UFromErrorHandler> /* cf */                            \
-		     && ztd::text::is_ignorable_error_handler_v<UToErrorHandler>) {                                          \
-			const std::size_t written_chars = (ztd::endian::native == ztd::endian::big                              \
+		using result_t = ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>;         \
+		std::size_t handled_errors = 0;                                                                              \
+		for (;;) {                                                                                                   \
+			std::size_t valid_count = input.size();                                                                 \
+			if constexpr (!ztd::text::is_ignorable_error_handler_v<UFromErrorHandler> /* cf */                      \
+			     || !ztd::text::is_ignorable_error_handler_v<UToErrorHandler>) {                                    \
+				const simdutf::result validate_res = (ztd::endian::native == ztd::endian::big                      \
+				          ? simdutf::validate_utf##FROM_N##FROM_BIG_SUFFIX##_with_errors                           \
+				          : simdutf::validate_utf##FROM_N##FROM_LIL_SUFFIX##_with_errors)(                         \
+				     reinterpret_cast<const from_char_t*>(input.data()), input.size());                            \
+				if (validate_res.error != simdutf::error_code::SUCCESS) {                                          \
+					valid_count = validate_res.count;                                                             \
+				}                                                                                                  \
+			}                                                                                                       \
+			const std::size_t written_count = (ztd::endian::native == ztd::endian::big                              \
 			          ? simdutf::convert_valid_utf##FROM_N##FROM_BIG_SUFFIX##_to_utf##TO_N##TO_BIG_SUFFIX           \
 			          : simdutf::convert_valid_utf##FROM_N##FROM_LIL_SUFFIX##_to_utf##TO_N##TO_LIL_SUFFIX)(         \
-			     (const from_char_t*)input.data(), input.size(), (to_char_t*)output.begin());                       \
-			return ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>(              \
-			     input.subspan(input.size()), ztd::ranges::unbounded_view(output.begin() + written_chars),          \
-			     from_state, to_state, ztd::text::encoding_error::ok);                                              \
-		}                                                                                                            \
-		else {                                                                                                       \
-			const simdutf::result res = (ztd::endian::native == ztd::endian::big                                    \
-			          ? simdutf::convert_utf##FROM_N##FROM_BIG_SUFFIX##_to_utf##TO_N##TO_BIG_SUFFIX##_with_errors   \
-			          : simdutf::convert_utf##FROM_N##FROM_LIL_SUFFIX##_to_utf##TO_N##TO_LIL_SUFFIX##_with_errors)( \
-			     (const from_char_t*)input.data(), input.size(), (to_char_t*)output.begin());                       \
-			if (res.error == simdutf::error_code::SUCCESS) {                                                        \
-				return ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>(         \
-				     input.subspan(input.size()), ztd::ranges::unbounded_view(output.begin() + res.count),         \
-				     from_state, to_state, ztd::text::encoding_error::ok);                                         \
+			     reinterpret_cast<const from_char_t*>(input.data()), valid_count,                                   \
+			     reinterpret_cast<to_char_t*>(output.begin()));                                                     \
+			input  = input.subspan(valid_count);                                                                    \
+			output = ztd::ranges::unbounded_view(output.begin() + written_count);                                   \
+			if (input.empty()) {                                                                                    \
+				return result_t(input, output, from_state, to_state, ztd::text::encoding_error::ok,                \
+				     handled_errors);                                                                              \
+			}                                                                                                       \
+			/* only the bad sequence goes to the error handlers: then, straight back to bulk conversion */          \
+			auto one_result = ztd::text::basic_transcode_one_into(input, from, output, to,                          \
+			     from_error_handler, to_error_handler, from_state, to_state, __pivot);                              \
+			handled_errors += one_result.handled_errors;                                                            \
+			if (one_result.error_code != ztd::text::encoding_error::ok) {                                           \
+				return result_t(input, output, from_state, to_state, one_result.error_code, handled_errors);       \
 			}                                                                                                       \
-			return ztd::text::basic_transcode_into(input, from, output, to,                                         \
-			     ::std::forward<FromErrorHandler>(from_error_handler),                                              \
-			     ::std::forward<ToErrorHandler>(to_error_handler), from_state, to_state, __pivot);                  \
+			input  = one_result.input;                                                                              \
+			output = one_result.output;                                                                             \
 		}                                                                                                            \
 	}                                                                                                                 \
                                                                                                                        \
@@ -87,35 +98,52 @@
 		using to_char_t         = std::conditional_t<TO_N == 8, char, ztd_char##TO_N##_t>;                           \
 		using UFromErrorHandler = ztd::remove_cvref_t<FromErrorHandler>;                                             \
 		using UToErrorHandler   = ztd::remove_cvref_t<ToErrorHandler>;                                               \
-		if constexpr (!ztd::text::is_ignorable_error_handler_v<UFromErrorHandler> /* cf */                           \
-		     || !ztd::text::is_ignorable_error_handler_v<UToErrorHandler>) {                                         \
-			const simdutf::result validate_res = (ztd::endian::native == ztd::endian::big                           \
-			          ? simdutf::validate_utf##FROM_N##FROM_BIG_SUFFIX##_with_errors                                \
-			          : simdutf::validate_utf##FROM_N##FROM_LIL_SUFFIX##_with_errors)(                              \
-			     reinterpret_cast<const from_char_t*>(input.data()), input.size());                                 \
-			if (validate_res.error != simdutf::error_code::SUCCESS) {                                               \
-				return ztd::text::basic_transcode_into(input, from, output, to,                                    \
-				     ::std::forward<FromErrorHandler>(from_error_handler),                                         \
-				     ::std::forward<ToErrorHandler>(to_error_handler), from_state, to_state, __pivot);             \
+		using result_t = ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>;         \
+		std::size_t handled_errors = 0;                                                                              \
+		for (;;) {                                                                                                   \
+			std::size_t valid_count = input.size();                                                                 \
+			if constexpr (!ztd::text::is_ignorable_error_handler_v<UFromErrorHandler> /* cf */                      \
+			     || !ztd::text::is_ignorable_error_handler_v<UToErrorHandler>) {                                    \
+				const simdutf::result validate_res = (ztd::endian::native == ztd::endian::big                      \
+				          ? simdutf::validate_utf##FROM_N##FROM_BIG_SUFFIX##_with_errors                           \
+				          : simdutf::validate_utf##FROM_N##FROM_LIL_SUFFIX##_with_errors)(                         \
+				     reinterpret_cast<const from_char_t*>(input.data()), input.size());                            \
+				if (validate_res.error != simdutf::error_code::SUCCESS) {                                          \
+					valid_count = validate_res.count;                                                             \
+				}                                                                                                  \
 			}                                                                                                       \
-		}                                                                                                            \
-		const size_t output_count = (ztd::endian::native == ztd::endian::big                                         \
-		          ? simdutf::utf##TO_N##_length_from_utf##FROM_N##FROM_BIG_SUFFIX                                    \
-		          : simdutf::utf##TO_N##_length_from_utf##FROM_N##FROM_LIL_SUFFIX)(                                  \
-		     reinterpret_cast<const from_char_t*>(input.data()), input.size());                                      \
-		if (output_count <= output.size()) {                                                                         \
-			std::size_t written_count = (ztd::endian::native == ztd::endian::big                                    \
+			const size_t output_count = (ztd::endian::native == ztd::endian::big                                    \
+			          ? simdutf::utf##TO_N##_length_from_utf##FROM_N##FROM_BIG_SUFFIX                               \
+			          : simdutf::utf##TO_N##_length_from_utf##FROM_N##FROM_LIL_SUFFIX)(                             \
+			     reinterpret_cast<const from_char_t*>(input.data()), valid_count);                                  \
+			if (output_count > output.size()) {                                                                     \
+				/* not enough room: the one-by-one loop finds exactly where it runs out */                         \
+				auto result = ztd::text::basic_transcode_into(input, from, output, to, from_error_handler,         \
+				     to_error_handler, from_state, to_state, __pivot);                                             \
+				return result_t(result.input, result.output, from_state, to_state, result.error_code,              \
+				     handled_errors + result.handled_errors);                                                      \
+			}                                                                                                       \
+			const std::size_t written_count = (ztd::endian::native == ztd::endian::big                              \
 			          ? simdutf::convert_valid_utf##FROM_N##FROM_BIG_SUFFIX##_to_utf##TO_N##TO_BIG_SUFFIX           \
 			          : simdutf::convert_valid_utf##FROM_N##FROM_LIL_SUFFIX##_to_utf##TO_N##TO_LIL_SUFFIX)(         \
-			     reinterpret_cast<const from_char_t*>(input.data()), input.size(),                                  \
+			     reinterpret_cast<const from_char_t*>(input.data()), valid_count,                                   \
 			     reinterpret_cast<to_char_t*>(output.data()));                                                      \
-			return ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>(              \
-			     input.subspan(input.size()), output.subspan(written_count), from_state, to_state,                  \
-			     ztd::text::encoding_error::ok);                                                                    \
+			input  = input.subspan(valid_count);                                                                    \
+			output = output.subspan(written_count);                                                                 \
+			if (input.empty()) {                                                                                    \
+				return result_t(input, output, from_state, to_state, ztd::text::encoding_error::ok,                \
+				     handled_errors);                                                                              \
+			}                                                                                                       \
+			/* only the bad sequence goes to the error handlers: then, straight back to bulk conversion */          \
+			auto one_result = ztd::text::basic_transcode_one_into(input, from, output, to,                          \
+			     from_error_handler, to_error_handler, from_state, to_state, __pivot);                              \
+			handled_errors += one_result.handled_errors;                                                            \
+			if (one_result.error_code != ztd::text::encoding_error::ok) {                                           \
+				return result_t(input, output, from_state, to_state, one_result.error_code, handled_errors);       \
+			}                                                                                                       \
+			input  = one_result.input;                                                                              \
+			output = one_result.output;                                                                             \
 		}                                                                                                            \
-		return ztd::text::basic_transcode_into(input, from, output, to,                                              \
-		     ::std::forward<FromErrorHandler>(from_error_handler), ::std::forward<ToErrorHandler>(to_error_handler), \
-		     from_state, to_state, __pivot);                                                                         \
 	}                                                                                                                 \
 	static_assert(true, "")
 
@@ -134,6 +162,7 @@ auto text_transcode(::ztd::tag<ztd::text::utf8_t, ztd::text::utf32_t>, ztd::span
      ztd::text::pivot<PivotRange>& __pivot) {
 	using UFromErrorHandler          = ztd::remove_cvref_t<FromErrorHandler>;
 	using UToErrorHandler            = ztd::remove_cvref_t<ToErrorHandler>;
+	using result_t = ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>;
 	constexpr bool no_error_handling = ztd::text::is_ignorable_error_handler_v<UFromErrorHandler> // cf
 	     && ztd::text::is_ignorable_error_handler_v<UToErrorHandler>;
 	if constexpr (no_error_handling) {
@@ -141,31 +170,43 @@ auto text_transcode(::ztd::tag<ztd::text::utf8_t, ztd::text::utf32_t>, ztd::span
 		// validity.
 		const std::size_t written_count
 		     = simdutf::convert_valid_utf8_to_utf32((const char*)input.data(), input.size(), output.begin());
-		return ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>(
-		     input.subspan(input.size()), ztd::ranges::unbounded_view(output.begin() + written_count), from_state,
-		     to_state);
+		return result_t(input.subspan(input.size()), ztd::ranges::unbounded_view(output.begin() + written_count),
+		     from_state, to_state);
 	}
 	else {
 		// UTF-8 to UTF-32, but we cannot assume the error handler is ignorable in these cases. So, we have to check
 		// everything and convert.
-		const simdutf::result res
-		     = simdutf::convert_utf8_to_utf32_with_errors((const char*)input.data(), input.size(), output.begin());
-		if (res.error == simdutf::error_code::SUCCESS) {
-			return ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>(
-			     input.subspan(input.size()), ztd::ranges::unbounded_view(output.begin() + res.count), from_state,
-			     to_state, ztd::text::encoding_error::ok);
+		//
+		// On failure, the simdutf::result type gives us a `.count` variable. For the "_with_errors" conversion
+		// functions, that is the # of input read on failure, and we have NO idea how many code units were written.
+		// Validation, on the other hand, tells us exactly where the valid prefix ends: so we validate, convert
+		// just the valid prefix, and then hand ONLY the bad sequence to basic_transcode_one_into so that the error
+		// handlers see it. Then, it's straight back to bulk conversion for everything after it, rather than
+		// bailing to the (much slower) one-by-one loop for the entire rest of the input.
+		std::size_t handled_errors = 0;
+		for (;;) {
+			const simdutf::result validate_res
+			     = simdutf::validate_utf8_with_errors(reinterpret_cast<const char*>(input.data()), input.size());
+			const std::size_t valid_count
+			     = validate_res.error == simdutf::error_code::SUCCESS ? input.size() : validate_res.count;
+			const std::size_t written_count = simdutf::convert_valid_utf8_to_utf32(
+			     reinterpret_cast<const char*>(input.data()), valid_count, output.begin());
+			input  = input.subspan(valid_count);
+			output = ztd::ranges::unbounded_view(output.begin() + written_count);
+			if (input.empty()) {
+				return result_t(
+				     input, output, from_state, to_state, ztd::text::encoding_error::ok, handled_errors);
+			}
+			auto one_result = ztd::text::basic_transcode_one_into(
+			     input, from, output, to, from_error_handler, to_error_handler, from_state, to_state, __pivot);
+			handled_errors += one_result.handled_errors;
+			if (one_result.error_code != ztd::text::encoding_error::ok) {
+				// the error handler asked us to stop: report where the bad sequence started
+				return result_t(input, output, from_state, to_state, one_result.error_code, handled_errors);
+			}
+			input  = one_result.input;
+			output = one_result.output;
 		}
-		// If it fails, we have to simply bail and go to the base case, which will find precisely where we failed and
-		// do the appropriate callbacks and work for us. Note that this is due to what information SIMDUTF returns to
-		// us. On failure, the simdutf::result type gives us a
-		// `.count` variable. That variable is the # of output written on success, or the # of input read and
-		// converted on failure. In the first case, it's fine: we get all the information we need because we know the
-		// entire input has been consumed. In the second case, it's terrible because we have NO idea how many code
-		// units were succesfully written! So we know where the error happened in the input, but cannot take advantage
-		// of any work already done by the algorithm. Which REALLY sucks!!
-		return ztd::text::basic_transcode_into(input, from, output, to,
-		     ::std::forward<FromErrorHandler>(from_error_handler), ::std::forward<ToErrorHandler>(to_error_handler),
-		     from_state, to_state, __pivot);
 	}
 }
 
@@ -174,44 +215,53 @@ auto text_transcode(::ztd::tag<ztd::text::utf8_t, ztd::text::utf32_t>, ztd::span
      const ztd::text::utf8_t& from, ztd::span<ztd_char32_t> output, const ztd::text::utf32_t& to,
      FromErrorHandler&& from_error_handler, ToErrorHandler&& to_error_handler, FromState& from_state, ToState& to_state,
      ztd::text::pivot<PivotRange>& __pivot) {
-	// UTF-16 to UTF-8, but we cannot assume the error handler is ignorable in these cases. So, we have to
+	// UTF-8 to UTF-32, but we cannot assume the error handler is ignorable in these cases. So, we have to
 	// check everything and convert. we use the validation function as a way to also check the count.
-	using UFromErrorHandler = ztd::remove_cvref_t<FromErrorHandler>;
-	using UToErrorHandler   = ztd::remove_cvref_t<ToErrorHandler>;
-	if constexpr (!ztd::text::is_ignorable_error_handler_v<UFromErrorHandler> // cf
-	     || !ztd::text::is_ignorable_error_handler_v<UToErrorHandler>) {
-		const simdutf::result validate_res
-		     = simdutf::validate_utf8_with_errors(reinterpret_cast<const char*>(input.data()), input.size());
-		if (validate_res.error != simdutf::error_code::SUCCESS) {
-			// It is not vlaid, we must bail here.
-			return ztd::text::basic_transcode_into(input, from, output, to,
-			     ::std::forward<FromErrorHandler>(from_error_handler),
-			     ::std::forward<ToErrorHandler>(to_error_handler), from_state, to_state, __pivot);
+	using UFromErrorHandler    = ztd::remove_cvref_t<FromErrorHandler>;
+	using UToErrorHandler      = ztd::remove_cvref_t<ToErrorHandler>;
+	using result_t             = ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>;
+	std::size_t handled_errors = 0;
+	for (;;) {
+		std::size_t valid_count = input.size();
+		if constexpr (!ztd::text::is_ignorable_error_handler_v<UFromErrorHandler> // cf
+		     || !ztd::text::is_ignorable_error_handler_v<UToErrorHandler>) {
+			const simdutf::result validate_res
+			     = simdutf::validate_utf8_with_errors(reinterpret_cast<const char*>(input.data()), input.size());
+			if (validate_res.error != simdutf::error_code::SUCCESS) {
+				// It is not valid: only convert up to the bad sequence.
+				valid_count = validate_res.count;
+			}
+		}
+		// Now, we check to make sure the size is appropriate so we do not overflow the output buffer.
+		// Not we don't have to do this if we have an unbounded_view type.
+		const size_t output_count
+		     = simdutf::utf32_length_from_utf8(reinterpret_cast<const char*>(input.data()), valid_count);
+		if (output_count > output.size()) {
+			// If it does not fit, we have to simply bail and go to the base case, which will find precisely where
+			// we run out of space and do the appropriate callbacks and work for us.
+			auto result = ztd::text::basic_transcode_into(input, from, output, to, from_error_handler,
+			     to_error_handler, from_state, to_state, __pivot);
+			return result_t(result.input, result.output, from_state, to_state, result.error_code,
+			     handled_errors + result.handled_errors);
 		}
-	}
-	// Now, we check to make sure the size is appropriate so we do not overflow the output buffer.
-	// Not we don't have to do this if we have an unbounded_view type.
-	const size_t output_count
-	     = simdutf::utf32_length_from_utf8(reinterpret_cast<const char*>(input.data()), input.size());
-	if (output_count <= output.size()) {
 		// we can successfully convert the data: do so!
-		std::size_t written_count = simdutf::convert_valid_utf8_to_utf32(
-		     reinterpret_cast<const char*>(input.data()), input.size(), output.data());
-		return ztd::text::transcode_result<decltype(input), decltype(output), FromState, ToState>(
-		     input.subspan(input.size()), output.subspan(written_count), from_state, to_state,
-		     ztd::text::encoding_error::ok);
+		const std::size_t written_count = simdutf::convert_valid_utf8_to_utf32(
+		     reinterpret_cast<const char*>(input.data()), valid_count, output.data());
+		input  = input.subspan(valid_count);
+		output = output.subspan(written_count);
+		if (input.empty()) {
+			return result_t(input, output, from_state, to_state, ztd::text::encoding_error::ok, handled_errors);
+		}
+		// Hand ONLY the bad sequence to the error handlers, and then go right back to converting in bulk.
+		auto one_result = ztd::text::basic_transcode_one_into(
+		     input, from, output, to, from_error_handler, to_error_handler, from_state, to_state, __pivot);
+		handled_errors += one_result.handled_errors;
+		if (one_result.error_code != ztd::text::encoding_error::ok) {
+			return result_t(input, output, from_state, to_state, one_result.error_code, handled_errors);
+		}
+		input  = one_result.input;
+		output = one_result.output;
 	}
-	// If it fails, we have to simply bail and go to the base case, which will find precisely where we failed
-	// and do the appropriate callbacks and work for us. Note that this is due to what information SIMDUTF
-	// returns to us. On failure, the simdutf::result type gives us a
-	// `.count` variable. That variable is the # of output written on success, or the # of input read and
-	// converted on failure. In the first case, it's fine: we get all the information we need because we know
-	// the entire input has been consumed. In the second case, it's terrible because we have NO idea how many
-	// code units were succesfully written! So we know where the error happened in the input, but cannot take
-	// advantage of any work already done by the algorithm. Which REALLY sucks!!
-	return ztd::text::basic_transcode_into(input, from, output, to,
-	     ::std::forward<FromErrorHandler>(from_error_handler), ::std::forward<ToErrorHandler>(to_error_handler),
-	     from_state, to_state, __pivot);
 }
 
 // Macro hygiene!
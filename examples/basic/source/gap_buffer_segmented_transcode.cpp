@@ -0,0 +1,88 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/count_as_decoded.hpp>
+#include <ztd/text/validate_decodable_as.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include "gap_buffer.hpp"
+
+#include <array>
+#include <algorithm>
+#include <string_view>
+
+namespace gap { namespace {
+	// Hand out the two halves on either side of the gap, so that the library can run its fast loops over each half
+	// instead of walking the (slow) gap iterators one code unit at a time.
+	template <typename Tp, typename DiffTp, typename PtrTp, typename RefTp>
+	std::array<ztd::span<const Tp>, 2> text_segments(const ztd::ranges::subrange<
+	     gap_iterator_base<Tp, DiffTp, PtrTp, RefTp>, gap_iterator_base<Tp, DiffTp, PtrTp, RefTp>>& range) {
+		auto first = range.begin();
+		auto last  = range.end();
+		if (first.cur >= first.gap_end || last.cur <= first.gap_begin) {
+			// entirely on one side of the gap
+			return { ztd::span<const Tp>(first.cur, last.cur), ztd::span<const Tp>() };
+		}
+		return { ztd::span<const Tp>(first.cur, first.gap_begin), ztd::span<const Tp>(first.gap_end, last.cur) };
+	}
+}} // namespace gap::<anonymous>
+
+int main(int, char*[]) {
+	using u8_gap_buffer   = gap::gap_vector<char>;
+	using iterator        = typename u8_gap_buffer::iterator;
+	using buffer_subrange = ztd::ranges::subrange<iterator, iterator>;
+
+	static_assert(ztd::text::is_segmented_range_v<buffer_subrange>);
+
+	// "⛲ Très beau !", built up so that the gap ends up splitting the 3 code units of "⛲"
+	u8_gap_buffer buffer;
+	std::string_view tail = "\x9B\xB2 Tr\xC3\xA8s beau !";
+	std::string_view head = "\xE2";
+	buffer.insert(buffer.begin(), tail.begin(), tail.end());
+	buffer.insert(buffer.begin(), head.begin(), head.end());
+
+	buffer_subrange u8_buffer_view(buffer.begin(), buffer.end());
+
+	std::u32string_view expected_data = U"⛲ Très beau !";
+	std::array<char32_t, 32> output_storage {};
+	auto result = ztd::text::transcode_into(u8_buffer_view, ztd::text::compat_utf8,
+	     ztd::span<char32_t>(output_storage.data(), output_storage.size()), ztd::text::utf32);
+	ZTD_TEXT_ASSERT(result.error_code == ztd::text::encoding_error::ok);
+	ZTD_TEXT_ASSERT(std::equal(expected_data.cbegin(), expected_data.cend(), output_storage.cbegin()));
+
+	auto count_result = ztd::text::count_as_decoded(u8_buffer_view, ztd::text::compat_utf8);
+	ZTD_TEXT_ASSERT(count_result.count == expected_data.size());
+
+	auto validate_result = ztd::text::validate_decodable_as(u8_buffer_view, ztd::text::compat_utf8);
+	ZTD_TEXT_ASSERT(validate_result.valid);
+
+	return 0;
+}
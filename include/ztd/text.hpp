@@ -37,22 +37,34 @@
 
 #include <ztd/text/forward.hpp>
 #include <ztd/text/encoding.hpp>
+#include <ztd/text/error_collecting_handler.hpp>
+#include <ztd/text/scratch_memory.hpp>
+#include <ztd/text/segmented_range.hpp>
 #include <ztd/text/encode.hpp>
 #include <ztd/text/encode_one.hpp>
 #include <ztd/text/decode.hpp>
 #include <ztd/text/decode_one.hpp>
 #include <ztd/text/transcode.hpp>
 #include <ztd/text/transcode_one.hpp>
+#include <ztd/text/transcode_batch.hpp>
+#include <ztd/text/transcode_or_borrow.hpp>
+#include <ztd/text/transcode_in_place.hpp>
+#include <ztd/text/sanitize_in_place.hpp>
 #include <ztd/text/count_as_encoded.hpp>
 #include <ztd/text/count_as_decoded.hpp>
 #include <ztd/text/count_as_transcoded.hpp>
 #include <ztd/text/validate_decodable_as.hpp>
 #include <ztd/text/validate_encodable_as.hpp>
 #include <ztd/text/validate_transcodable_as.hpp>
+#include <ztd/text/validate_and_count_as_transcoded.hpp>
+#include <ztd/text/advance_code_points.hpp>
+#include <ztd/text/truncate_to_fit.hpp>
 
 #include <ztd/text/encode_view.hpp>
 #include <ztd/text/decode_view.hpp>
 #include <ztd/text/transcode_view.hpp>
+#include <ztd/text/code_point_index.hpp>
+#include <ztd/text/utf_offset_map.hpp>
 
 #include <ztd/text/normalization.hpp>
 #include <ztd/text/normalized_view.hpp>
@@ -0,0 +1,180 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_ADVANCE_CODE_POINTS_HPP
+#define ZTD_TEXT_ADVANCE_CODE_POINTS_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/default_encoding.hpp>
+#include <ztd/text/count_result.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/detail/advance_routines.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/char_traits.hpp>
+
+#include <cstddef>
+#include <string_view>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_advance_code_points ztd::text::advance_code_points
+	/// @brief These functions skip over a number of code points in an input of code units, without decoding them
+	/// anywhere visible.
+	/// @{
+
+	//////
+	/// @brief Skips over at most `__max_code_points` code points of the `__input`.
+	///
+	/// @param[in] __input The input range (of code units) to skip code points in.
+	/// @param[in] __encoding The encoding to read the input with.
+	/// @param[in] __max_code_points The maximum number of code points to skip.
+	/// @param[in] __error_handler The error handler to invoke when a decode operation fails.
+	/// @param[in,out] __state The state that will be used to decode code points.
+	///
+	/// @returns A ztd::text::count_result whose `input` starts right after the last skipped code point and whose
+	/// `count` is the number of code points skipped. The `count` is less than `__max_code_points` only when the input
+	/// ran out or an error occurred.
+	///
+	/// @remarks A decode step that produces more than one code point is never split: if it would go past
+	/// `__max_code_points`, the function stops in front of it. Between the standard UTF encodings over contiguous
+	/// input, well-formed code units are skipped straight off the storage (runs of ASCII in UTF-8 are checked a
+	/// 64-bit word at a time); everything else goes one decode step at a time, into an unseen buffer.
+	template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+	constexpr auto advance_code_points(_Input&& __input, _Encoding&& __encoding, ::std::size_t __max_code_points,
+		_ErrorHandler&& __error_handler, _State& __state) {
+		using _UInput         = remove_cvref_t<_Input>;
+		using _InputValueType = ranges::range_value_type_t<_UInput>;
+		using _WorkingInput   = ranges::range_reconstruct_t<::std::conditional_t<::std::is_array_v<_UInput>,
+               ::std::conditional_t<is_char_traitable_v<_InputValueType>, ::std::basic_string_view<_InputValueType>,
+                    ::ztd::span<const _InputValueType>>,
+               _UInput>>;
+
+		_WorkingInput __working_input(
+			ranges::reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+		return __txt_detail::__basic_advance_code_points(
+			::std::move(__working_input), __encoding, __max_code_points, __error_handler, __state);
+	}
+
+	//////
+	/// @brief Skips over at most `__max_code_points` code points of the `__input`.
+	///
+	/// @param[in] __input The input range (of code units) to skip code points in.
+	/// @param[in] __encoding The encoding to read the input with.
+	/// @param[in] __max_code_points The maximum number of code points to skip.
+	/// @param[in] __error_handler The error handler to invoke when a decode operation fails.
+	///
+	/// @returns A ztd::text::stateless_count_result whose `input` starts right after the last skipped code point and
+	/// whose `count` is the number of code points skipped.
+	///
+	/// @remarks Calls ztd::text::advance_code_points(Input, Encoding, std::size_t, ErrorHandler, State) with a
+	/// `state` that is created by ztd::text::make_decode_state(Encoding).
+	template <typename _Input, typename _Encoding, typename _ErrorHandler>
+	constexpr auto advance_code_points(_Input&& __input, _Encoding&& __encoding, ::std::size_t __max_code_points,
+		_ErrorHandler&& __error_handler) {
+		using _UEncoding = remove_cvref_t<_Encoding>;
+		using _State     = decode_state_t<_UEncoding>;
+
+		_State __state         = make_decode_state(__encoding);
+		auto __stateful_result = advance_code_points(::std::forward<_Input>(__input),
+			::std::forward<_Encoding>(__encoding), __max_code_points, ::std::forward<_ErrorHandler>(__error_handler),
+			__state);
+		return __txt_detail::__slice_to_stateless(::std::move(__stateful_result));
+	}
+
+	//////
+	/// @brief Skips over at most `__max_code_points` code points of the `__input`.
+	///
+	/// @param[in] __input The input range (of code units) to skip code points in.
+	/// @param[in] __encoding The encoding to read the input with.
+	/// @param[in] __max_code_points The maximum number of code points to skip.
+	///
+	/// @returns A ztd::text::stateless_count_result whose `input` starts right after the last skipped code point and
+	/// whose `count` is the number of code points skipped.
+	///
+	/// @remarks Calls ztd::text::advance_code_points(Input, Encoding, std::size_t, ErrorHandler) with an
+	/// `error_handler` that is similar to ztd::text::default_handler_t.
+	template <typename _Input, typename _Encoding>
+	constexpr auto advance_code_points(_Input&& __input, _Encoding&& __encoding, ::std::size_t __max_code_points) {
+		default_handler_t __handler {};
+		return advance_code_points(
+			::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __max_code_points, __handler);
+	}
+
+	//////
+	/// @brief Skips over at most `__max_code_points` code points of the `__input`.
+	///
+	/// @param[in] __input The input range (of code units) to skip code points in.
+	/// @param[in] __max_code_points The maximum number of code points to skip.
+	///
+	/// @returns A ztd::text::stateless_count_result whose `input` starts right after the last skipped code point and
+	/// whose `count` is the number of code points skipped.
+	///
+	/// @remarks Calls ztd::text::advance_code_points(Input, Encoding, std::size_t) with an `encoding` that is derived
+	/// from ztd::text::default_code_unit_encoding.
+	template <typename _Input>
+	constexpr auto advance_code_points(_Input&& __input, ::std::size_t __max_code_points) {
+		using _UInput   = remove_cvref_t<_Input>;
+		using _CodeUnit = ranges::range_value_type_t<_UInput>;
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+		if (::std::is_constant_evaluated()) {
+			// Use literal encoding instead, if we meet the right criteria
+			using _Encoding = default_consteval_code_unit_encoding_t<_CodeUnit>;
+			_Encoding __encoding {};
+			return advance_code_points(::std::forward<_Input>(__input), __encoding, __max_code_points);
+		}
+		else
+#endif
+		{
+			using _Encoding = default_code_unit_encoding_t<_CodeUnit>;
+			_Encoding __encoding {};
+			return advance_code_points(::std::forward<_Input>(__input), __encoding, __max_code_points);
+		}
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_ADVANCE_CODE_POINTS_HPP
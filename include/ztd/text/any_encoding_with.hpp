@@ -636,17 +636,35 @@ namespace ztd { namespace text {
 				decode_state& __state) const override {
 				__real_decode_state& __actual_state = this->_M_get_state(__state);
 				__txt_detail::__progress_handler<::std::false_type, any_encoding_with> __pass_handler {};
-				auto& __encoding  = this->_M_get_encoding();
-				auto __raw_result = ::ztd::text::decode_into(
-					::std::move(__input), __encoding, ::std::move(__output), __pass_handler, __actual_state);
-				if (__raw_result.error_code != encoding_error::ok) {
-					return __error_handler(__self,
-						__decode_result(::std::move(__raw_result.input), ::std::move(__raw_result.output),
-						     __state, __raw_result.error_code, __raw_result.handled_errors),
+				auto& __encoding               = this->_M_get_encoding();
+				::std::size_t __handled_errors = 0;
+				for (;;) {
+					// The whole remaining input goes to the wrapped encoding's bulk path (including any of its
+					// text_decode extension points): we only come back out here to run the erased error handler.
+					auto __raw_result = ::ztd::text::decode_into(
+						::std::move(__input), __encoding, ::std::move(__output), __pass_handler, __actual_state);
+					__handled_errors += __raw_result.handled_errors;
+					if (__raw_result.error_code == encoding_error::ok) {
+						return __decode_result(::std::move(__raw_result.input), ::std::move(__raw_result.output),
+							__state, __raw_result.error_code, __handled_errors);
+					}
+					__decode_result __handled_result = __error_handler(__self,
+						__decode_result(::std::move(__raw_result.input), ::std::move(__raw_result.output), __state,
+						     __raw_result.error_code, __handled_errors),
 						__pass_handler._M_code_units_progress(), __pass_handler._M_code_points_progress());
+					if (__handled_result.error_code != encoding_error::ok) {
+						return __handled_result;
+					}
+					// the error was smoothed over: resume the bulk conversion right after it
+					__handled_errors = __handled_result.handled_errors;
+					__input          = ::std::move(__handled_result.input);
+					__output         = ::std::move(__handled_result.output);
+					__pass_handler.clear();
+					if (ranges::ranges_adl::adl_empty(__input) && text::is_state_complete(__actual_state)) {
+						return __decode_result(::std::move(__input), ::std::move(__output), __state,
+							encoding_error::ok, __handled_errors);
+					}
 				}
-				return __decode_result(::std::move(__raw_result.input), ::std::move(__raw_result.output), __state,
-					__raw_result.error_code, __raw_result.handled_errors);
 			}
 
 			virtual __encode_result __encode(const any_encoding_with& __self, _EncodeCodePoints __input,
@@ -654,17 +672,35 @@ namespace ztd { namespace text {
 				encode_state& __state) const override {
 				__real_encode_state& __actual_state = this->_M_get_state(__state);
 				__txt_detail::__progress_handler<::std::false_type, any_encoding_with> __pass_handler {};
-				auto& __encoding  = this->_M_get_encoding();
-				auto __raw_result = ::ztd::text::encode_into(
-					::std::move(__input), __encoding, ::std::move(__output), __pass_handler, __actual_state);
-				if (__raw_result.error_code != encoding_error::ok) {
-					return __error_handler(__self,
-						__encode_result(::std::move(__raw_result.input), ::std::move(__raw_result.output),
-						     __state, __raw_result.error_code, __raw_result.handled_errors),
+				auto& __encoding               = this->_M_get_encoding();
+				::std::size_t __handled_errors = 0;
+				for (;;) {
+					// The whole remaining input goes to the wrapped encoding's bulk path (including any of its
+					// text_encode extension points): we only come back out here to run the erased error handler.
+					auto __raw_result = ::ztd::text::encode_into(
+						::std::move(__input), __encoding, ::std::move(__output), __pass_handler, __actual_state);
+					__handled_errors += __raw_result.handled_errors;
+					if (__raw_result.error_code == encoding_error::ok) {
+						return __encode_result(::std::move(__raw_result.input), ::std::move(__raw_result.output),
+							__state, __raw_result.error_code, __handled_errors);
+					}
+					__encode_result __handled_result = __error_handler(__self,
+						__encode_result(::std::move(__raw_result.input), ::std::move(__raw_result.output), __state,
+						     __raw_result.error_code, __handled_errors),
 						__pass_handler._M_code_points_progress(), __pass_handler._M_code_units_progress());
+					if (__handled_result.error_code != encoding_error::ok) {
+						return __handled_result;
+					}
+					// the error was smoothed over: resume the bulk conversion right after it
+					__handled_errors = __handled_result.handled_errors;
+					__input          = ::std::move(__handled_result.input);
+					__output         = ::std::move(__handled_result.output);
+					__pass_handler.clear();
+					if (ranges::ranges_adl::adl_empty(__input) && text::is_state_complete(__actual_state)) {
+						return __encode_result(::std::move(__input), ::std::move(__output), __state,
+							encoding_error::ok, __handled_errors);
+					}
 				}
-				return __encode_result(::std::move(__raw_result.input), ::std::move(__raw_result.output), __state,
-					__raw_result.error_code, __raw_result.handled_errors);
 			}
 
 			virtual __validate_decodable_as_result __validate_decodable_as(
@@ -882,20 +918,26 @@ namespace ztd { namespace text {
 				*this, ::std::move(__input), ::std::move(__error_handler), __state);
 		}
 
-		template <typename _Output, typename _ErrorHandler, typename _State>
-		constexpr friend auto __text_decode(::ztd::tag<any_encoding_with>, _DecodeCodeUnits __input,
+		// NOTE: the tag is deduced so that derived types (e.g. ztd::text::any_byte_encoding, whose tag is not
+		// ztd::tag<any_encoding_with>) still reach the bulk path instead of looping over the virtual decode_one /
+		// encode_one. The error handler is passed by reference so no copy is made when it is erased, and so stateful
+		// handlers (e.g. the intermediate handlers used by the *_to functions) observe what happened.
+		template <typename _Self, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<::std::is_base_of_v<any_encoding_with, _Self>>* = nullptr>
+		constexpr friend auto __text_decode(::ztd::tag<_Self>, _DecodeCodeUnits __input,
 			type_identity_t<const any_encoding_with&> __encoding, _Output&& __output,
 			_ErrorHandler&& __error_handler, _State& __state) {
-			return __encoding.__decode(::std::move(__input), ::std::forward<_Output>(__output),
-				::std::forward<_ErrorHandler>(__error_handler), __state);
+			return __encoding.__decode(
+				::std::move(__input), ::std::forward<_Output>(__output), ::std::ref(__error_handler), __state);
 		}
 
-		template <typename _Output, typename _ErrorHandler, typename _State>
-		constexpr friend auto __text_encode(::ztd::tag<any_encoding_with>, _EncodeCodePoints __input,
+		template <typename _Self, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<::std::is_base_of_v<any_encoding_with, _Self>>* = nullptr>
+		constexpr friend auto __text_encode(::ztd::tag<_Self>, _EncodeCodePoints __input,
 			type_identity_t<const any_encoding_with&> __encoding, _Output&& __output,
 			_ErrorHandler&& __error_handler, _State& __state) {
-			return __encoding.__encode(::std::move(__input), ::std::forward<_Output>(__output),
-				::std::forward<_ErrorHandler>(__error_handler), __state);
+			return __encoding.__encode(
+				::std::move(__input), ::std::forward<_Output>(__output), ::std::ref(__error_handler), __state);
 		}
 
 		template <typename _EncodeState>
@@ -51,6 +51,50 @@ namespace ztd { namespace text {
 			basic_no_encoding<_CodeUnit, _CodePoint>
 #endif
 			;
+
+		// Whether iconv may keep shift state between calls for the named encoding (ISO-2022 escape sequences,
+		// UTF-7 base64 runs, HZ's "~{" and "~}", SO / SI in the stateful EBCDIC code pages, or the byte order picked
+		// up from a BOM), going by its name. The empty name (the locale's encoding) could be anything, so it counts
+		// as stateful too, as does anything too long to check.
+		inline bool __is_iconv_stateful_encoding_name(::std::string_view __name) noexcept {
+			char __normalized[48] {};
+			::std::size_t __size = 0;
+			for (char __c : __name) {
+				if (__c >= 'a' && __c <= 'z') {
+					__c = static_cast<char>(__c - 'a' + 'A');
+				}
+				else if (!((__c >= 'A' && __c <= 'Z') || (__c >= '0' && __c <= '9'))) {
+					// "ISO-2022-JP", "iso_2022_jp" and "ISO2022JP" are all the same name to iconv
+					continue;
+				}
+				if (__size == sizeof(__normalized)) {
+					return true;
+				}
+				__normalized[__size] = __c;
+				++__size;
+			}
+			const ::std::string_view __normalized_name(__normalized, __size);
+			constexpr ::std::string_view __stateful_names[]
+				= { "", "UTF16", "UTF32", "UNICODE", "IBM930", "IBM933", "IBM935", "IBM937", "IBM939" };
+			constexpr ::std::string_view __stateful_prefixes[] = { "HZ", "CP5022" };
+			constexpr ::std::string_view __stateful_infixes[]  = { "2022", "UTF7" };
+			for (const ::std::string_view& __stateful_name : __stateful_names) {
+				if (__normalized_name == __stateful_name) {
+					return true;
+				}
+			}
+			for (const ::std::string_view& __stateful_prefix : __stateful_prefixes) {
+				if (__normalized_name.substr(0, __stateful_prefix.size()) == __stateful_prefix) {
+					return true;
+				}
+			}
+			for (const ::std::string_view& __stateful_infix : __stateful_infixes) {
+				if (__normalized_name.find(__stateful_infix) != ::std::string_view::npos) {
+					return true;
+				}
+			}
+			return false;
+		}
 	} // namespace __txt_detail
 
 	//////
@@ -77,7 +121,10 @@ namespace ztd { namespace text {
 
 		inline static constexpr ::std::size_t _MaxDrainSize = 64;
 
-		void _M_reset_state(::ztd::plat::icnv::descriptor __desc) const noexcept {
+		template <typename, typename>
+		friend class basic_iconv;
+
+		static void _M_reset_state(::ztd::plat::icnv::descriptor __desc) noexcept {
 			const auto& __iconv_functions = ::ztd::plat::icnv::functions();
 			char __drain[_MaxDrainSize];
 			char* __p_drain                          = __drain;
@@ -191,12 +238,27 @@ namespace ztd { namespace text {
 		/// @brief The state for decode operations.
 		///
 		/// @remarks This contains the actual conversion descriptor for iconv. When the state disappears, so does
-		/// its descriptor.
+		/// its descriptor (or, with `ZTD_TEXT_ICONV_DESCRIPTOR_CACHE` on, it goes back to the calling thread's
+		/// cache).
 		struct decode_state {
 			::ztd::plat::icnv::descriptor _M_conv_descriptor;
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+			__txt_detail::__iconv_descriptor_key _M_cache_key;
+#endif
 
 			decode_state(const basic_iconv& __source) noexcept
-			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor) {
+			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor)
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+			, _M_cache_key(__source._M_to_name, __source._M_from_name)
+#endif
+			{
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+				this->_M_conv_descriptor = __txt_detail::__take_cached_iconv_descriptor(this->_M_cache_key);
+				if (this->_M_is_valid()) {
+					// already opened and reset when it was given back
+					return;
+				}
+#endif
 				this->_M_conv_descriptor = ::ztd::plat::icnv::functions().open(
 					__source._M_to_name.c_str(), __source._M_from_name.c_str());
 				if (this->_M_is_valid()) {
@@ -210,6 +272,13 @@ namespace ztd { namespace text {
 
 			~decode_state() {
 				if (this->_M_conv_descriptor != ::ztd::plat::icnv::failure_descriptor) {
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+					basic_iconv::_M_reset_state(this->_M_conv_descriptor);
+					if (__txt_detail::__give_cached_iconv_descriptor(
+						     this->_M_cache_key, this->_M_conv_descriptor)) {
+						return;
+					}
+#endif
 					int __close_result = ::ztd::plat::icnv::functions().close(this->_M_conv_descriptor);
 					ZTD_TEXT_ASSERT(__close_result == ::ztd::plat::icnv::close_success);
 				}
@@ -219,13 +288,28 @@ namespace ztd { namespace text {
 		//////
 		/// @brief The state for encode operations.
 		///
-		/// @remarks This contains the ac        tual conversion descriptor for iconv. When the state disappears,
-		/// so does its descriptor.
+		/// @remarks This contains the actual conversion descriptor for iconv. When the state disappears, so does
+		/// its descriptor (or, with `ZTD_TEXT_ICONV_DESCRIPTOR_CACHE` on, it goes back to the calling thread's
+		/// cache).
 		struct encode_state {
 			::ztd::plat::icnv::descriptor _M_conv_descriptor;
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+			__txt_detail::__iconv_descriptor_key _M_cache_key;
+#endif
 
 			encode_state(const basic_iconv& __source) noexcept
-			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor) {
+			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor)
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+			, _M_cache_key(__source._M_from_name, __source._M_to_name)
+#endif
+			{
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+				this->_M_conv_descriptor = __txt_detail::__take_cached_iconv_descriptor(this->_M_cache_key);
+				if (this->_M_is_valid()) {
+					// already opened and reset when it was given back
+					return;
+				}
+#endif
 				this->_M_conv_descriptor = ::ztd::plat::icnv::functions().open(
 					__source._M_from_name.c_str(), __source._M_to_name.c_str());
 				if (this->_M_is_valid()) {
@@ -240,6 +324,13 @@ namespace ztd { namespace text {
 
 			~encode_state() {
 				if (this->_M_conv_descriptor != ::ztd::plat::icnv::failure_descriptor) {
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+					basic_iconv::_M_reset_state(this->_M_conv_descriptor);
+					if (__txt_detail::__give_cached_iconv_descriptor(
+						     this->_M_cache_key, this->_M_conv_descriptor)) {
+						return;
+					}
+#endif
 					int __close_result = ::ztd::plat::icnv::functions().close(this->_M_conv_descriptor);
 					ZTD_TEXT_ASSERT(__close_result == ::ztd::plat::icnv::close_success);
 				}
@@ -589,6 +680,318 @@ namespace ztd { namespace text {
 			}
 		}
 
+	private:
+		template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+		auto _M_decode(_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler,
+			decode_state& __state) const noexcept {
+			using _UInputRange   = remove_cvref_t<_InputRange>;
+			using _UOutputRange  = remove_cvref_t<_OutputRange>;
+			using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+			using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+			using _Result        = decltype(this->decode_one(::std::declval<_WorkingInput>(),
+				       ::std::declval<_WorkingOutput>(), __error_handler, __state));
+
+			_WorkingInput __working_input
+				= ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::forward<_InputRange>(__input));
+			_WorkingOutput __working_output
+				= ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output));
+			if (!__state._M_is_valid()) {
+				return this->decode_one(
+					::std::move(__working_input), ::std::move(__working_output), __error_handler, __state);
+			}
+
+			::std::size_t __handled_errors = 0;
+			for (;;) {
+				if (ranges::ranges_adl::adl_empty(__working_input)) {
+					return _Result(::std::move(__working_input), ::std::move(__working_output), __state,
+						encoding_error::ok, __handled_errors);
+				}
+				// hand iconv as much as we possibly can in one go, straight into the output
+				const ::std::size_t __read_size  = ranges::ranges_adl::adl_size(__working_input);
+				const ::std::size_t __write_size = ranges::ranges_adl::adl_size(__working_output);
+				const char* __read_pointer
+					= reinterpret_cast<const char*>(ranges::ranges_adl::adl_data(__working_input));
+				::std::size_t __read_buffer_size = __read_size * sizeof(code_unit);
+				char* __write_pointer = reinterpret_cast<char*>(ranges::ranges_adl::adl_data(__working_output));
+				::std::size_t __write_buffer_size           = __write_size * sizeof(code_point);
+				const ::std::size_t __attempted_write_result = ::ztd::plat::icnv::functions().convert(
+					__state._M_conv_descriptor, ::std::addressof(__read_pointer), &__read_buffer_size,
+					::std::addressof(__write_pointer), &__write_buffer_size);
+				const ::std::size_t __read_count    = __read_size - (__read_buffer_size / sizeof(code_unit));
+				const ::std::size_t __written_count = __write_size - (__write_buffer_size / sizeof(code_point));
+				__working_input = ranges::reconstruct(::std::in_place_type<_UInputRange>,
+					ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+					ranges::ranges_adl::adl_end(__working_input));
+				__working_output = ranges::reconstruct(::std::in_place_type<_UOutputRange>,
+					ranges::ranges_adl::adl_begin(__working_output) + __written_count,
+					ranges::ranges_adl::adl_end(__working_output));
+				if (__attempted_write_result != ::ztd::plat::icnv::conversion_failure) {
+					continue;
+				}
+				ZTD_TEXT_ASSERT(errno != EBADF);
+				// EILSEQ, EINVAL, or E2BIG: iconv stopped right before the offending sequence, so step through just
+				// that one with the one-at-a-time path to get exact positions (and progress) to the error handler
+				auto __one_result = this->decode_one(
+					::std::move(__working_input), ::std::move(__working_output), __error_handler, __state);
+				__handled_errors += __one_result.handled_errors;
+				if (__one_result.error_code != encoding_error::ok) {
+					__one_result.handled_errors = __handled_errors;
+					return __one_result;
+				}
+				__working_input  = ::std::move(__one_result.input);
+				__working_output = ::std::move(__one_result.output);
+			}
+		}
+
+		template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+		auto _M_encode(_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler,
+			encode_state& __state) const noexcept {
+			using _UInputRange   = remove_cvref_t<_InputRange>;
+			using _UOutputRange  = remove_cvref_t<_OutputRange>;
+			using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+			using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+			using _Result        = decltype(this->encode_one(::std::declval<_WorkingInput>(),
+				       ::std::declval<_WorkingOutput>(), __error_handler, __state));
+
+			_WorkingInput __working_input
+				= ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::forward<_InputRange>(__input));
+			_WorkingOutput __working_output
+				= ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output));
+			if (!__state._M_is_valid()) {
+				return this->encode_one(
+					::std::move(__working_input), ::std::move(__working_output), __error_handler, __state);
+			}
+
+			::std::size_t __handled_errors = 0;
+			for (;;) {
+				if (ranges::ranges_adl::adl_empty(__working_input)) {
+					return _Result(::std::move(__working_input), ::std::move(__working_output), __state,
+						encoding_error::ok, __handled_errors);
+				}
+				// hand iconv as much as we possibly can in one go, straight into the output
+				const ::std::size_t __read_size  = ranges::ranges_adl::adl_size(__working_input);
+				const ::std::size_t __write_size = ranges::ranges_adl::adl_size(__working_output);
+				const char* __read_pointer
+					= reinterpret_cast<const char*>(ranges::ranges_adl::adl_data(__working_input));
+				::std::size_t __read_buffer_size = __read_size * sizeof(code_point);
+				char* __write_pointer = reinterpret_cast<char*>(ranges::ranges_adl::adl_data(__working_output));
+				::std::size_t __write_buffer_size           = __write_size * sizeof(code_unit);
+				const ::std::size_t __attempted_write_result = ::ztd::plat::icnv::functions().convert(
+					__state._M_conv_descriptor, ::std::addressof(__read_pointer), &__read_buffer_size,
+					::std::addressof(__write_pointer), &__write_buffer_size);
+				const ::std::size_t __read_count    = __read_size - (__read_buffer_size / sizeof(code_point));
+				const ::std::size_t __written_count = __write_size - (__write_buffer_size / sizeof(code_unit));
+				__working_input = ranges::reconstruct(::std::in_place_type<_UInputRange>,
+					ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+					ranges::ranges_adl::adl_end(__working_input));
+				__working_output = ranges::reconstruct(::std::in_place_type<_UOutputRange>,
+					ranges::ranges_adl::adl_begin(__working_output) + __written_count,
+					ranges::ranges_adl::adl_end(__working_output));
+				if (__attempted_write_result != ::ztd::plat::icnv::conversion_failure) {
+					continue;
+				}
+				ZTD_TEXT_ASSERT(errno != EBADF);
+				// EILSEQ, EINVAL, or E2BIG: iconv stopped right before the offending sequence, so step through just
+				// that one with the one-at-a-time path to get exact positions (and progress) to the error handler
+				auto __one_result = this->encode_one(
+					::std::move(__working_input), ::std::move(__working_output), __error_handler, __state);
+				__handled_errors += __one_result.handled_errors;
+				if (__one_result.error_code != encoding_error::ok) {
+					__one_result.handled_errors = __handled_errors;
+					return __one_result;
+				}
+				__working_input  = ::std::move(__one_result.input);
+				__working_output = ::std::move(__one_result.output);
+			}
+		}
+
+		//////
+		/// @brief A descriptor which converts straight from this encoding to the encoding of another basic_iconv
+		/// (both of their "from" names), for transcoding between two iconv encodings without going through code
+		/// points.
+		struct __transcode_state {
+			::ztd::plat::icnv::descriptor _M_conv_descriptor;
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+			__txt_detail::__iconv_descriptor_key _M_cache_key;
+#endif
+
+			__transcode_state(const basic_iconv& __source, const ::std::string& __to_name, bool __open) noexcept
+			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor)
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+			, _M_cache_key(__to_name, __source._M_from_name)
+#endif
+			{
+				if (!__open) {
+					return;
+				}
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+				this->_M_conv_descriptor = __txt_detail::__take_cached_iconv_descriptor(this->_M_cache_key);
+				if (this->_M_is_valid()) {
+					// already opened and reset when it was given back
+					return;
+				}
+#endif
+				this->_M_conv_descriptor
+					= ::ztd::plat::icnv::functions().open(__to_name.c_str(), __source._M_from_name.c_str());
+				if (this->_M_is_valid()) {
+					__source._M_reset_descriptor(__to_name, this->_M_conv_descriptor, sizeof(_CodeUnit));
+				}
+			}
+
+			bool _M_is_valid() const noexcept {
+				return ::ztd::plat::icnv::descriptor_is_valid(this->_M_conv_descriptor);
+			}
+
+			~__transcode_state() {
+				if (this->_M_conv_descriptor != ::ztd::plat::icnv::failure_descriptor) {
+#if ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+					basic_iconv::_M_reset_state(this->_M_conv_descriptor);
+					if (__txt_detail::__give_cached_iconv_descriptor(
+						     this->_M_cache_key, this->_M_conv_descriptor)) {
+						return;
+					}
+#endif
+					int __close_result = ::ztd::plat::icnv::functions().close(this->_M_conv_descriptor);
+					ZTD_TEXT_ASSERT(__close_result == ::ztd::plat::icnv::close_success);
+				}
+			}
+		};
+
+		template <typename _ToCodeUnit, typename _InputRange, typename _OutputRange, typename _FromErrorHandler,
+			typename _ToErrorHandler, typename _ToState>
+		auto _M_transcode(_InputRange&& __input, _OutputRange&& __output,
+			const basic_iconv<_ToCodeUnit, _CodePoint>& __to_encoding, _FromErrorHandler&& __from_error_handler,
+			_ToErrorHandler&& __to_error_handler, decode_state& __from_state, _ToState& __to_state) const noexcept {
+			using _UInputRange   = remove_cvref_t<_InputRange>;
+			using _UOutputRange  = remove_cvref_t<_OutputRange>;
+			using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+			using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+			using _Result        = transcode_result<_WorkingInput, _WorkingOutput, decode_state, _ToState>;
+
+			_WorkingInput __working_input
+				= ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::forward<_InputRange>(__input));
+			_WorkingOutput __working_output
+				= ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output));
+			// a single descriptor would keep any shift state to itself, where neither __from_state nor __to_state
+			// (nor the next call) could see it: only go direct between encodings that have none
+			const bool __is_direct_safe = !__txt_detail::__is_iconv_stateful_encoding_name(this->_M_from_name)
+				&& !__txt_detail::__is_iconv_stateful_encoding_name(__to_encoding._M_from_name);
+			__transcode_state __direct_state(*this, __to_encoding._M_from_name, __is_direct_safe);
+
+			::std::size_t __handled_errors = 0;
+			for (;;) {
+				if (ranges::ranges_adl::adl_empty(__working_input)) {
+					return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+						__to_state, encoding_error::ok, __handled_errors);
+				}
+				if (__direct_state._M_is_valid()) {
+					// hand iconv as much as we possibly can in one go, straight from one encoding to the other
+					const ::std::size_t __read_size  = ranges::ranges_adl::adl_size(__working_input);
+					const ::std::size_t __write_size = ranges::ranges_adl::adl_size(__working_output);
+					const char* __read_pointer
+						= reinterpret_cast<const char*>(ranges::ranges_adl::adl_data(__working_input));
+					::std::size_t __read_buffer_size = __read_size * sizeof(code_unit);
+					char* __write_pointer
+						= reinterpret_cast<char*>(ranges::ranges_adl::adl_data(__working_output));
+					::std::size_t __write_buffer_size           = __write_size * sizeof(_ToCodeUnit);
+					const ::std::size_t __attempted_write_result = ::ztd::plat::icnv::functions().convert(
+						__direct_state._M_conv_descriptor, ::std::addressof(__read_pointer), &__read_buffer_size,
+						::std::addressof(__write_pointer), &__write_buffer_size);
+					const ::std::size_t __read_count = __read_size - (__read_buffer_size / sizeof(code_unit));
+					const ::std::size_t __written_count
+						= __write_size - (__write_buffer_size / sizeof(_ToCodeUnit));
+					__working_input = ranges::reconstruct(::std::in_place_type<_UInputRange>,
+						ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+						ranges::ranges_adl::adl_end(__working_input));
+					__working_output = ranges::reconstruct(::std::in_place_type<_UOutputRange>,
+						ranges::ranges_adl::adl_begin(__working_output) + __written_count,
+						ranges::ranges_adl::adl_end(__working_output));
+					if (__attempted_write_result != ::ztd::plat::icnv::conversion_failure) {
+						continue;
+					}
+					ZTD_TEXT_ASSERT(errno != EBADF);
+				}
+				// Either there is no direct descriptor for this pair (it could not be opened, or one of the
+				// encodings may keep shift state, so everything goes through the separate states), or iconv stopped
+				// in front of something it could not convert. iconv does not tell us whether it could not read the
+				// input or could not write the output, so push just this one bit through the separate decode and
+				// encode states: whichever side is at fault reports it to its own error handler. (The direct
+				// descriptor is only used between encodings without shift state, so the separate states can pick up
+				// from it.)
+				code_point __intermediate_storage[max_code_points];
+				::ztd::span<code_point> __intermediate(__intermediate_storage);
+				// The input only moves past this bit once it has been encoded too, so that a failure on either side
+				// reports the bit that could not be transcoded.
+				auto __decode_result
+					= this->decode_one(__working_input, __intermediate, __from_error_handler, __from_state);
+				__handled_errors += __decode_result.handled_errors;
+				if (__decode_result.error_code != encoding_error::ok) {
+					return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+						__to_state, __decode_result.error_code, __handled_errors);
+				}
+				::ztd::span<code_point> __decoded(
+					__intermediate_storage, __decode_result.output.data() - __intermediate_storage);
+				while (!__decoded.empty()) {
+					auto __encode_result = __to_encoding.encode_one(
+						::std::move(__decoded), ::std::move(__working_output), __to_error_handler, __to_state);
+					__handled_errors += __encode_result.handled_errors;
+					__working_output = ::std::move(__encode_result.output);
+					if (__encode_result.error_code != encoding_error::ok) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+							__to_state, __encode_result.error_code, __handled_errors);
+					}
+					__decoded = ::std::move(__encode_result.input);
+				}
+				__working_input = ::std::move(__decode_result.input);
+			}
+		}
+
+		// Bulk conversions: only for contiguous input and output whose elements are exactly what iconv will be
+		// reading and writing, so entire buffers can be given to a single iconv() call. Everything else goes
+		// through the usual decode_one/encode_one loop.
+		template <typename _Self, typename _InputRange, typename _OutputRange, typename _ErrorHandler,
+			::std::enable_if_t<::std::is_base_of_v<basic_iconv, _Self>                              // cf
+			     && __txt_detail::__is_contiguous_range_of_v<_InputRange, code_unit>                // cf
+			     && __txt_detail::__is_contiguous_range_of_v<_OutputRange, code_point>>* = nullptr> // cf
+		friend auto __text_decode(::ztd::tag<_Self>, _InputRange&& __input,
+			type_identity_t<const basic_iconv&> __encoding, _OutputRange&& __output,
+			_ErrorHandler&& __error_handler, decode_state& __state) noexcept {
+			return __encoding._M_decode(::std::forward<_InputRange>(__input),
+				::std::forward<_OutputRange>(__output), ::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
+		template <typename _Self, typename _InputRange, typename _OutputRange, typename _ErrorHandler,
+			::std::enable_if_t<::std::is_base_of_v<basic_iconv, _Self>                             // cf
+			     && __txt_detail::__is_contiguous_range_of_v<_InputRange, code_point>              // cf
+			     && __txt_detail::__is_contiguous_range_of_v<_OutputRange, code_unit>>* = nullptr> // cf
+		friend auto __text_encode(::ztd::tag<_Self>, _InputRange&& __input,
+			type_identity_t<const basic_iconv&> __encoding, _OutputRange&& __output,
+			_ErrorHandler&& __error_handler, encode_state& __state) noexcept {
+			return __encoding._M_encode(::std::forward<_InputRange>(__input),
+				::std::forward<_OutputRange>(__output), ::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
+		// Transcoding between two iconv encodings: one descriptor going directly from the "from" encoding to the
+		// "to" encoding, rather than decoding to code points with one descriptor and re-encoding with another.
+		template <typename _Self, typename _ToSelf, typename _ToCodeUnit, typename _InputRange,
+			typename _OutputRange, typename _FromErrorHandler, typename _ToErrorHandler, typename _PivotRange,
+			::std::enable_if_t<::std::is_base_of_v<basic_iconv, _Self>                               // cf
+			     && ::std::is_base_of_v<basic_iconv<_ToCodeUnit, _CodePoint>, _ToSelf>               // cf
+			     && __txt_detail::__is_contiguous_range_of_v<_InputRange, code_unit>                 // cf
+			     && __txt_detail::__is_contiguous_range_of_v<_OutputRange, _ToCodeUnit>>* = nullptr> // cf
+		friend auto __text_transcode(::ztd::tag<_Self, _ToSelf>, _InputRange&& __input,
+			type_identity_t<const basic_iconv&> __from_encoding, _OutputRange&& __output,
+			const basic_iconv<_ToCodeUnit, _CodePoint>& __to_encoding, _FromErrorHandler&& __from_error_handler,
+			_ToErrorHandler&& __to_error_handler, decode_state& __from_state,
+			typename basic_iconv<_ToCodeUnit, _CodePoint>::encode_state& __to_state,
+			pivot<_PivotRange>& __pivot) noexcept {
+			(void)__pivot;
+			return __from_encoding._M_transcode(::std::forward<_InputRange>(__input),
+				::std::forward<_OutputRange>(__output), __to_encoding,
+				::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+		}
+
 #endif
 	public:
 		//////
@@ -606,6 +1009,21 @@ namespace ztd { namespace text {
 		std::string _M_to_name;
 	};
 
+	//////
+	/// @brief Closes all of the idle iconv descriptors kept around for the calling thread.
+	///
+	/// @remarks This only does anything when `ZTD_TEXT_ICONV_DESCRIPTOR_CACHE` is turned on. Descriptors which are
+	/// currently held by a ztd::text::basic_iconv state are not affected, and go back into the cache as usual when
+	/// their state is destroyed.
+	inline void purge_iconv_descriptor_cache() noexcept {
+#if ZTD_IS_ON(ZTD_PLATFORM_LIBICONV) && ZTD_IS_ON(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+		__txt_detail::__iconv_descriptor_cache* __cache = __txt_detail::__thread_iconv_descriptor_cache();
+		if (__cache != nullptr) {
+			__cache->_M_purge();
+		}
+#endif
+	}
+
 	//////
 	/// @}
 
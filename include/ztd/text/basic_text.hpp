@@ -49,6 +49,8 @@
 #include <ztd/text/basic_text_view_iterator.hpp>
 #include <ztd/text/assert.hpp>
 #include <ztd/text/detail/default_char_range.hpp>
+#include <ztd/text/detail/compare_routines.hpp>
+#include <ztd/text/detail/hash_routines.hpp>
 
 #include <ztd/idk/unwrap.hpp>
 #include <ztd/idk/basic_c_string_view.hpp>
@@ -59,6 +61,8 @@
 
 #include <string>
 #include <iterator>
+#include <memory>
+#include <functional>
 
 #include <ztd/prologue.hpp>
 
@@ -93,7 +97,8 @@ namespace ztd { namespace text {
 		using __allow_single_argument_with_variadic_constructor = ::std::integral_constant<bool,
 			(::std::is_same_v<::ztd::remove_cvref_t<_RangeOrCount>, basic_text>)
 			     ? (sizeof...(_Args) > 0)
-			     : !(::ztd::is_character_pointer_v<_RangeOrCount>)>;
+			     : (!(::ztd::is_character_pointer_v<_RangeOrCount>)
+			          && !(::std::is_same_v<::ztd::remove_cvref_t<_RangeOrCount>, ::std::allocator_arg_t>))>;
 
 	public:
 		//////
@@ -339,6 +344,70 @@ namespace ztd { namespace text {
 			}
 		}
 
+		//////
+		/// @brief Constructs an empty basic text whose underlying storage is constructed with the given allocator.
+		template <typename _Alloc, ::std::enable_if_t<::std::uses_allocator_v<range_type, _Alloc>>* = nullptr>
+		constexpr basic_text(::std::allocator_arg_t, const _Alloc& __allocator) noexcept(
+			::std::is_nothrow_default_constructible_v<encoding_type>              // cf
+			     && ::std::is_nothrow_default_constructible_v<normalization_type> // cf
+			     && ::std::is_nothrow_constructible_v<range_type, const _Alloc&>)
+		: _M_encoding(), _M_normalization(), _M_range(__allocator) {
+			this->_M_verify_integrity();
+		}
+
+		//////
+		/// @brief Constructs from a given range into storage that uses the given allocator, performing a conversion
+		/// from code points if necessary.
+		///
+		/// @remarks The converted code units are appended directly into the allocator-aware storage with
+		/// ztd::text::encode_into_container or ztd::text::transcode_into_container, so no temporary container using
+		/// a different allocator is ever created.
+		template <typename _Alloc, typename _Input,
+			::std::enable_if_t<::std::uses_allocator_v<range_type, _Alloc>>* = nullptr>
+		constexpr basic_text(
+			::std::allocator_arg_t, const _Alloc& __allocator, ::ztd::ranges::from_range_t, _Input&& __input)
+		: basic_text(::std::allocator_arg, __allocator) {
+			using _InputValueType = ranges::range_value_type_t<_Input>;
+			if constexpr (is_compatible_code_points_v<code_point, _InputValueType>) {
+				::ztd::text::encode_into_container(
+					::std::forward<_Input>(__input), this->_M_encoding, ::ztd::unwrap(this->_M_range));
+			}
+			else {
+				using _FromEncoding = default_code_unit_encoding_t<_InputValueType>;
+				_FromEncoding __from_encoding {};
+				default_handler_t __handler {};
+				this->_M_transcode_into_storage(::std::forward<_Input>(__input), __from_encoding, __handler);
+			}
+			this->_M_verify_integrity();
+		}
+
+		//////
+		/// @brief Constructs from a given range of code units in the given encoding into storage that uses the given
+		/// allocator.
+		template <typename _Alloc, typename _Input, typename _FromEncoding,
+			::std::enable_if_t<::std::uses_allocator_v<range_type, _Alloc>>* = nullptr>
+		constexpr basic_text(::std::allocator_arg_t, const _Alloc& __allocator, ::ztd::ranges::from_range_t,
+			_Input&& __input, _FromEncoding&& __from_encoding)
+		: basic_text(::std::allocator_arg, __allocator) {
+			default_handler_t __handler {};
+			this->_M_transcode_into_storage(
+				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding), __handler);
+			this->_M_verify_integrity();
+		}
+
+		//////
+		/// @brief Constructs from a given range of code units in the given encoding into storage that uses the given
+		/// allocator, using the given error handler for the conversion.
+		template <typename _Alloc, typename _Input, typename _FromEncoding, typename _ErrorHandler,
+			::std::enable_if_t<::std::uses_allocator_v<range_type, _Alloc>>* = nullptr>
+		constexpr basic_text(::std::allocator_arg_t, const _Alloc& __allocator, ::ztd::ranges::from_range_t,
+			_Input&& __input, _FromEncoding&& __from_encoding, _ErrorHandler&& __error_handler)
+		: basic_text(::std::allocator_arg, __allocator) {
+			this->_M_transcode_into_storage(::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ErrorHandler>(__error_handler));
+			this->_M_verify_integrity();
+		}
+
 		explicit constexpr basic_text(::std::in_place_t) // cf
 			noexcept(_S_constructor_in_place())
 		: _M_encoding(), _M_normalization(), _M_range() {
@@ -414,6 +483,13 @@ namespace ztd { namespace text {
 			return ::std::move(this->_M_range);
 		}
 
+		// observers: allocator
+		template <typename _DeferredRange = _URange>
+		constexpr auto get_allocator() const noexcept
+			-> decltype(::std::declval<const _DeferredRange&>().get_allocator()) {
+			return ::ztd::unwrap(this->_M_range).get_allocator();
+		}
+
 		// observers: encoding
 		constexpr encoding_type& encoding() & noexcept {
 			return this->_M_range;
@@ -430,8 +506,113 @@ namespace ztd { namespace text {
 		// modifiers:
 		// modifiers: insertion
 
+		// comparison
+
+		//////
+		/// @brief Checks whether two texts hold the same text.
+		///
+		/// @remarks If both use the same normalization form and the same (or a bitwise-compatible, see
+		/// ztd::text::is_bitwise_transcoding_compatible) UTF or ASCII encoding over contiguous storage, and both are
+		/// well-formed, the code units are compared directly with `memcmp`. Otherwise, both are decoded a block of
+		/// code points at a time and the code points are compared.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange>
+		friend constexpr bool operator==(const basic_text& __left,
+			const basic_text<_RightEncoding, _RightNormalizationForm, _RightRange>& __right) {
+			return __left._M_equal(__right);
+		}
+
+		//////
+		/// @brief Checks whether two texts hold different text.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange>
+		friend constexpr bool operator!=(const basic_text& __left,
+			const basic_text<_RightEncoding, _RightNormalizationForm, _RightRange>& __right) {
+			return !__left._M_equal(__right);
+		}
+
+		//////
+		/// @brief Checks whether the left text comes before the right text, in code point order.
+		///
+		/// @remarks The order is the same whatever the encodings are, and matches the order of
+		/// ztd::text::basic_text_view.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange>
+		friend constexpr bool operator<(const basic_text& __left,
+			const basic_text<_RightEncoding, _RightNormalizationForm, _RightRange>& __right) {
+			return __left._M_compare(__right) < 0;
+		}
+
+		//////
+		/// @brief Checks whether the left text comes before or is the same as the right text, in code point order.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange>
+		friend constexpr bool operator<=(const basic_text& __left,
+			const basic_text<_RightEncoding, _RightNormalizationForm, _RightRange>& __right) {
+			return __left._M_compare(__right) <= 0;
+		}
+
+		//////
+		/// @brief Checks whether the left text comes after the right text, in code point order.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange>
+		friend constexpr bool operator>(const basic_text& __left,
+			const basic_text<_RightEncoding, _RightNormalizationForm, _RightRange>& __right) {
+			return __left._M_compare(__right) > 0;
+		}
+
+		//////
+		/// @brief Checks whether the left text comes after or is the same as the right text, in code point order.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange>
+		friend constexpr bool operator>=(const basic_text& __left,
+			const basic_text<_RightEncoding, _RightNormalizationForm, _RightRange>& __right) {
+			return __left._M_compare(__right) >= 0;
+		}
 
 	private:
+		template <typename, typename, typename>
+		friend class basic_text;
+
+		friend ::std::hash<basic_text>;
+
+		constexpr ::std::size_t _M_hash() const {
+			default_handler_t __error_handler {};
+			auto __state = ::ztd::text::make_decode_state(this->_M_encoding);
+			return __txt_detail::__text_hash(
+				::ztd::unwrap(this->_M_range), this->_M_encoding, __error_handler, __state);
+		}
+
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange>
+		constexpr int _M_compare(
+			const basic_text<_RightEncoding, _RightNormalizationForm, _RightRange>& __right) const {
+			constexpr bool _SameNormalization
+				= ::std::is_same_v<_UNormalizationForm, unwrap_remove_cvref_t<_RightNormalizationForm>>;
+			default_handler_t __left_error_handler {};
+			default_handler_t __right_error_handler {};
+			auto __left_state  = ::ztd::text::make_decode_state(this->_M_encoding);
+			auto __right_state = ::ztd::text::make_decode_state(__right._M_encoding);
+			return __txt_detail::__text_compare<_SameNormalization>(::ztd::unwrap(this->_M_range), this->_M_encoding,
+				__left_error_handler, __left_state, ::ztd::unwrap(__right._M_range), __right._M_encoding,
+				__right_error_handler, __right_state);
+		}
+
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange>
+		constexpr bool _M_equal(
+			const basic_text<_RightEncoding, _RightNormalizationForm, _RightRange>& __right) const {
+			constexpr bool _SameNormalization
+				= ::std::is_same_v<_UNormalizationForm, unwrap_remove_cvref_t<_RightNormalizationForm>>;
+			default_handler_t __left_error_handler {};
+			default_handler_t __right_error_handler {};
+			auto __left_state  = ::ztd::text::make_decode_state(this->_M_encoding);
+			auto __right_state = ::ztd::text::make_decode_state(__right._M_encoding);
+			return __txt_detail::__text_equal<_SameNormalization>(::ztd::unwrap(this->_M_range), this->_M_encoding,
+				__left_error_handler, __left_state, ::ztd::unwrap(__right._M_range), __right._M_encoding,
+				__right_error_handler, __right_state);
+		}
+
+		template <typename _Input, typename _FromEncoding, typename _ErrorHandler>
+		constexpr void _M_transcode_into_storage(
+			_Input&& __input, _FromEncoding&& __from_encoding, _ErrorHandler&& __error_handler) {
+			::ztd::text::transcode_into_container(::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::ztd::unwrap(this->_M_range), this->_M_encoding,
+				::std::forward<_ErrorHandler>(__error_handler));
+		}
+
 		constexpr void _M_verify_integrity() const noexcept {
 			const bool __success = ::ztd::text::validate_decodable_as(this->_M_range, this->_M_encoding).valid;
 			ZTD_TEXT_ASSERT_MESSAGE("given data has violated its encoding constraints", __success);
@@ -447,4 +628,18 @@ namespace ztd { namespace text {
 
 #include <ztd/epilogue.hpp>
 
+namespace std {
+	//////
+	/// @brief Hashes the code points of a ztd::text::basic_text, so that texts holding the same code points hash the
+	/// same whatever their encodings are. The hash matches that of a ztd::text::basic_text_view over the same code
+	/// points.
+	template <typename _Encoding, typename _NormalizationForm, typename _Range>
+	class hash<::ztd::text::basic_text<_Encoding, _NormalizationForm, _Range>> {
+	public:
+		::std::size_t operator()(const ::ztd::text::basic_text<_Encoding, _NormalizationForm, _Range>& __text) const {
+			return __text._M_hash();
+		}
+	};
+} // namespace std
+
 #endif // ZTD_TEXT_BASIC_TEXT_HPP
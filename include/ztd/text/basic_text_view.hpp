@@ -41,9 +41,18 @@
 #include <ztd/text/normalization.hpp>
 #include <ztd/text/normalized_view.hpp>
 #include <ztd/text/decode_view.hpp>
+#include <ztd/text/code_point_index.hpp>
 #include <ztd/text/state.hpp>
+#include <ztd/text/pass_handler.hpp>
+#include <ztd/text/detail/compare_routines.hpp>
+#include <ztd/text/detail/hash_routines.hpp>
+#include <ztd/text/detail/search_routines.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 
 #include <ztd/prologue.hpp>
 
@@ -91,6 +100,20 @@ namespace ztd { namespace text {
 		template <typename, typename, typename>
 		friend class ztd::text::basic_text;
 
+		template <typename, typename, typename, typename, typename>
+		friend class basic_text_view;
+
+		friend ::std::hash<basic_text_view>;
+
+		template <typename, typename>
+		friend class __txt_detail::__text_split_range;
+
+		using _UEncoding = remove_cvref_t<encoding_type>;
+		using _CodeUnit  = code_unit_t<_UEncoding>;
+		using _CodePoint = code_point_t<_UEncoding>;
+
+		static constexpr ::std::size_t _MaxCodeUnits = max_code_units_v<_UEncoding>;
+
 		template <typename _ViewErrorHandler = error_handler_type>
 		using _CodePointView = decode_view<encoding_type, range_type, remove_cvref_t<_ViewErrorHandler>, state_type>;
 
@@ -103,7 +126,119 @@ namespace ztd { namespace text {
 		normalization_type _M_normalization;
 		error_handler_type _M_error_handler;
 
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange,
+			typename _RightErrorHandler, typename _RightState>
+		constexpr int _M_compare(const basic_text_view<_RightEncoding, _RightNormalizationForm, _RightRange,
+			_RightErrorHandler, _RightState>& __right) const {
+			error_handler_type __left_error_handler                  = this->_M_error_handler;
+			state_type __left_state                                  = this->_M_state;
+			remove_cvref_t<_RightErrorHandler> __right_error_handler = __right._M_error_handler;
+			remove_cvref_t<_RightState> __right_state                = __right._M_state;
+			return __txt_detail::__text_compare<::std::is_same_v<normalization_type, _RightNormalizationForm>>(
+				this->_M_storage, this->_M_encoding, __left_error_handler, __left_state, __right._M_storage,
+				__right._M_encoding, __right_error_handler, __right_state);
+		}
+
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange,
+			typename _RightErrorHandler, typename _RightState>
+		constexpr bool _M_equal(const basic_text_view<_RightEncoding, _RightNormalizationForm, _RightRange,
+			_RightErrorHandler, _RightState>& __right) const {
+			error_handler_type __left_error_handler                  = this->_M_error_handler;
+			state_type __left_state                                  = this->_M_state;
+			remove_cvref_t<_RightErrorHandler> __right_error_handler = __right._M_error_handler;
+			remove_cvref_t<_RightState> __right_state                = __right._M_state;
+			return __txt_detail::__text_equal<::std::is_same_v<normalization_type, _RightNormalizationForm>>(
+				this->_M_storage, this->_M_encoding, __left_error_handler, __left_state, __right._M_storage,
+				__right._M_encoding, __right_error_handler, __right_state);
+		}
+
+		template <bool _Last, typename _Input, typename _NeedleState>
+		constexpr auto _M_search(_Input&& __input, state_type& __state, const _CodeUnit* __needle,
+			::std::size_t __needle_size, const _NeedleState& __needle_state) const {
+			error_handler_type __error_handler = this->_M_error_handler;
+			return __txt_detail::__search_encoded<_Last>(::std::forward<_Input>(__input), this->_M_encoding,
+				__error_handler, __state, __needle, __needle_size, __needle_state);
+		}
+
+		template <bool _Last>
+		constexpr auto _M_search_code_point(_CodePoint __code_point) const {
+			_CodeUnit __needle[_MaxCodeUnits] {};
+			const ::std::size_t __needle_size = this->_M_encode_needle(__code_point, __needle);
+			if (__needle_size == __txt_detail::__search_npos) {
+				// not representable in this encoding, so it cannot be in here
+				return __txt_detail::__search_not_found(this->_M_storage);
+			}
+			state_type __state = this->_M_state;
+			return this->_M_search<_Last>(this->_M_storage, __state, __needle, __needle_size,
+				::ztd::text::make_decode_state(this->_M_encoding));
+		}
+
+		template <bool _Last, typename _NeedleRange, typename _NeedleErrorHandler, typename _NeedleState>
+		constexpr auto _M_search_text(const basic_text_view<encoding_type, normalization_type, _NeedleRange,
+			_NeedleErrorHandler, _NeedleState>& __needle) const {
+			static_assert(__txt_detail::__is_contiguous_range_of_v<_NeedleRange, _CodeUnit>,
+				"the needle's code units must be contiguous");
+			state_type __state = this->_M_state;
+			return this->_M_search<_Last>(this->_M_storage, __state,
+				ranges::ranges_adl::adl_data(__needle._M_storage),
+				ranges::ranges_adl::adl_size(__needle._M_storage), __needle._M_state);
+		}
+
+		// Encodes a code point to search for, starting from the initial state (which is also the state it is decoded
+		// from, for encodings that are searched code point by code point). Returns __search_npos if this view's
+		// encoding cannot represent it.
+		constexpr ::std::size_t _M_encode_needle(
+			_CodePoint __code_point, _CodeUnit (&__storage)[_MaxCodeUnits]) const {
+			pass_handler_t __error_handler {};
+			auto __state                = ::ztd::text::make_encode_state(this->_M_encoding);
+			const _CodePoint __input[1] = { __code_point };
+			auto __result = this->_M_encoding.encode_one(::ztd::span<const _CodePoint>(__input),
+				::ztd::span<_CodeUnit>(__storage), __error_handler, __state);
+			if (__result.error_code != encoding_error::ok) {
+				return __txt_detail::__search_npos;
+			}
+			return static_cast<::std::size_t>(__result.output.data() - __storage);
+		}
+
+		constexpr ::std::size_t _M_hash() const {
+			error_handler_type __error_handler = this->_M_error_handler;
+			state_type __state                 = this->_M_state;
+			return __txt_detail::__text_hash(this->_M_storage, this->_M_encoding, __error_handler, __state);
+		}
+
 	public:
+		//////
+		/// @brief Constructs an empty view.
+		constexpr basic_text_view() = default;
+
+		//////
+		/// @brief Constructs a view over the given range of code units.
+		///
+		/// @param[in] __range The code units to view.
+		constexpr explicit basic_text_view(range_type __range) noexcept(
+			::std::is_nothrow_move_constructible_v<range_type>)
+		: _M_storage(::std::move(__range))
+		, _M_encoding()
+		, _M_state(::ztd::text::make_decode_state(this->_M_encoding))
+		, _M_normalization()
+		, _M_error_handler() {
+		}
+
+		//////
+		/// @brief Constructs a view over the given range of code units, using the given encoding to interpret them.
+		///
+		/// @param[in] __range The code units to view.
+		/// @param[in] __encoding The encoding to interpret the code units with.
+		constexpr basic_text_view(range_type __range, encoding_type __encoding) noexcept(
+			::std::is_nothrow_move_constructible_v<range_type> // cf
+			     && ::std::is_nothrow_move_constructible_v<encoding_type>)
+		: _M_storage(::std::move(__range))
+		, _M_encoding(::std::move(__encoding))
+		, _M_state(::ztd::text::make_decode_state(this->_M_encoding))
+		, _M_normalization()
+		, _M_error_handler() {
+		}
+
 		//////
 		/// @brief Returns a view over the code points of this type, decoding "on the fly"/"lazily".
 		///
@@ -140,6 +275,158 @@ namespace ztd { namespace text {
 			return _CodePointView<>(this->_M_storage, this->_M_encoding, this->_M_error_handler, this->_M_state);
 		}
 
+		//////
+		/// @brief Returns this view without its first `__code_points` code points.
+		///
+		/// @param[in] __code_points The number of code points to skip.
+		/// @param[in] __index An index built over this view's code units, used to start decoding from the nearest
+		/// checkpoint rather than from the beginning.
+		///
+		/// @remarks If the text ends before `__code_points` code points, the returned view is empty. If a decode
+		/// error is not corrected by the error handler first, the returned view starts at the ill-formed sequence
+		/// instead, and so is not empty. Use ztd::text::basic_code_point_index::advance directly to get the number
+		/// of code points that were actually skipped and the error that stopped it.
+		template <typename _IndexAllocator>
+		constexpr basic_text_view advance(::std::size_t __code_points,
+			basic_code_point_index<encoding_type, _IndexAllocator>& __index) const {
+			error_handler_type __error_handler = this->_M_error_handler;
+			basic_text_view __advanced(*this);
+			__advanced._M_storage = __index.advance(this->_M_storage, __code_points, __error_handler).input;
+			return __advanced;
+		}
+
+		//////
+		/// @brief Returns the code points [`__position`, `__position + __count`) of this view.
+		///
+		/// @param[in] __position The first code point to include.
+		/// @param[in] __count The number of code points to include. Anything past the end is ignored.
+		/// @param[in] __index An index built over this view's code units, used to start decoding from the nearest
+		/// checkpoint rather than from the beginning.
+		///
+		/// @remarks A decode error that is not corrected by the error handler ends the text early: both ends of the
+		/// returned view stop at the ill-formed sequence if they would otherwise be past it.
+		template <typename _IndexAllocator>
+		constexpr basic_text_view substr(::std::size_t __position, ::std::size_t __count,
+			basic_code_point_index<encoding_type, _IndexAllocator>& __index) const {
+			error_handler_type __error_handler = this->_M_error_handler;
+			basic_text_view __sub(*this);
+			__sub._M_storage = __index.substr(this->_M_storage, __position, __count, __error_handler);
+			return __sub;
+		}
+
+		//////
+		/// @brief Finds the first occurrence of a code point.
+		///
+		/// @param[in] __code_point The code point to look for.
+		///
+		/// @returns An iterator into base() at the start of the first occurrence, or at the end of base() if there
+		/// is none.
+		///
+		/// @remarks The code point is encoded once and then searched for as code units. For UTF-8, UTF-16, UTF-32,
+		/// and ASCII over contiguous code units, that is a `memchr` (or `wmemchr`-style) scan for the first code unit
+		/// with the rest checked in place: these encodings are self-synchronizing, so a match always starts on a
+		/// code point boundary. Any other encoding is decoded one step at a time and checked at every boundary.
+		/// Encodings with a shift state are checked code point by code point instead, as the code units for the
+		/// same code point change with the state the text is in.
+		constexpr auto find(_CodePoint __code_point) const {
+			return this->_M_search_code_point<false>(__code_point).position;
+		}
+
+		//////
+		/// @brief Finds the first occurrence of some text.
+		///
+		/// @param[in] __needle The text to look for, in the same encoding and normalization form, over contiguous
+		/// code units.
+		///
+		/// @returns An iterator into base() at the start of the first occurrence, or at the end of base() if there
+		/// is none. An empty needle is found at the start.
+		template <typename _NeedleRange, typename _NeedleErrorHandler, typename _NeedleState>
+		constexpr auto find(const basic_text_view<encoding_type, normalization_type, _NeedleRange,
+			_NeedleErrorHandler, _NeedleState>& __needle) const {
+			return this->_M_search_text<false>(__needle).position;
+		}
+
+		//////
+		/// @brief Finds the last occurrence of a code point.
+		///
+		/// @param[in] __code_point The code point to look for.
+		///
+		/// @returns An iterator into base() at the start of the last occurrence, or at the end of base() if there
+		/// is none.
+		constexpr auto rfind(_CodePoint __code_point) const {
+			return this->_M_search_code_point<true>(__code_point).position;
+		}
+
+		//////
+		/// @brief Finds the last occurrence of some text.
+		///
+		/// @param[in] __needle The text to look for, in the same encoding and normalization form, over contiguous
+		/// code units.
+		///
+		/// @returns An iterator into base() at the start of the last occurrence, or at the end of base() if there
+		/// is none. An empty needle is found at the end.
+		template <typename _NeedleRange, typename _NeedleErrorHandler, typename _NeedleState>
+		constexpr auto rfind(const basic_text_view<encoding_type, normalization_type, _NeedleRange,
+			_NeedleErrorHandler, _NeedleState>& __needle) const {
+			return this->_M_search_text<true>(__needle).position;
+		}
+
+		//////
+		/// @brief Whether the code point shows up in this view.
+		///
+		/// @param[in] __code_point The code point to look for.
+		constexpr bool contains(_CodePoint __code_point) const {
+			return this->_M_search_code_point<false>(__code_point).found;
+		}
+
+		//////
+		/// @brief Whether the text shows up in this view.
+		///
+		/// @param[in] __needle The text to look for, in the same encoding and normalization form, over contiguous
+		/// code units.
+		template <typename _NeedleRange, typename _NeedleErrorHandler, typename _NeedleState>
+		constexpr bool contains(const basic_text_view<encoding_type, normalization_type, _NeedleRange,
+			_NeedleErrorHandler, _NeedleState>& __needle) const {
+			return this->_M_search_text<false>(__needle).found;
+		}
+
+		//////
+		/// @brief Splits this view on a delimiting code point.
+		///
+		/// @param[in] __delimiter The code point to split on.
+		///
+		/// @returns A lazy forward range of views over the pieces between delimiters. There is always one more
+		/// piece than there are delimiters: empty text gives one empty piece, and a delimiter at the end gives an
+		/// empty last piece.
+		constexpr auto split(_CodePoint __delimiter) const {
+			_CodeUnit __needle[_MaxCodeUnits] {};
+			::std::size_t __needle_size = this->_M_encode_needle(__delimiter, __needle);
+			if (__needle_size == __txt_detail::__search_npos) {
+				// not representable in this encoding, so there is nothing to split on
+				__needle_size = 0;
+			}
+			return __txt_detail::__text_split_range<basic_text_view, decode_state_t<_UEncoding>>(::std::in_place,
+				*this, __needle, __needle_size, ::ztd::text::make_decode_state(this->_M_encoding));
+		}
+
+		//////
+		/// @brief Splits this view on a delimiting piece of text.
+		///
+		/// @param[in] __delimiter The text to split on, in the same encoding and normalization form, over
+		/// contiguous code units. It is not copied, so it must outlive the returned range. An empty delimiter does
+		/// not split at all.
+		///
+		/// @returns A lazy forward range of views over the pieces between delimiters.
+		template <typename _DelimiterRange, typename _DelimiterErrorHandler, typename _DelimiterState>
+		constexpr auto split(const basic_text_view<encoding_type, normalization_type, _DelimiterRange,
+			_DelimiterErrorHandler, _DelimiterState>& __delimiter) const {
+			static_assert(__txt_detail::__is_contiguous_range_of_v<_DelimiterRange, _CodeUnit>,
+				"the delimiter's code units must be contiguous");
+			return __txt_detail::__text_split_range<basic_text_view, remove_cvref_t<_DelimiterState>>(*this,
+				ranges::ranges_adl::adl_data(__delimiter._M_storage),
+				ranges::ranges_adl::adl_size(__delimiter._M_storage), __delimiter._M_state);
+		}
+
 		//////
 		/// @brief Access the storage as an r-value reference.
 		constexpr range_type&& base() && noexcept {
@@ -157,6 +444,80 @@ namespace ztd { namespace text {
 		constexpr range_type& base() & noexcept {
 			return this->_M_storage;
 		}
+
+		//////
+		/// @brief Checks whether two views hold the same text.
+		///
+		/// @remarks If both views use the same normalization form and the same (or a bitwise-compatible, see
+		/// ztd::text::is_bitwise_transcoding_compatible) UTF or ASCII encoding over contiguous code units, and both
+		/// are well-formed, the code units are compared directly with `memcmp`. Otherwise, both views are decoded a
+		/// block of code points at a time (from the first ill-formed code unit on, if the code units could be
+		/// compared up to there), using their own error handlers and states, and the code points are compared.
+		/// Anything an error handler does not recover from is compared as if it was replaced, as by
+		/// ztd::text::replacement_handler_t.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange,
+			typename _RightErrorHandler, typename _RightState>
+		friend constexpr bool operator==(const basic_text_view& __left,
+			const basic_text_view<_RightEncoding, _RightNormalizationForm, _RightRange, _RightErrorHandler,
+			     _RightState>& __right) {
+			return __left._M_equal(__right);
+		}
+
+		//////
+		/// @brief Checks whether two views hold different text.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange,
+			typename _RightErrorHandler, typename _RightState>
+		friend constexpr bool operator!=(const basic_text_view& __left,
+			const basic_text_view<_RightEncoding, _RightNormalizationForm, _RightRange, _RightErrorHandler,
+			     _RightState>& __right) {
+			return !__left._M_equal(__right);
+		}
+
+		//////
+		/// @brief Checks whether the left view's text comes before the right view's text, in code point order.
+		///
+		/// @remarks The order is the same whatever the encodings are. For UTF-8 and UTF-32 (and for UTF-16, after
+		/// moving the surrogates above U+E000-U+FFFF) this is also the code unit order, so views with the same
+		/// normalization form and encoding over contiguous code units are compared without decoding.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange,
+			typename _RightErrorHandler, typename _RightState>
+		friend constexpr bool operator<(const basic_text_view& __left,
+			const basic_text_view<_RightEncoding, _RightNormalizationForm, _RightRange, _RightErrorHandler,
+			     _RightState>& __right) {
+			return __left._M_compare(__right) < 0;
+		}
+
+		//////
+		/// @brief Checks whether the left view's text comes before or is the same as the right view's text, in
+		/// code point order.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange,
+			typename _RightErrorHandler, typename _RightState>
+		friend constexpr bool operator<=(const basic_text_view& __left,
+			const basic_text_view<_RightEncoding, _RightNormalizationForm, _RightRange, _RightErrorHandler,
+			     _RightState>& __right) {
+			return __left._M_compare(__right) <= 0;
+		}
+
+		//////
+		/// @brief Checks whether the left view's text comes after the right view's text, in code point order.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange,
+			typename _RightErrorHandler, typename _RightState>
+		friend constexpr bool operator>(const basic_text_view& __left,
+			const basic_text_view<_RightEncoding, _RightNormalizationForm, _RightRange, _RightErrorHandler,
+			     _RightState>& __right) {
+			return __left._M_compare(__right) > 0;
+		}
+
+		//////
+		/// @brief Checks whether the left view's text comes after or is the same as the right view's text, in
+		/// code point order.
+		template <typename _RightEncoding, typename _RightNormalizationForm, typename _RightRange,
+			typename _RightErrorHandler, typename _RightState>
+		friend constexpr bool operator>=(const basic_text_view& __left,
+			const basic_text_view<_RightEncoding, _RightNormalizationForm, _RightRange, _RightErrorHandler,
+			     _RightState>& __right) {
+			return __left._M_compare(__right) >= 0;
+		}
 	};
 
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
@@ -164,4 +525,24 @@ namespace ztd { namespace text {
 
 #include <ztd/epilogue.hpp>
 
+namespace std {
+	//////
+	/// @brief Hashes the code points of a ztd::text::basic_text_view, so that views holding the same code points
+	/// hash the same whatever their encodings are.
+	///
+	/// @remarks The hash is taken over the UTF-8 encoding of the code points. Well-formed runs of UTF-8 (and ASCII)
+	/// views over contiguous code units are hashed as they are; any other view is decoded a block at a time and
+	/// re-encoded as UTF-8 on the way into the hash. Ill-formed text is hashed as whatever it compares as: normally
+	/// U+FFFD, as ztd::text::replacement_handler_t would write it, so views that compare equal always hash the same.
+	template <typename _Encoding, typename _NormalizationForm, typename _Range, typename _ErrorHandler,
+		typename _State>
+	class hash<::ztd::text::basic_text_view<_Encoding, _NormalizationForm, _Range, _ErrorHandler, _State>> {
+	public:
+		::std::size_t operator()(const ::ztd::text::basic_text_view<_Encoding, _NormalizationForm, _Range,
+			_ErrorHandler, _State>& __view) const {
+			return __view._M_hash();
+		}
+	};
+} // namespace std
+
 #endif // ZTD_TEXT_BASIC_TEXT_VIEW_HPP
@@ -0,0 +1,310 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_CODE_POINT_INDEX_HPP
+#define ZTD_TEXT_CODE_POINT_INDEX_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/count_result.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/detail/advance_routines.hpp>
+
+#include <ztd/idk/unwrap.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_ranges Ranges, Views, and Iterators
+	///
+	/// @{
+
+	//////
+	/// @brief One entry of a ztd::text::basic_code_point_index: a position in some text, as both the number of code
+	/// points and the number of code units in front of it.
+	struct code_point_checkpoint {
+		//////
+		/// @brief The number of code points in front of this position.
+		::std::size_t code_points;
+		//////
+		/// @brief The number of code units in front of this position.
+		::std::size_t code_units;
+	};
+
+	//////
+	/// @brief A side index over some text that records a checkpoint every few code points, so that finding code
+	/// point number N only decodes from the nearest checkpoint rather than from the start of the text.
+	///
+	/// @tparam _Encoding The encoding of the indexed text. Decoding restarts at every checkpoint with a fresh state,
+	/// so it must meet ztd::text::is_decode_state_independent_v.
+	/// @tparam _Allocator The allocator used for the checkpoints.
+	///
+	/// @remarks The index does not keep the text: every query is handed the same text again, which should be a
+	/// random access range for the jumps to checkpoints to be cheap. Checkpoints are built lazily, only as far as
+	/// the furthest code point asked for so far, using the bulk UTF code point counter where it applies. If the
+	/// text changes, call invalidate_from() with the code unit offset of the first change: every checkpoint in front
+	/// of it is kept, and the rest are rebuilt by the next query that needs them. Decoding stops indexing at the
+	/// first error the error handler does not correct.
+	template <typename _Encoding, typename _Allocator = ::std::allocator<code_point_checkpoint>>
+	class basic_code_point_index {
+	private:
+		using _UEncoding = unwrap_remove_cvref_t<_Encoding>;
+
+		static_assert(is_decode_state_independent_v<_UEncoding>,
+			"the encoding's decode state must be independent, as decoding restarts at every checkpoint");
+
+	public:
+		//////
+		/// @brief The encoding type of the indexed text.
+		using encoding_type = _Encoding;
+		//////
+		/// @brief The allocator type used for the checkpoints.
+		using allocator_type = _Allocator;
+		//////
+		/// @brief The type of each recorded checkpoint.
+		using checkpoint_type = code_point_checkpoint;
+
+		//////
+		/// @brief The number of code points between two checkpoints when none is given.
+		inline static constexpr ::std::size_t default_stride = 256;
+
+		//////
+		/// @brief Constructs an empty index, with a checkpoint every
+		/// ztd::text::basic_code_point_index::default_stride code points.
+		basic_code_point_index() : basic_code_point_index(default_stride) {
+		}
+
+		//////
+		/// @brief Constructs an empty index.
+		///
+		/// @param[in] __stride The number of code points between two checkpoints. It is raised to
+		/// ztd::text::max_code_points_v if it is smaller.
+		/// @param[in] __encoding The encoding object used to decode the text.
+		/// @param[in] __allocator The allocator used for the checkpoints.
+		explicit basic_code_point_index(::std::size_t __stride, encoding_type __encoding = encoding_type(),
+			const allocator_type& __allocator = allocator_type())
+		: _M_encoding(::std::move(__encoding))
+		, _M_checkpoints(__allocator)
+		, _M_stride((::std::max)(__stride, max_code_points_v<_UEncoding>))
+		, _M_complete(false) {
+		}
+
+		//////
+		/// @brief The number of code points between two checkpoints.
+		::std::size_t stride() const noexcept {
+			return this->_M_stride;
+		}
+
+		//////
+		/// @brief The encoding object used to decode the text.
+		const encoding_type& encoding() const noexcept {
+			return this->_M_encoding;
+		}
+
+		//////
+		/// @brief The checkpoints built so far, in order.
+		const ::std::vector<checkpoint_type, allocator_type>& checkpoints() const noexcept {
+			return this->_M_checkpoints;
+		}
+
+		//////
+		/// @brief Skips the first `__code_points` code points of `__range`.
+		///
+		/// @param[in] __range The indexed text.
+		/// @param[in] __code_points The number of code points to skip.
+		/// @param[in] __error_handler The error handler for any decode failures.
+		///
+		/// @returns A ztd::text::stateless_count_result whose `input` starts at the requested code point and whose
+		/// `count` is the number of code points actually skipped. The count is smaller than asked for if the text
+		/// ends first, if a decode error is not corrected, or if a single decode step produces code points on both
+		/// sides of the requested one.
+		template <typename _Range, typename _ErrorHandler>
+		auto advance(_Range&& __range, ::std::size_t __code_points, _ErrorHandler&& __error_handler) {
+			using _WorkingRange = ranges::range_reconstruct_t<remove_cvref_t<_Range>>;
+			using _Result       = stateless_count_result<_WorkingRange>;
+
+			_WorkingRange __working_range
+				= ranges::reconstruct(::std::in_place_type<_WorkingRange>, ::std::forward<_Range>(__range));
+			this->_M_extend_to(__working_range, __code_points, __error_handler);
+			// the first checkpoint is always { 0, 0 }, so there is always one at or in front of the target
+			auto __checkpoint_it = ::std::upper_bound(this->_M_checkpoints.cbegin(), this->_M_checkpoints.cend(),
+				__code_points, [](::std::size_t __target, const checkpoint_type& __checkpoint) {
+					return __target < __checkpoint.code_points;
+				});
+			--__checkpoint_it;
+			const checkpoint_type __from = *__checkpoint_it;
+			auto __state                 = make_decode_state(this->_M_encoding);
+			auto __result = __txt_detail::__basic_advance_code_points(this->_M_range_at(__working_range, __from),
+				this->_M_encoding, __code_points - __from.code_points, __error_handler, __state);
+			return _Result(::std::move(__result.input), __from.code_points + __result.count, __result.error_code,
+				__result.handled_errors);
+		}
+
+		//////
+		/// @brief Skips the first `__code_points` code points of `__range`, using a default-constructed
+		/// ztd::text::default_handler_t.
+		///
+		/// @param[in] __range The indexed text.
+		/// @param[in] __code_points The number of code points to skip.
+		template <typename _Range>
+		auto advance(_Range&& __range, ::std::size_t __code_points) {
+			default_handler_t __handler {};
+			return this->advance(::std::forward<_Range>(__range), __code_points, __handler);
+		}
+
+		//////
+		/// @brief Returns the code points [`__position`, `__position + __count`) of `__range`, as a range of code
+		/// units.
+		///
+		/// @param[in] __range The indexed text.
+		/// @param[in] __position The first code point to include.
+		/// @param[in] __count The number of code points to include. Anything past the end of the text is ignored.
+		/// @param[in] __error_handler The error handler for any decode failures.
+		///
+		/// @remarks A decode error that is not corrected by the error handler ends the text early: both ends of the
+		/// returned range stop at the ill-formed sequence if they would otherwise be past it.
+		template <typename _Range, typename _ErrorHandler>
+		auto substr(
+			_Range&& __range, ::std::size_t __position, ::std::size_t __count, _ErrorHandler&& __error_handler) {
+			using _WorkingRange = ranges::range_reconstruct_t<remove_cvref_t<_Range>>;
+
+			_WorkingRange __working_range
+				= ranges::reconstruct(::std::in_place_type<_WorkingRange>, ::std::forward<_Range>(__range));
+			const ::std::size_t __last_position
+				= __count > (::std::numeric_limits<::std::size_t>::max)() - __position
+				? (::std::numeric_limits<::std::size_t>::max)()
+				: __position + __count;
+			auto __first = this->advance(__working_range, __position, __error_handler);
+			auto __last  = this->advance(__working_range, __last_position, __error_handler);
+			return ranges::reconstruct(::std::in_place_type<_WorkingRange>,
+				ranges::ranges_adl::adl_begin(__first.input), ranges::ranges_adl::adl_begin(__last.input));
+		}
+
+		//////
+		/// @brief Returns the code points [`__position`, `__position + __count`) of `__range`, as a range of code
+		/// units, using a default-constructed ztd::text::default_handler_t.
+		///
+		/// @param[in] __range The indexed text.
+		/// @param[in] __position The first code point to include.
+		/// @param[in] __count The number of code points to include. Anything past the end of the text is ignored.
+		template <typename _Range>
+		auto substr(_Range&& __range, ::std::size_t __position, ::std::size_t __count) {
+			default_handler_t __handler {};
+			return this->substr(::std::forward<_Range>(__range), __position, __count, __handler);
+		}
+
+		//////
+		/// @brief Drops every checkpoint past the given code unit offset, for when the text changed there.
+		///
+		/// @param[in] __code_unit_offset The code unit offset of the first code unit that changed.
+		void invalidate_from(::std::size_t __code_unit_offset) noexcept {
+			auto __first_stale = ::std::upper_bound(this->_M_checkpoints.begin(), this->_M_checkpoints.end(),
+				__code_unit_offset, [](::std::size_t __offset, const checkpoint_type& __checkpoint) {
+					return __offset < __checkpoint.code_units;
+				});
+			this->_M_checkpoints.erase(__first_stale, this->_M_checkpoints.end());
+			this->_M_complete = false;
+		}
+
+		//////
+		/// @brief Drops every checkpoint, for when the whole text changed.
+		void clear() noexcept {
+			this->_M_checkpoints.clear();
+			this->_M_complete = false;
+		}
+
+	private:
+		template <typename _WorkingRange>
+		static _WorkingRange _M_range_at(const _WorkingRange& __range, const checkpoint_type& __checkpoint) {
+			return ranges::reconstruct(::std::in_place_type<_WorkingRange>,
+				::std::next(ranges::ranges_adl::adl_begin(__range), __checkpoint.code_units),
+				ranges::ranges_adl::adl_end(__range));
+		}
+
+		template <typename _WorkingRange, typename _ErrorHandler>
+		void _M_extend_to(
+			const _WorkingRange& __range, ::std::size_t __code_points, _ErrorHandler& __error_handler) {
+			if (this->_M_checkpoints.empty()) {
+				this->_M_checkpoints.push_back(checkpoint_type { 0, 0 });
+			}
+			while (!this->_M_complete
+				&& this->_M_checkpoints.back().code_points + this->_M_stride <= __code_points) {
+				const checkpoint_type __from = this->_M_checkpoints.back();
+				_WorkingRange __from_range   = this->_M_range_at(__range, __from);
+				auto __state                 = make_decode_state(this->_M_encoding);
+				auto __result                = __txt_detail::__basic_advance_code_points(
+					__from_range, this->_M_encoding, this->_M_stride, __error_handler, __state);
+				if (__result.error_code != encoding_error::ok || __result.count == 0) {
+					this->_M_complete = true;
+					break;
+				}
+				const ::std::size_t __code_units = static_cast<::std::size_t>(::std::distance(
+					ranges::ranges_adl::adl_begin(__from_range), ranges::ranges_adl::adl_begin(__result.input)));
+				this->_M_checkpoints.push_back(
+					checkpoint_type { __from.code_points + __result.count, __from.code_units + __code_units });
+				if (ranges::ranges_adl::adl_empty(__result.input)) {
+					this->_M_complete = true;
+				}
+			}
+		}
+
+		encoding_type _M_encoding;
+		::std::vector<checkpoint_type, allocator_type> _M_checkpoints;
+		::std::size_t _M_stride;
+		bool _M_complete;
+	};
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_CODE_POINT_INDEX_HPP
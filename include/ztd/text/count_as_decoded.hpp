@@ -40,6 +40,7 @@
 #include <ztd/text/count_result.hpp>
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/state.hpp>
+#include <ztd/text/segmented_range.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/validate_count_routines.hpp>
@@ -188,6 +189,31 @@ namespace ztd { namespace text {
 			return __text_count_as_decoded(::ztd::tag<remove_cvref_t<_Encoding>> {}, ::std::forward<_Input>(__input),
 				::std::forward<_Encoding>(__encoding), ::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
+		else if constexpr (is_segmented_range_v<_Input>) {
+			using _UInput      = remove_cvref_t<_Input>;
+			using _UEncoding   = remove_cvref_t<_Encoding>;
+			using _Result      = count_result<ranges::range_reconstruct_t<_UInput>, _State>;
+			using _SeamHandler = __txt_detail::__seam_deferring_handler<max_code_units_v<_UEncoding>,
+				::std::remove_reference_t<_ErrorHandler>>;
+			::std::size_t __code_point_count = 0;
+			::std::size_t __handled_errors   = 0;
+			encoding_error __error_code      = encoding_error::ok;
+			__txt_detail::__seam_deferral __deferral {};
+			auto __process = [&](auto __units, bool __deferrable) {
+				__deferral = __txt_detail::__seam_deferral {};
+				_SeamHandler __seam_handler(__error_handler, __deferral, __deferrable);
+				auto __result = count_as_decoded(__units, __encoding, __seam_handler, __state);
+				__code_point_count += __result.count;
+				__handled_errors += __deferral._M_handled(__result.handled_errors);
+				__error_code = __deferral._M_deferred ? encoding_error::ok : __result.error_code;
+				return __deferral._M_step(ranges::ranges_adl::adl_size(__units),
+					ranges::ranges_adl::adl_size(__result.input), __error_code != encoding_error::ok);
+			};
+			__txt_detail::__segment_step __read
+				= __txt_detail::__segmented_drive<max_code_units_v<_UEncoding>>(__input, __process);
+			return _Result(__txt_detail::__segmented_rest(__input, __read._M_consumed), __code_point_count, __state,
+				__error_code, __handled_errors);
+		}
 		else {
 			return basic_count_as_decoded(::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
 				::std::forward<_ErrorHandler>(__error_handler), __state);
@@ -40,6 +40,7 @@
 #include <ztd/text/count_result.hpp>
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/state.hpp>
+#include <ztd/text/segmented_range.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/transcode_routines.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
@@ -235,6 +236,33 @@ namespace ztd { namespace text {
 				::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
 				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
 		}
+		else if constexpr (is_segmented_range_v<_Input>) {
+			using _UInput        = remove_cvref_t<_Input>;
+			using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+			using _WorkingInput  = ranges::range_reconstruct_t<_UInput>;
+			using _Result        = count_transcode_result<_WorkingInput, _FromState, _ToState>;
+			using _SeamHandler   = __txt_detail::__seam_deferring_handler<max_code_units_v<_UFromEncoding>,
+				::std::remove_reference_t<_FromErrorHandler>>;
+			::std::size_t __code_unit_count = 0;
+			::std::size_t __handled_errors  = 0;
+			encoding_error __error_code     = encoding_error::ok;
+			__txt_detail::__seam_deferral __deferral {};
+			auto __process = [&](auto __units, bool __deferrable) {
+				__deferral = __txt_detail::__seam_deferral {};
+				_SeamHandler __seam_handler(__from_error_handler, __deferral, __deferrable);
+				auto __result = count_as_transcoded(__units, __from_encoding, __to_encoding, __seam_handler,
+					__to_error_handler, __from_state, __to_state, __pivot);
+				__code_unit_count += __result.count;
+				__handled_errors += __deferral._M_handled(__result.handled_errors);
+				__error_code = __deferral._M_deferred ? encoding_error::ok : __result.error_code;
+				return __deferral._M_step(ranges::ranges_adl::adl_size(__units),
+					ranges::ranges_adl::adl_size(__result.input), __error_code != encoding_error::ok);
+			};
+			__txt_detail::__segment_step __read
+				= __txt_detail::__segmented_drive<max_code_units_v<_UFromEncoding>>(__input, __process);
+			return _Result(__txt_detail::__segmented_rest(__input, __read._M_consumed), __code_unit_count,
+				__from_state, __to_state, __error_code, __handled_errors);
+		}
 		else {
 			return basic_count_as_transcoded(::std::forward<_Input>(__input),
 				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
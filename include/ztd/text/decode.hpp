@@ -40,6 +40,7 @@
 #include <ztd/text/decode_result.hpp>
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/state.hpp>
+#include <ztd/text/scratch_memory.hpp>
 #include <ztd/text/is_unicode_code_point.hpp>
 #include <ztd/text/detail/span_or_reconstruct.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
@@ -175,19 +176,15 @@ namespace ztd { namespace text {
 		template <typename _Input, typename _Encoding, typename _OutputContainer, typename _ErrorHandler,
 			typename _State>
 		constexpr auto __intermediate_decode_to_storage(_Input&& __input, _Encoding&& __encoding,
-			_OutputContainer& __output, _ErrorHandler&& __error_handler, _State& __state) {
+			_OutputContainer& __output, _ErrorHandler&& __error_handler, _State& __state,
+			::ztd::span<code_point_t<remove_cvref_t<_Encoding>>> __intermediate_translation_buffer) {
 			// Well, SHIT. Write into temporary, then serialize one-by-one/bulk to output.
 			// I'll admit, this is HELLA work to support...
 			using _UEncoding     = remove_cvref_t<_Encoding>;
 			using _UErrorHandler = remove_cvref_t<_ErrorHandler>;
-			constexpr ::std::size_t __intermediate_buffer_max
-				= ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(code_point_t<_UEncoding>)
-				     < max_code_points_v<_UEncoding>
-				? max_code_points_v<_UEncoding>
-				: ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(code_point_t<_UEncoding>);
 			using _IntermediateValueType = code_point_t<_UEncoding>;
 			using _IntermediateInput     = __string_view_or_span_or_reconstruct_t<_Input>;
-			using _InitialOutput         = ::ztd::span<_IntermediateValueType, __intermediate_buffer_max>;
+			using _InitialOutput         = ::ztd::span<_IntermediateValueType>;
 			using _Output                = ::ztd::span<_IntermediateValueType>;
 			using _Result                = decltype(__encoding.decode_one(
 				               ::std::declval<_IntermediateInput>(), ::std::declval<_Output>(), __error_handler, __state));
@@ -206,7 +203,6 @@ namespace ztd { namespace text {
 				__unused_intermediate_handler {};
 
 			_WorkingInput __working_input = __string_view_or_span_or_reconstruct(::std::forward<_Input>(__input));
-			_IntermediateValueType __intermediate_translation_buffer[__intermediate_buffer_max] {};
 
 			for (;;) {
 				// Ignore "out of output" errors and do our best to recover properly along the way...
@@ -268,51 +264,61 @@ namespace ztd { namespace text {
 			}
 		}
 
-		template <bool _OutputOnly, typename _OutputContainer, typename _Input, typename _Encoding,
-			typename _ErrorHandler, typename _State>
-		constexpr auto __decode_dispatch(
-			_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+		template <typename _Input, typename _Encoding, typename _OutputContainer, typename _ErrorHandler,
+			typename _State>
+		constexpr auto __decode_into_container_dispatch(_Input&& __input, _Encoding&& __encoding,
+			_OutputContainer& __output, _ErrorHandler&& __error_handler, _State& __state) {
 			using _UEncoding = remove_cvref_t<_Encoding>;
 
-			_OutputContainer __output {};
 			if constexpr (is_detected_v<ranges::detect_adl_size, _Input>) {
 				using _SizeType = decltype(ranges::ranges_adl::adl_size(__input));
 				if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputContainer, _SizeType>) {
 					auto __output_size_hint = ranges::ranges_adl::adl_size(__input);
 					__output_size_hint *= max_code_points_v<_UEncoding>;
-					__output.reserve(__output_size_hint);
+					__output.reserve(
+						static_cast<_SizeType>(ranges::ranges_adl::adl_size(__output)) + __output_size_hint);
 				}
 			}
 			if constexpr (__txt_detail::__is_decode_range_category_output_v<_Encoding>) {
 				using _BackInserterIterator = decltype(::std::back_inserter(::std::declval<_OutputContainer&>()));
 				using _Unbounded            = ranges::unbounded_view<_BackInserterIterator>;
 				_Unbounded __insert_view(::std::back_inserter(__output));
-				auto __stateful_result = decode_into(__txt_detail::__forward_if_move_only<_Input>(__input),
+				return decode_into(__txt_detail::__forward_if_move_only<_Input>(__input),
 					::std::forward<_Encoding>(__encoding), ::std::move(__insert_view),
 					::std::forward<_ErrorHandler>(__error_handler), __state);
-				if constexpr (_OutputOnly) {
-					// We are explicitly discarding this information with this function call.
-					(void)__stateful_result;
-					return __output;
-				}
-				else {
-					return __txt_detail::__replace_result_output(
-						::std::move(__stateful_result), ::std::move(__output));
-				}
 			}
 			else {
-				auto __stateful_result = __txt_detail::__intermediate_decode_to_storage(
-					::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __output,
-					::std::forward<_ErrorHandler>(__error_handler), __state);
-				if constexpr (_OutputOnly) {
-					// We are explicitly disca rding this information with this function call.
-					(void)__stateful_result;
-					return __output;
-				}
-				else {
-					return __txt_detail::__replace_result_output(
-						::std::move(__stateful_result), ::std::move(__output));
-				}
+				using _IntermediateValueType = code_point_t<_UEncoding>;
+				constexpr ::std::size_t __intermediate_buffer_min = max_code_points_v<_UEncoding>;
+				constexpr ::std::size_t __intermediate_buffer_max
+					= ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(_IntermediateValueType)
+					     < __intermediate_buffer_min
+					? __intermediate_buffer_min
+					: ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(_IntermediateValueType);
+				return __txt_detail::__with_scratch_buffer<_IntermediateValueType, __intermediate_buffer_max,
+					__intermediate_buffer_min>([&](::ztd::span<_IntermediateValueType> __intermediate_buffer) {
+					return __txt_detail::__intermediate_decode_to_storage(::std::forward<_Input>(__input),
+						::std::forward<_Encoding>(__encoding), __output,
+						::std::forward<_ErrorHandler>(__error_handler), __state, __intermediate_buffer);
+				});
+			}
+		}
+
+		template <bool _OutputOnly, typename _OutputContainer, typename _Input, typename _Encoding,
+			typename _ErrorHandler, typename _State>
+		constexpr auto __decode_dispatch(
+			_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+			_OutputContainer __output {};
+			auto __stateful_result = __decode_into_container_dispatch(::std::forward<_Input>(__input),
+				::std::forward<_Encoding>(__encoding), __output, ::std::forward<_ErrorHandler>(__error_handler),
+				__state);
+			if constexpr (_OutputOnly) {
+				// We are explicitly discarding this information with this function call.
+				(void)__stateful_result;
+				return __output;
+			}
+			else {
+				return __txt_detail::__replace_result_output(::std::move(__stateful_result), ::std::move(__output));
 			}
 		}
 
@@ -529,6 +535,85 @@ namespace ztd { namespace text {
 		}
 	}
 
+	//////
+	/// @brief Converts the code units of the given `__input` view through the encoding to code points, appending them
+	/// to the end of an already-existing container.
+	///
+	/// @param[in] __input An input_view to read code units from and use in the decode operation that will
+	/// produce code points.
+	/// @param[in] __encoding The encoding that will be used to decode the input's code points into
+	/// output code units.
+	/// @param[in,out] __output The container to append the decoded code points to. It is not cleared beforehand.
+	/// @param[in] __error_handler The error handlers for the from and to encodings,
+	/// respectively.
+	/// @param[in,out] __state A reference to the associated state for the `__encoding` 's decode step.
+	///
+	/// @result A ztd::text::decode_result object that contains references to `__state` and an `output` that is a
+	/// reference to `__output`.
+	///
+	/// @remarks Unlike ztd::text::decode_to, the container is never default-constructed by this function. This makes
+	/// it the right entry point for containers whose allocator must be supplied at construction time (e.g., a @c
+	/// std::pmr::u32string using a `std::pmr::monotonic_buffer_resource`), or for re-using a container's capacity
+	/// across many conversions.
+	template <typename _Input, typename _Encoding, typename _OutputContainer, typename _ErrorHandler,
+		typename _State>
+	constexpr auto decode_into_container(_Input&& __input, _Encoding&& __encoding, _OutputContainer& __output,
+		_ErrorHandler&& __error_handler, _State& __state) {
+		auto __stateful_result = __txt_detail::__decode_into_container_dispatch(::std::forward<_Input>(__input),
+			::std::forward<_Encoding>(__encoding), __output, ::std::forward<_ErrorHandler>(__error_handler),
+			__state);
+		return __txt_detail::__replace_result_output(
+			::std::move(__stateful_result), ::ztd::reference_wrapper<_OutputContainer>(__output));
+	}
+
+	//////
+	/// @brief Converts the code units of the given `__input` view through the encoding to code points, appending them
+	/// to the end of an already-existing container.
+	///
+	/// @param[in] __input An input_view to read code units from and use in the decode operation that will
+	/// produce code points.
+	/// @param[in] __encoding The encoding that will be used to decode the input's code points into
+	/// output code units.
+	/// @param[in,out] __output The container to append the decoded code points to. It is not cleared beforehand.
+	/// @param[in] __error_handler The error handlers for the from and to encodings,
+	/// respectively.
+	///
+	/// @result A ztd::text::stateless_decode_result object whose `output` is a reference to `__output`.
+	///
+	/// @remarks This function creates a `state` using ztd::text::make_decode_state.
+	template <typename _Input, typename _Encoding, typename _OutputContainer, typename _ErrorHandler>
+	constexpr auto decode_into_container(
+		_Input&& __input, _Encoding&& __encoding, _OutputContainer& __output, _ErrorHandler&& __error_handler) {
+		using _UEncoding = remove_cvref_t<_Encoding>;
+		using _State     = decode_state_t<_UEncoding>;
+
+		_State __state         = make_decode_state(__encoding);
+		auto __stateful_result = decode_into_container(::std::forward<_Input>(__input),
+			::std::forward<_Encoding>(__encoding), __output, ::std::forward<_ErrorHandler>(__error_handler),
+			__state);
+		return __txt_detail::__slice_to_stateless(::std::move(__stateful_result));
+	}
+
+	//////
+	/// @brief Converts the code units of the given `__input` view through the encoding to code points, appending them
+	/// to the end of an already-existing container.
+	///
+	/// @param[in] __input An input_view to read code units from and use in the decode operation that will
+	/// produce code points.
+	/// @param[in] __encoding The encoding that will be used to decode the input's code points into
+	/// output code units.
+	/// @param[in,out] __output The container to append the decoded code points to. It is not cleared beforehand.
+	///
+	/// @result A ztd::text::stateless_decode_result object whose `output` is a reference to `__output`.
+	///
+	/// @remarks This function creates a `handler` using ztd::text::default_handler_t, but marks it as careless.
+	template <typename _Input, typename _Encoding, typename _OutputContainer>
+	constexpr auto decode_into_container(_Input&& __input, _Encoding&& __encoding, _OutputContainer& __output) {
+		default_handler_t __handler {};
+		return decode_into_container(
+			::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __output, __handler);
+	}
+
 	//////
 	/// @brief Converts the code units of the given `__input` view through the encoding to code points the
 	/// specified
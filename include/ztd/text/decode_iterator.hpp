@@ -62,6 +62,8 @@ namespace ztd { namespace text {
 	/// @tparam _Range The range of input that will be fed into the _FromEncoding's decode operation.
 	/// @tparam _ErrorHandler The error handler for any encode-step failures.
 	/// @tparam _State The state type to use for the encode operations to intermediate code points.
+	/// @tparam _CacheSize The number of code points the iterator may hold at once. The default of `0` holds exactly
+	/// what one decode operation can produce.
 	///
 	/// @remarks This type produces proxies as their reference type, and are only readable, not writable iterators. The
 	/// iterator presents code point one at a time, regardless of how many code points are output by one decode
@@ -69,15 +71,23 @@ namespace ztd { namespace text {
 	/// present one code point at a time. If you are looking to explicitly know what a single decode operation maps
 	/// into as far as number of code points to code units (and vice-versa), you will have to use lower-level
 	/// interfaces.
+	///
+	/// @remarks A `_CacheSize` larger than ztd::text::max_code_points_v lets the iterator decode many code points
+	/// ahead every time its cache runs dry, so most increments only bump a position. Reading ahead is only done if the
+	/// error handler never reports an error (such as ztd::text::replacement_handler_t) and the range is not an input
+	/// or output range: otherwise, the iterator still decodes one step at a time so that error_code() and the
+	/// underlying range() stay exact. With a batched cache, range() is the input left over after the last refill, not
+	/// after the current code point.
 	template <typename _Encoding, typename _Range, typename _ErrorHandler = default_handler_t,
-		typename _State = decode_state_t<_Encoding>>
-	class decode_iterator : public __txt_detail::__encoding_iterator<__txt_detail::__transaction::__decode,
-		                        decode_iterator<_Encoding, _Range, _ErrorHandler, _State>,
-		                        __txt_detail::__iterator_storage<_Encoding, _Range, _ErrorHandler, _State>> {
+		typename _State = decode_state_t<_Encoding>, ::std::size_t _CacheSize = 0>
+	class decode_iterator
+	: public __txt_detail::__encoding_iterator<__txt_detail::__transaction::__decode,
+		  decode_iterator<_Encoding, _Range, _ErrorHandler, _State, _CacheSize>,
+		  __txt_detail::__iterator_storage<_Encoding, _Range, _ErrorHandler, _State>, _CacheSize> {
 	private:
 		using __iterator_base_it = __txt_detail::__encoding_iterator<__txt_detail::__transaction::__decode,
-			decode_iterator<_Encoding, _Range, _ErrorHandler, _State>,
-			__txt_detail::__iterator_storage<_Encoding, _Range, _ErrorHandler, _State>>;
+			decode_iterator<_Encoding, _Range, _ErrorHandler, _State, _CacheSize>,
+			__txt_detail::__iterator_storage<_Encoding, _Range, _ErrorHandler, _State>, _CacheSize>;
 
 	public:
 		//////
@@ -64,6 +64,7 @@ namespace ztd { namespace text {
 	/// @tparam _Range The range of input that will be fed into the _FromEncoding's decode operation.
 	/// @tparam _ErrorHandler The error handler for any encode-step failures.
 	/// @tparam _State The state type to use for the decode operations to intermediate code points.
+	/// @tparam _CacheSize The number of code points each iterator may hold at once. See ztd::text::decode_iterator.
 	///
 	/// @remarks The view presents code point one at a time, regardless of how many code points are output by one
 	/// decode operation. This means if, for example, four (4) UTF-8 code units becomes two (2) UTF-16 code points, it
@@ -71,7 +72,8 @@ namespace ztd { namespace text {
 	/// maps into as far as number of code points to code units (and vice-versa), you will have to use lower-level
 	/// interfaces.
 	template <typename _Encoding, typename _Range = __txt_detail::__default_char_view_t<code_unit_t<_Encoding>>,
-		typename _ErrorHandler = default_handler_t, typename _State = decode_state_t<_Encoding>>
+		typename _ErrorHandler = default_handler_t, typename _State = decode_state_t<_Encoding>,
+		::std::size_t _CacheSize = 0>
 	class decode_view {
 	private:
 		using _CVRange     = unwrap_remove_reference_t<_Range>;
@@ -80,7 +82,7 @@ namespace ztd { namespace text {
 	public:
 		//////
 		/// @brief The iterator type for this view.
-		using iterator = decode_iterator<_Encoding, _StoredRange, _ErrorHandler, _State>;
+		using iterator = decode_iterator<_Encoding, _StoredRange, _ErrorHandler, _State, _CacheSize>;
 		//////
 		/// @brief The sentinel type for this view.
 		using sentinel = decode_sentinel_t;
@@ -212,14 +214,15 @@ namespace ztd { namespace text {
 	//////
 	/// @brief The reconstruct extension point for rebuilding an encoding view from its iterator and sentinel
 	/// type.
-	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State>
-	constexpr decode_view<_Encoding, _Range, _ErrorHandler, _State> tag_invoke(ztd::tag_t<ranges::reconstruct>,
-		::std::in_place_type_t<decode_view<_Encoding, _Range, _ErrorHandler, _State>>,
-		typename decode_view<_Encoding, _Range, _ErrorHandler, _State>::iterator __it,
-		typename decode_view<_Encoding, _Range, _ErrorHandler, _State>::sentinel) noexcept(::std::
-		     is_nothrow_constructible_v<decode_view<_Encoding, _Range, _ErrorHandler, _State>,
-		          typename decode_view<_Encoding, _Range, _ErrorHandler, _State>::iterator&&>) {
-		return decode_view<_Encoding, _Range, _ErrorHandler, _State>(::std::move(__it));
+	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State, ::std::size_t _CacheSize>
+	constexpr decode_view<_Encoding, _Range, _ErrorHandler, _State, _CacheSize> tag_invoke(
+		ztd::tag_t<ranges::reconstruct>,
+		::std::in_place_type_t<decode_view<_Encoding, _Range, _ErrorHandler, _State, _CacheSize>>,
+		typename decode_view<_Encoding, _Range, _ErrorHandler, _State, _CacheSize>::iterator __it,
+		typename decode_view<_Encoding, _Range, _ErrorHandler, _State, _CacheSize>::sentinel) noexcept(::std::
+		     is_nothrow_constructible_v<decode_view<_Encoding, _Range, _ErrorHandler, _State, _CacheSize>,
+		          typename decode_view<_Encoding, _Range, _ErrorHandler, _State, _CacheSize>::iterator&&>) {
+		return decode_view<_Encoding, _Range, _ErrorHandler, _State, _CacheSize>(::std::move(__it));
 	}
 
 	//////
@@ -232,9 +235,9 @@ namespace ztd { namespace text {
 
 namespace std { namespace ranges {
 
-	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State>
-	inline constexpr bool enable_borrowed_range<::ztd::text::decode_view<_Encoding, _Range, _ErrorHandler,
-		_State>> = ::std::ranges::enable_borrowed_range<_Range>;
+	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State, ::std::size_t _CacheSize>
+	inline constexpr bool enable_borrowed_range<::ztd::text::decode_view<_Encoding, _Range, _ErrorHandler, _State,
+		_CacheSize>> = ::std::ranges::enable_borrowed_range<_Range>;
 
 }} // namespace std::ranges
 
@@ -244,9 +247,9 @@ namespace ztd { namespace ranges {
 
 	//////
 	/// @brief Mark subranges as appropriately borrowed ranges.
-	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State>
-	inline constexpr bool enable_borrowed_range<::ztd::text::decode_view<_Encoding, _Range, _ErrorHandler,
-		_State>> = ::ztd::ranges::enable_borrowed_range<_Range>;
+	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State, ::std::size_t _CacheSize>
+	inline constexpr bool enable_borrowed_range<::ztd::text::decode_view<_Encoding, _Range, _ErrorHandler, _State,
+		_CacheSize>> = ::ztd::ranges::enable_borrowed_range<_Range>;
 
 }} // namespace ztd::ranges
 
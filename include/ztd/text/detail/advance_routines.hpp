@@ -0,0 +1,122 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_ADVANCE_ROUTINES_HPP
+#define ZTD_TEXT_DETAIL_ADVANCE_ROUTINES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/count_result.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+#include <ztd/text/detail/validate_count_routines.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <cstddef>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		// Moves the input forward by at most __max_code_points code points without keeping them anywhere.
+		// Well-formed UTF over contiguous storage is skipped with the bulk counter; everything else goes one decode
+		// step at a time, and a step that would go past the limit is not taken.
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		constexpr auto __basic_advance_code_points(_Input&& __input, _Encoding& __encoding,
+			::std::size_t __max_code_points, _ErrorHandler& __error_handler, _State& __state) {
+			using _WorkingInput = ranges::range_reconstruct_t<remove_cvref_t<_Input>>;
+			using _UEncoding    = remove_cvref_t<_Encoding>;
+			using _CodePoint    = code_point_t<_UEncoding>;
+			using _Result       = count_result<_WorkingInput, _State>;
+			constexpr bool _IsUtfBulkCountable = __utf_bulk_width_v<_UEncoding> != 0 // cf
+				&& __is_contiguous_range_of_v<_WorkingInput, code_unit_t<_UEncoding>>;
+
+			_WorkingInput __working_input(
+				ranges::reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_CodePoint __intermediate_storage[max_code_points_v<_UEncoding>] {};
+			::ztd::span<_CodePoint, max_code_points_v<_UEncoding>> __intermediate(__intermediate_storage);
+			::std::size_t __code_point_count = 0;
+			::std::size_t __handled_errors   = 0;
+			for (;;) {
+				if constexpr (_IsUtfBulkCountable) {
+					::std::size_t __read_count = 0;
+					__code_point_count += __utf_bulk_count_until<__utf_bulk_width_v<_UEncoding>, 4>(
+						ranges::ranges_adl::adl_data(__working_input),
+						ranges::ranges_adl::adl_size(__working_input), __max_code_points - __code_point_count,
+						__read_count);
+					__working_input = ranges::reconstruct(::std::in_place_type<_WorkingInput>,
+						ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+						ranges::ranges_adl::adl_end(__working_input));
+				}
+				if (__code_point_count == __max_code_points) {
+					break;
+				}
+				if (ranges::ranges_adl::adl_empty(__working_input) && text::is_state_complete(__state)) {
+					break;
+				}
+				auto __result = __basic_count_as_decoded_one(
+					__working_input, __encoding, __error_handler, __state, __intermediate);
+				if (__result.error_code != encoding_error::ok) {
+					return _Result(::std::move(__result.input), __code_point_count, __state, __result.error_code,
+						__handled_errors + __result.handled_errors);
+				}
+				if (__max_code_points - __code_point_count < __result.count) {
+					// this step decodes to more code points than are left: stop in front of it
+					break;
+				}
+				__code_point_count += __result.count;
+				__handled_errors += __result.handled_errors;
+				__working_input = ::std::move(__result.input);
+			}
+			return _Result(
+				::std::move(__working_input), __code_point_count, __state, encoding_error::ok, __handled_errors);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_DETAIL_ADVANCE_ROUTINES_HPP
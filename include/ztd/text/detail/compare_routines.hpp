@@ -0,0 +1,432 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_COMPARE_ROUTINES_HPP
+#define ZTD_TEXT_DETAIL_COMPARE_ROUTINES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/ascii.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/is_transcoding_compatible.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		// Whether equal text in the two encodings is always made of equal code units, so that equality can be
+		// checked on the code units alone.
+		template <typename _LeftEncoding, typename _RightEncoding>
+		inline constexpr bool __is_code_unit_comparable_v
+			= (__is_bitwise_transcoding_compatible_v<_LeftEncoding, _RightEncoding>         // cf
+			       || __is_bitwise_transcoding_compatible_v<_RightEncoding, _LeftEncoding>) // cf
+			&& sizeof(code_unit_t<_LeftEncoding>) == sizeof(code_unit_t<_RightEncoding>);
+
+		// The width (1, 2, or 4) of an encoding whose code units, looked at as unsigned values, sort in code point
+		// order (after the UTF-16 fix-up in __code_unit_order_key), or 0 if they do not.
+		template <typename _Encoding>
+		inline constexpr ::std::size_t __code_unit_order_width_v
+			= is_specialization_of_v<_Encoding, basic_ascii> && sizeof(code_unit_t<_Encoding>) == 1
+			? 1
+			: __utf_bulk_width_v<_Encoding>;
+
+		template <typename _CodeUnit>
+		constexpr auto __code_unit_bits(_CodeUnit __code_unit) noexcept {
+			return static_cast<::std::make_unsigned_t<_CodeUnit>>(__code_unit);
+		}
+
+		// How many of the code units, from the start, are well-formed, for an encoding with a nonzero
+		// __code_unit_order_width_v. Only well-formed text sorts (and compares equal) by its code units.
+		template <typename _Encoding, typename _CodeUnit>
+		constexpr ::std::size_t __well_formed_prefix_size(const _CodeUnit* __first, ::std::size_t __size) noexcept {
+			if constexpr (is_specialization_of_v<_Encoding, basic_ascii>) {
+				for (::std::size_t __index = 0; __index < __size; ++__index) {
+					if (static_cast<unsigned char>(__first[__index]) >= 0x80) {
+						return __index;
+					}
+				}
+				return __size;
+			}
+			else {
+				constexpr ::std::size_t _Width = __utf_bulk_width_v<_Encoding>;
+				::std::size_t __read_count     = 0;
+				(void)__utf_bulk_count<_Width, _Width>(__first, __size, __read_count);
+				return __read_count;
+			}
+		}
+
+		// Turns a code unit into a value that sorts in code point order. For UTF-16, surrogates (which only ever
+		// start code points above U+FFFF) are moved above U+E000-U+FFFF.
+		template <::std::size_t _Width, typename _CodeUnit>
+		constexpr char32_t __code_unit_order_key(_CodeUnit __code_unit) noexcept {
+			const char32_t __value = static_cast<char32_t>(__code_unit_bits(__code_unit));
+			if constexpr (_Width == 2) {
+				if (__value >= 0xE000) {
+					return __value - 0x800;
+				}
+				if (__value >= 0xD800) {
+					return __value + 0x2000;
+				}
+			}
+			return __value;
+		}
+
+		template <typename _LeftCodeUnit, typename _RightCodeUnit>
+		constexpr bool __code_units_equal(const _LeftCodeUnit* __left, ::std::size_t __left_size,
+			const _RightCodeUnit* __right, ::std::size_t __right_size) noexcept {
+			static_assert(sizeof(_LeftCodeUnit) == sizeof(_RightCodeUnit),
+				"code units can only be compared bit for bit if they are the same size");
+			if (__left_size != __right_size) {
+				return false;
+			}
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+			if (::std::is_constant_evaluated()) {
+				for (::std::size_t __index = 0; __index < __left_size; ++__index) {
+					if (__code_unit_bits(__left[__index]) != __code_unit_bits(__right[__index])) {
+						return false;
+					}
+				}
+				return true;
+			}
+#endif
+			return __left_size == 0 || ::std::memcmp(__left, __right, __left_size * sizeof(_LeftCodeUnit)) == 0;
+		}
+
+		template <::std::size_t _Width, typename _LeftCodeUnit, typename _RightCodeUnit>
+		constexpr int __code_units_compare(const _LeftCodeUnit* __left, ::std::size_t __left_size,
+			const _RightCodeUnit* __right, ::std::size_t __right_size) noexcept {
+			const ::std::size_t __common_size = __left_size < __right_size ? __left_size : __right_size;
+			::std::size_t __index             = 0;
+			if constexpr (_Width == 1) {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+				if (!::std::is_constant_evaluated())
+#endif
+				{
+					// memcmp compares unsigned bytes, which is exactly code point order for UTF-8
+					const int __result = __common_size == 0 ? 0 : ::std::memcmp(__left, __right, __common_size);
+					if (__result != 0) {
+						return __result < 0 ? -1 : 1;
+					}
+					__index = __common_size;
+				}
+			}
+			for (; __index < __common_size; ++__index) {
+				if (__code_unit_bits(__left[__index]) != __code_unit_bits(__right[__index])) {
+					return __code_unit_order_key<_Width>(__left[__index])
+						     < __code_unit_order_key<_Width>(__right[__index])
+						? -1
+						: 1;
+				}
+			}
+			return __left_size == __right_size ? 0 : (__left_size < __right_size ? -1 : 1);
+		}
+
+		// Gives decoding errors to the text's own error handler first. Whatever it does not recover from (without
+		// throwing) is replaced as ztd::text::replacement_handler_t would, so that broken text is still read to the
+		// end and sorts the same way whichever side of a comparison it is on.
+		template <typename _ErrorHandler>
+		class __replacing_handler {
+		public:
+			constexpr __replacing_handler(_ErrorHandler& __error_handler) noexcept
+			: _M_error_handler(__error_handler) {
+			}
+
+			template <typename _Encoding, typename _Result, typename _InputProgress, typename _OutputProgress>
+			constexpr auto operator()(const _Encoding& __encoding, _Result&& __result,
+				const _InputProgress& __input_progress, const _OutputProgress& __output_progress) const {
+				auto __handled_result = this->_M_error_handler(
+					__encoding, ::std::forward<_Result>(__result), __input_progress, __output_progress);
+				if (__handled_result.error_code == encoding_error::ok) {
+					return __handled_result;
+				}
+				return replacement_handler_t {}(
+					__encoding, ::std::move(__handled_result), __input_progress, __output_progress);
+			}
+
+		private:
+			_ErrorHandler& _M_error_handler;
+		};
+
+		// Decodes text a block of code points at a time. Well-formed UTF over contiguous storage is decoded with
+		// the bulk converter; everything else (and whatever the bulk converter stops at) goes through decode_one,
+		// with errors the text's error handler cannot recover from replaced by U+FFFD.
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		class __code_point_block_reader {
+		private:
+			using _WorkingInput = ranges::range_reconstruct_t<remove_cvref_t<_Input>>;
+			using _UEncoding    = remove_cvref_t<_Encoding>;
+			using _CodePoint    = code_point_t<_UEncoding>;
+
+			static constexpr ::std::size_t _UtfWidth  = __utf_bulk_width_v<_UEncoding>;
+			static constexpr bool _IsUtfBulkDecodable = _UtfWidth != 0 // cf
+				&& __is_contiguous_range_of_v<_WorkingInput, code_unit_t<_UEncoding>>;
+			static constexpr ::std::size_t _BlockSize = max_code_points_v<_UEncoding> < 64
+				? 64
+				: max_code_points_v<_UEncoding>;
+
+		public:
+			constexpr __code_point_block_reader(
+				_Input&& __input, const _Encoding& __encoding, _ErrorHandler& __error_handler, _State& __state)
+			: _M_input(ranges::reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)))
+			, _M_encoding(__encoding)
+			, _M_error_handler(__error_handler)
+			, _M_state(__state)
+			, _M_block()
+			, _M_position(0)
+			, _M_size(0)
+			, _M_stopped(false) {
+			}
+
+			// The code points decoded but not looked at yet. Empty only once the text is done.
+			constexpr ::ztd::span<const _CodePoint> _M_available() {
+				if (this->_M_position == this->_M_size) {
+					this->_M_refill();
+				}
+				return ::ztd::span<const _CodePoint>(
+					this->_M_block + this->_M_position, this->_M_size - this->_M_position);
+			}
+
+			constexpr void _M_consume(::std::size_t __count) noexcept {
+				this->_M_position += __count;
+			}
+
+		private:
+			constexpr void _M_refill() {
+				this->_M_position = 0;
+				this->_M_size     = 0;
+				if (this->_M_stopped) {
+					return;
+				}
+				if constexpr (_IsUtfBulkDecodable) {
+					::std::size_t __read_count    = 0;
+					::std::size_t __written_count = 0;
+					__utf_bulk_convert<_UtfWidth, 4>(ranges::ranges_adl::adl_data(this->_M_input),
+						ranges::ranges_adl::adl_size(this->_M_input), __read_count, this->_M_block,
+						_BlockSize, __written_count);
+					this->_M_input = ranges::reconstruct(::std::in_place_type<_WorkingInput>,
+						ranges::ranges_adl::adl_begin(this->_M_input) + __read_count,
+						ranges::ranges_adl::adl_end(this->_M_input));
+					this->_M_size  = __written_count;
+					if (this->_M_size != 0) {
+						return;
+					}
+				}
+				while (_BlockSize - this->_M_size >= max_code_points_v<_UEncoding>) {
+					if (ranges::ranges_adl::adl_empty(this->_M_input) && text::is_state_complete(this->_M_state)) {
+						break;
+					}
+					::ztd::span<_CodePoint> __output(
+						this->_M_block + this->_M_size, _BlockSize - this->_M_size);
+					auto __result = this->_M_encoding.decode_one(::std::move(this->_M_input), __output,
+						__replacing_handler<_ErrorHandler>(this->_M_error_handler), this->_M_state);
+					this->_M_input = ::std::move(__result.input);
+					if (__result.error_code != encoding_error::ok) {
+						// not even a replacement fit: there is no way to carry on reading
+						this->_M_stopped = true;
+						break;
+					}
+					this->_M_size = static_cast<::std::size_t>(__result.output.data() - this->_M_block);
+					if constexpr (_IsUtfBulkDecodable) {
+						// one bad sequence is out of the way: let the fast loop take over again
+						break;
+					}
+				}
+			}
+
+			_WorkingInput _M_input;
+			const _Encoding& _M_encoding;
+			_ErrorHandler& _M_error_handler;
+			_State& _M_state;
+			_CodePoint _M_block[_BlockSize];
+			::std::size_t _M_position;
+			::std::size_t _M_size;
+			bool _M_stopped;
+		};
+
+		template <typename _LeftReader, typename _RightReader>
+		constexpr int __code_point_blocks_compare(_LeftReader& __left, _RightReader& __right) {
+			for (;;) {
+				auto __left_code_points  = __left._M_available();
+				auto __right_code_points = __right._M_available();
+				if (__left_code_points.empty() || __right_code_points.empty()) {
+					return __left_code_points.empty() == __right_code_points.empty()
+						? 0
+						: (__left_code_points.empty() ? -1 : 1);
+				}
+				const ::std::size_t __common_size = __left_code_points.size() < __right_code_points.size()
+					? __left_code_points.size()
+					: __right_code_points.size();
+				for (::std::size_t __index = 0; __index < __common_size; ++__index) {
+					const char32_t __left_code_point  = static_cast<char32_t>(__left_code_points[__index]);
+					const char32_t __right_code_point = static_cast<char32_t>(__right_code_points[__index]);
+					if (__left_code_point != __right_code_point) {
+						return __left_code_point < __right_code_point ? -1 : 1;
+					}
+				}
+				__left._M_consume(__common_size);
+				__right._M_consume(__common_size);
+			}
+		}
+
+		template <typename _LeftInput, typename _LeftEncoding, typename _LeftErrorHandler, typename _LeftState,
+			typename _RightInput, typename _RightEncoding, typename _RightErrorHandler, typename _RightState>
+		constexpr int __decoded_text_compare(_LeftInput&& __left, const _LeftEncoding& __left_encoding,
+			_LeftErrorHandler& __left_error_handler, _LeftState& __left_state, _RightInput&& __right,
+			const _RightEncoding& __right_encoding, _RightErrorHandler& __right_error_handler,
+			_RightState& __right_state) {
+			__code_point_block_reader<_LeftInput, _LeftEncoding, _LeftErrorHandler, _LeftState> __left_reader(
+				::std::forward<_LeftInput>(__left), __left_encoding, __left_error_handler, __left_state);
+			__code_point_block_reader<_RightInput, _RightEncoding, _RightErrorHandler, _RightState> __right_reader(
+				::std::forward<_RightInput>(__right), __right_encoding, __right_error_handler, __right_state);
+			return __code_point_blocks_compare(__left_reader, __right_reader);
+		}
+
+		// Whether both pieces of text can be compared on their code units: the same normalization form, the same
+		// (or a bitwise-compatible) encoding whose code units sort in code point order, and contiguous storage.
+		template <bool _SameNormalization, typename _LeftInput, typename _LeftEncoding, typename _RightInput,
+			typename _RightEncoding>
+		inline constexpr bool __is_code_unit_text_comparable_v = _SameNormalization                   // cf
+			&& __is_code_unit_comparable_v<_LeftEncoding, _RightEncoding>                            // cf
+			&& __code_unit_order_width_v<_LeftEncoding> != 0                                         // cf
+			&& __code_unit_order_width_v<_LeftEncoding> == __code_unit_order_width_v<_RightEncoding> // cf
+			&& __is_contiguous_range_of_v<_LeftInput, code_unit_t<_LeftEncoding>>                    // cf
+			&& __is_contiguous_range_of_v<_RightInput, code_unit_t<_RightEncoding>>;
+
+		// Three-way comparison of two pieces of text, in code point order: negative, zero, or positive. Text in
+		// the same normalization form and the same (or a bitwise-compatible) encoding is compared on its code units
+		// directly when they sort in code point order, up to the first ill-formed code unit on either side; from
+		// there on (and for everything else) it is decoded, both sides a block at a time, so that broken text is
+		// replaced the same way whichever path it takes.
+		template <bool _SameNormalization, typename _LeftInput, typename _LeftEncoding, typename _LeftErrorHandler,
+			typename _LeftState, typename _RightInput, typename _RightEncoding, typename _RightErrorHandler,
+			typename _RightState>
+		constexpr int __text_compare(_LeftInput&& __left, const _LeftEncoding& __left_encoding,
+			_LeftErrorHandler& __left_error_handler, _LeftState& __left_state, _RightInput&& __right,
+			const _RightEncoding& __right_encoding, _RightErrorHandler& __right_error_handler,
+			_RightState& __right_state) {
+			using _ULeftEncoding  = remove_cvref_t<_LeftEncoding>;
+			using _URightEncoding = remove_cvref_t<_RightEncoding>;
+			if constexpr (__is_code_unit_text_comparable_v<_SameNormalization, _LeftInput, _ULeftEncoding,
+				              _RightInput, _URightEncoding>) {
+				constexpr ::std::size_t _OrderWidth = __code_unit_order_width_v<_ULeftEncoding>;
+				using _LeftRest                     = ::ztd::span<const code_unit_t<_ULeftEncoding>>;
+				using _RightRest                    = ::ztd::span<const code_unit_t<_URightEncoding>>;
+				const auto* __left_first            = ranges::ranges_adl::adl_data(__left);
+				const auto* __right_first           = ranges::ranges_adl::adl_data(__right);
+				const ::std::size_t __left_size     = ranges::ranges_adl::adl_size(__left);
+				const ::std::size_t __right_size    = ranges::ranges_adl::adl_size(__right);
+				const ::std::size_t __left_valid_size
+					= __well_formed_prefix_size<_ULeftEncoding>(__left_first, __left_size);
+				const ::std::size_t __right_valid_size
+					= __well_formed_prefix_size<_URightEncoding>(__right_first, __right_size);
+				if (__left_valid_size == __left_size && __right_valid_size == __right_size) {
+					return __code_units_compare<_OrderWidth>(
+						__left_first, __left_size, __right_first, __right_size);
+				}
+				// identical well-formed code units end on the same code point boundary, so the rest can be
+				// decoded from there
+				const ::std::size_t __common_size
+					= __left_valid_size < __right_valid_size ? __left_valid_size : __right_valid_size;
+				const int __prefix_result
+					= __code_units_compare<_OrderWidth>(__left_first, __common_size, __right_first, __common_size);
+				if (__prefix_result != 0) {
+					return __prefix_result;
+				}
+				return __txt_detail::__decoded_text_compare(
+					_LeftRest(__left_first + __common_size, __left_size - __common_size), __left_encoding,
+					__left_error_handler, __left_state,
+					_RightRest(__right_first + __common_size, __right_size - __common_size), __right_encoding,
+					__right_error_handler, __right_state);
+			}
+			else {
+				return __txt_detail::__decoded_text_compare(::std::forward<_LeftInput>(__left), __left_encoding,
+					__left_error_handler, __left_state, ::std::forward<_RightInput>(__right), __right_encoding,
+					__right_error_handler, __right_state);
+			}
+		}
+
+		// Equality of two pieces of text. Well-formed text in the same normalization form and the same (or a
+		// bitwise-compatible) encoding is equal exactly when its code units are; everything else goes through
+		// __text_compare, so that equality always agrees with the ordering.
+		template <bool _SameNormalization, typename _LeftInput, typename _LeftEncoding, typename _LeftErrorHandler,
+			typename _LeftState, typename _RightInput, typename _RightEncoding, typename _RightErrorHandler,
+			typename _RightState>
+		constexpr bool __text_equal(_LeftInput&& __left, const _LeftEncoding& __left_encoding,
+			_LeftErrorHandler& __left_error_handler, _LeftState& __left_state, _RightInput&& __right,
+			const _RightEncoding& __right_encoding, _RightErrorHandler& __right_error_handler,
+			_RightState& __right_state) {
+			using _ULeftEncoding  = remove_cvref_t<_LeftEncoding>;
+			using _URightEncoding = remove_cvref_t<_RightEncoding>;
+			if constexpr (__is_code_unit_text_comparable_v<_SameNormalization, _LeftInput, _ULeftEncoding,
+				              _RightInput, _URightEncoding>) {
+				const auto* __left_first         = ranges::ranges_adl::adl_data(__left);
+				const auto* __right_first        = ranges::ranges_adl::adl_data(__right);
+				const ::std::size_t __left_size  = ranges::ranges_adl::adl_size(__left);
+				const ::std::size_t __right_size = ranges::ranges_adl::adl_size(__right);
+				if (__well_formed_prefix_size<_ULeftEncoding>(__left_first, __left_size) == __left_size // cf
+					&& __well_formed_prefix_size<_URightEncoding>(__right_first, __right_size) == __right_size) {
+					return __code_units_equal(__left_first, __left_size, __right_first, __right_size);
+				}
+			}
+			const int __result = __txt_detail::__text_compare<_SameNormalization>(
+				::std::forward<_LeftInput>(__left), __left_encoding, __left_error_handler, __left_state,
+				::std::forward<_RightInput>(__right), __right_encoding, __right_error_handler, __right_state);
+			return __result == 0;
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_DETAIL_COMPARE_ROUTINES_HPP
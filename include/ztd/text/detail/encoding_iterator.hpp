@@ -43,6 +43,7 @@
 #include <ztd/text/detail/encoding_iterator_storage.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/transcode_routines.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
 
 #include <ztd/idk/unwrap.hpp>
 #include <ztd/idk/ebco.hpp>
@@ -67,13 +68,15 @@ namespace ztd { namespace text {
 
 		using __encoding_sentinel_t = ranges::default_sentinel_t;
 
-		template <__transaction _EncodeOrDecode, typename _Derived, typename _Storage>
+		template <__transaction _EncodeOrDecode, typename _Derived, typename _Storage, ::std::size_t _CacheSize = 0>
 		class __encoding_iterator
 		: private _Storage,
 		  private __cursor_cache<
-			  (_EncodeOrDecode == __transaction::__decode
-			            ? max_code_points_v<remove_cvref_t<unwrap_t<typename _Storage::encoding_type>>>
-			            : max_code_units_v<remove_cvref_t<unwrap_t<typename _Storage::encoding_type>>>),
+			  __iterator_cache_size_v<
+			       (_EncodeOrDecode == __transaction::__decode
+			                 ? max_code_points_v<remove_cvref_t<unwrap_t<typename _Storage::encoding_type>>>
+			                 : max_code_units_v<remove_cvref_t<unwrap_t<typename _Storage::encoding_type>>>),
+			       _CacheSize>,
 			  ranges::is_range_input_or_output_range_v<remove_cvref_t<unwrap_t<typename _Storage::range_type>>>>,
 		  private __error_cache<(_EncodeOrDecode == __transaction::__decode
 			       ? decode_error_handler_always_returns_ok_v<
@@ -95,16 +98,23 @@ namespace ztd { namespace text {
 			inline static constexpr ::std::size_t _MaxValues
 				= (_EncodeOrDecode == __transaction::__decode ? max_code_points_v<unwrap_remove_cvref_t<_Encoding>>
 				                                              : max_code_units_v<unwrap_remove_cvref_t<_Encoding>>);
-			inline static constexpr bool _IsSingleValueType = _MaxValues == 1;
-			inline static constexpr bool _IsInputOrOutput   = ranges::is_range_input_or_output_range_v<_URange>;
-			inline static constexpr bool _IsCursorless      = _IsSingleValueType && !_IsInputOrOutput;
-			inline static constexpr bool _IsErrorless       = _EncodeOrDecode == __transaction::__decode
-				      ? decode_error_handler_always_returns_ok_v<_UEncoding, _UErrorHandler>
-				      : encode_error_handler_always_returns_ok_v<_UEncoding, _UErrorHandler>;
-			using __base_cursor_cache_t                     = __cursor_cache<_MaxValues, _IsInputOrOutput>;
-			using __base_cursor_cache_size_t                = typename __base_cursor_cache_t::_SizeType;
-			using __base_error_cache_t                      = __error_cache<_IsErrorless>;
-			using __base_storage_t                          = _Storage;
+			inline static constexpr ::std::size_t _CacheValues = __iterator_cache_size_v<_MaxValues, _CacheSize>;
+			inline static constexpr bool _IsSingleValueType    = _CacheValues == 1;
+			inline static constexpr bool _IsInputOrOutput      = ranges::is_range_input_or_output_range_v<_URange>;
+			inline static constexpr bool _IsCursorless         = _IsSingleValueType && !_IsInputOrOutput;
+			inline static constexpr bool _IsErrorless          = _EncodeOrDecode == __transaction::__decode
+				         ? decode_error_handler_always_returns_ok_v<_UEncoding, _UErrorHandler>
+				         : encode_error_handler_always_returns_ok_v<_UEncoding, _UErrorHandler>;
+			using __base_cursor_cache_t                        = __cursor_cache<_CacheValues, _IsInputOrOutput>;
+			using __base_cursor_cache_size_t                   = typename __base_cursor_cache_t::_SizeType;
+			using __base_error_cache_t                         = __error_cache<_IsErrorless>;
+			using __base_storage_t                             = _Storage;
+
+			// reading ahead is only done when no error can ever be reported, so error_code() stays exact
+			inline static constexpr bool _IsBatched = _CacheValues > _MaxValues && _IsErrorless && !_IsInputOrOutput;
+			inline static constexpr bool _IsUtfBulkDecodable = _EncodeOrDecode == __transaction::__decode // cf
+				&& __utf_bulk_width_v<_UEncoding> != 0                                                   // cf
+				&& __is_contiguous_range_of_v<_URange, code_unit_t<_UEncoding>>;
 
 			inline static constexpr bool _IsBackwards = _EncodeOrDecode == __transaction::__encode
 				? is_detected_v<__detect_object_encode_one_backwards, _UEncoding, _URange, _UErrorHandler, _UState>
@@ -433,6 +443,10 @@ namespace ztd { namespace text {
 					}
 					return;
 				}
+				if constexpr (_IsBatched) {
+					this->_M_read_many();
+					return;
+				}
 				auto& __this_input_range = this->_M_range();
 				auto __this_cache_begin  = this->_M_cache.data();
 				[[maybe_unused]] decltype(__this_cache_begin) __this_cache_end {};
@@ -467,6 +481,40 @@ namespace ztd { namespace text {
 				}
 			}
 
+			constexpr void _M_read_many() {
+				value_type* __cache_first = this->_M_cache.data();
+				::std::size_t __written   = 0;
+				for (;;) {
+					if constexpr (_IsUtfBulkDecodable) {
+						// well-formed input goes straight into the cache: decode_one only sees what this stops at
+						auto& __this_input_range      = this->_M_range();
+						::std::size_t __read_count    = 0;
+						::std::size_t __written_count = 0;
+						__utf_bulk_convert<__utf_bulk_width_v<_UEncoding>, 4>(
+							ranges::ranges_adl::adl_data(__this_input_range),
+							ranges::ranges_adl::adl_size(__this_input_range), __read_count,
+							__cache_first + __written, _CacheValues - __written, __written_count);
+						this->__base_storage_t::_M_get_range()
+							= ranges::reconstruct(::std::in_place_type<_URange>,
+							     ranges::ranges_adl::adl_begin(__this_input_range) + __read_count,
+							     ranges::ranges_adl::adl_end(__this_input_range));
+						__written += __written_count;
+					}
+					if (_CacheValues - __written < _MaxValues || this->_M_base_is_empty()) {
+						break;
+					}
+					::ztd::span<value_type, _MaxValues> __cache_view(__cache_first + __written, _MaxValues);
+					auto __result = __basic_encode_or_decode_one<__consume::__no, _EncodeOrDecode>(
+						::std::move(this->_M_range()), this->encoding(), __cache_view, this->error_handler(),
+						this->state());
+					__written = static_cast<::std::size_t>(
+						::ztd::to_address(ranges::ranges_adl::adl_begin(__result.output)) - __cache_first);
+					this->__base_storage_t::_M_get_range() = ::std::move(__result.input);
+				}
+				this->__base_cursor_cache_t::_M_position = static_cast<__base_cursor_cache_size_t>(0);
+				this->__base_cursor_cache_t::_M_size     = static_cast<__base_cursor_cache_size_t>(__written);
+			}
+
 			constexpr _Derived& _M_derived() noexcept {
 				return static_cast<_Derived&>(*this);
 			}
@@ -483,7 +531,7 @@ namespace ztd { namespace text {
 				return this->__base_storage_t::_M_get_range();
 			}
 
-			::std::array<value_type, _MaxValues> _M_cache;
+			::std::array<value_type, _CacheValues> _M_cache;
 		};
 
 	} // namespace __txt_detail
@@ -55,6 +55,10 @@ namespace ztd { namespace text {
 
 		inline constexpr ::std::size_t _CursorlessSizeSentinel = 1;
 
+		// the cache must always be able to hold the output of at least one full encode/decode step
+		template <::std::size_t _MaxValues, ::std::size_t _CacheSize>
+		inline constexpr ::std::size_t __iterator_cache_size_v = _CacheSize > _MaxValues ? _CacheSize : _MaxValues;
+
 		template <typename _Encoding, typename _EncodingState, ::std::size_t _Id = 0>
 		class __state_storage : private ebco<unwrap_remove_cvref_t<_EncodingState>, _Id> {
 		private:
@@ -44,6 +44,7 @@
 #include <ztd/idk/tag.hpp>
 #include <ztd/ranges/adl.hpp>
 #include <ztd/ranges/iterator.hpp>
+#include <ztd/ranges/range.hpp>
 
 #include <utility>
 
@@ -198,6 +199,22 @@ namespace ztd { namespace text {
 			::std::declval<_ToHandler>(), ::std::declval<_FromState&>(), ::std::declval<_ToState&>(),
 			::std::declval<pivot<_PivotRange>&>()));
 
+		// validation and counting: transcode
+		template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromState,
+			typename _ToState, typename _PivotRange>
+		using __detect_adl_text_validate_and_count_as_transcoded = decltype(text_validate_and_count_as_transcoded(
+			::ztd::tag<remove_cvref_t<_FromEncoding>, remove_cvref_t<_ToEncoding>> {}, ::std::declval<_Input>(),
+			::std::declval<_FromEncoding>(), ::std::declval<_ToEncoding>(), ::std::declval<_FromState&>(),
+			::std::declval<_ToState&>(), ::std::declval<pivot<_PivotRange>&>()));
+
+		template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromState,
+			typename _ToState, typename _PivotRange>
+		using __detect_adl_internal_text_validate_and_count_as_transcoded
+			= decltype(__text_validate_and_count_as_transcoded(
+			     ::ztd::tag<remove_cvref_t<_FromEncoding>, remove_cvref_t<_ToEncoding>> {}, ::std::declval<_Input>(),
+			     ::std::declval<_FromEncoding>(), ::std::declval<_ToEncoding>(), ::std::declval<_FromState&>(),
+			     ::std::declval<_ToState&>(), ::std::declval<pivot<_PivotRange>&>()));
+
 
 		// decode
 		template <typename _Encoding, typename _Input, typename _Output, typename _Handler, typename _State>
@@ -326,6 +343,11 @@ namespace ztd { namespace text {
 		inline constexpr bool __is_decode_range_category_contiguous_v
 			= ::std::is_base_of_v<__decode_range_category_t<_Encoding>, ::ztd::contiguous_iterator_tag>;
 
+		template <typename _Range, typename _Element>
+		inline constexpr bool __is_contiguous_range_of_v
+			= ranges::is_range_contiguous_range_v<remove_cvref_t<_Range>>
+			&& ::std::is_same_v<remove_cv_t<ranges::range_value_type_t<remove_cvref_t<_Range>>>, _Element>;
+
 	} // namespace __txt_detail
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
 }} // namespace ztd::text
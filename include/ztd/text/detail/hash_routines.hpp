@@ -0,0 +1,219 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_HASH_ROUTINES_HPP
+#define ZTD_TEXT_DETAIL_HASH_ROUTINES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/detail/compare_routines.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		// A 64-bit hash over a stream of bytes, taken 8 bytes at a time (the MurmurHash3 mixing steps). The result
+		// only depends on the bytes, not on how they were split up between calls to _M_update.
+		class __byte_stream_hash {
+		private:
+			static constexpr ::std::uint_least64_t _S_c1 = 0x87C37B91114253D5ull;
+			static constexpr ::std::uint_least64_t _S_c2 = 0x4CF5AD432745937Full;
+
+			static constexpr ::std::uint_least64_t _S_rotate_left(
+				::std::uint_least64_t __value, int __shift) noexcept {
+				return ((__value << __shift) | (__value >> (64 - __shift))) & 0xFFFFFFFFFFFFFFFFull;
+			}
+
+			static constexpr ::std::uint_least64_t _S_scramble(::std::uint_least64_t __word) noexcept {
+				__word = (__word * _S_c1) & 0xFFFFFFFFFFFFFFFFull;
+				__word = _S_rotate_left(__word, 31);
+				return (__word * _S_c2) & 0xFFFFFFFFFFFFFFFFull;
+			}
+
+			constexpr void _M_mix(::std::uint_least64_t __word) noexcept {
+				this->_M_hash ^= _S_scramble(__word);
+				this->_M_hash = _S_rotate_left(this->_M_hash, 27);
+				this->_M_hash = (this->_M_hash * 5 + 0x52DCE729) & 0xFFFFFFFFFFFFFFFFull;
+			}
+
+			template <typename _Byte>
+			static constexpr ::std::uint_least64_t _S_byte(_Byte __byte) noexcept {
+				return static_cast<::std::uint_least64_t>(static_cast<unsigned char>(__byte));
+			}
+
+		public:
+			constexpr __byte_stream_hash() noexcept
+			: _M_hash(0), _M_pending(0), _M_pending_size(0), _M_length(0) {
+			}
+
+			template <typename _Byte>
+			constexpr void _M_update(const _Byte* __bytes, ::std::size_t __size) noexcept {
+				::std::size_t __index = 0;
+				// top up the word a previous call left unfinished
+				for (; this->_M_pending_size != 0 && __index < __size; ++__index) {
+					this->_M_pending |= _S_byte(__bytes[__index]) << (this->_M_pending_size * 8);
+					++this->_M_pending_size;
+					if (this->_M_pending_size == 8) {
+						this->_M_mix(this->_M_pending);
+						this->_M_pending      = 0;
+						this->_M_pending_size = 0;
+					}
+				}
+				for (; __size - __index >= 8; __index += 8) {
+					::std::uint_least64_t __word = 0;
+					for (::std::size_t __byte_index = 0; __byte_index < 8; ++__byte_index) {
+						__word |= _S_byte(__bytes[__index + __byte_index]) << (__byte_index * 8);
+					}
+					this->_M_mix(__word);
+				}
+				for (; __index < __size; ++__index) {
+					this->_M_pending |= _S_byte(__bytes[__index]) << (this->_M_pending_size * 8);
+					++this->_M_pending_size;
+				}
+				this->_M_length += __size;
+			}
+
+			constexpr ::std::size_t _M_finish() const noexcept {
+				::std::uint_least64_t __hash = this->_M_hash;
+				if (this->_M_pending_size != 0) {
+					__hash ^= _S_scramble(this->_M_pending);
+				}
+				__hash ^= static_cast<::std::uint_least64_t>(this->_M_length);
+				// the MurmurHash3 finalizer, so every input bit reaches every output bit
+				__hash ^= __hash >> 33;
+				__hash = (__hash * 0xFF51AFD7ED558CCDull) & 0xFFFFFFFFFFFFFFFFull;
+				__hash ^= __hash >> 33;
+				__hash = (__hash * 0xC4CEB9FE1A85EC53ull) & 0xFFFFFFFFFFFFFFFFull;
+				__hash ^= __hash >> 33;
+				return static_cast<::std::size_t>(__hash);
+			}
+
+		private:
+			::std::uint_least64_t _M_hash;
+			::std::uint_least64_t _M_pending;
+			::std::size_t _M_pending_size;
+			::std::uint_least64_t _M_length;
+		};
+
+		// Hashes text as the UTF-8 encoding of its code points, so the same code points hash the same whatever
+		// encoding they are stored in. Well-formed UTF-8 (and ASCII) over contiguous storage is already that byte
+		// stream and is hashed as is, a run at a time; each ill-formed sequence between the runs goes through
+		// decode_one with __replacing_handler, exactly as __code_point_block_reader would, and is hashed as the
+		// UTF-8 of whatever replaces it (normally U+FFFD, EF BF BD). Everything else is decoded a block at a time
+		// and re-encoded as UTF-8 on the way into the hash. Either way, text that compares equal hashes the same.
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		constexpr ::std::size_t __text_hash(
+			_Input&& __input, const _Encoding& __encoding, _ErrorHandler& __error_handler, _State& __state) {
+			using _UEncoding = remove_cvref_t<_Encoding>;
+			__byte_stream_hash __hash {};
+			if constexpr (__code_unit_order_width_v<_UEncoding> == 1 // cf
+				&& __is_contiguous_range_of_v<_Input, code_unit_t<_UEncoding>>) {
+				using _CodePoint                       = code_point_t<_UEncoding>;
+				using _Rest                            = ::ztd::span<const code_unit_t<_UEncoding>>;
+				constexpr ::std::size_t _MaxCodePoints = max_code_points_v<_UEncoding>;
+				_Rest __rest(ranges::ranges_adl::adl_data(__input), ranges::ranges_adl::adl_size(__input));
+				for (;;) {
+					const ::std::size_t __valid_size
+						= __well_formed_prefix_size<_UEncoding>(__rest.data(), __rest.size());
+					__hash._M_update(__rest.data(), __valid_size);
+					__rest = _Rest(__rest.data() + __valid_size, __rest.size() - __valid_size);
+					if (__rest.empty()) {
+						break;
+					}
+					_CodePoint __code_points[_MaxCodePoints] {};
+					auto __result = __encoding.decode_one(__rest, ::ztd::span<_CodePoint>(__code_points),
+						__replacing_handler<_ErrorHandler>(__error_handler), __state);
+					if (__result.error_code != encoding_error::ok) {
+						// not even a replacement fit: the block reader stops reading here too
+						break;
+					}
+					unsigned char __utf8_code_units[_MaxCodePoints * 4] {};
+					::std::size_t __utf8_size = 0;
+					for (const _CodePoint* __code_point = __code_points; __code_point != __result.output.data();
+						++__code_point) {
+						__utf8_size += __utf_bulk_write<1>(static_cast<char32_t>(*__code_point),
+							__utf8_code_units + __utf8_size, sizeof(__utf8_code_units) - __utf8_size);
+					}
+					__hash._M_update(__utf8_code_units, __utf8_size);
+					__rest = _Rest(__result.input.data(), __result.input.size());
+				}
+			}
+			else {
+				constexpr ::std::size_t __utf8_block_size = 256;
+				__code_point_block_reader<_Input, _Encoding, _ErrorHandler, _State> __reader(
+					::std::forward<_Input>(__input), __encoding, __error_handler, __state);
+				unsigned char __utf8_block[__utf8_block_size] {};
+				::std::size_t __utf8_size = 0;
+				for (;;) {
+					auto __code_points = __reader._M_available();
+					if (__code_points.empty()) {
+						break;
+					}
+					for (const auto& __code_point : __code_points) {
+						if (__utf8_block_size - __utf8_size < 4) {
+							__hash._M_update(__utf8_block, __utf8_size);
+							__utf8_size = 0;
+						}
+						__utf8_size += __utf_bulk_write<1>(static_cast<char32_t>(__code_point),
+							__utf8_block + __utf8_size, __utf8_block_size - __utf8_size);
+					}
+					__reader._M_consume(__code_points.size());
+				}
+				__hash._M_update(__utf8_block, __utf8_size);
+			}
+			return __hash._M_finish();
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_DETAIL_HASH_ROUTINES_HPP
@@ -0,0 +1,225 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_ICONV_DESCRIPTOR_CACHE_HPP
+#define ZTD_TEXT_DETAIL_ICONV_DESCRIPTOR_CACHE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/assert.hpp>
+
+#include <ztd/platform.hpp>
+
+#include <cstddef>
+#include <string_view>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+#if ZTD_IS_ON(ZTD_PLATFORM_LIBICONV)
+		inline constexpr ::std::size_t __iconv_descriptor_cache_max_name_size = 64;
+
+		//////
+		/// @brief The (to, from) pair of names an iconv descriptor was opened with. Names too long to fit are never
+		/// cached, so this never has to allocate.
+		class __iconv_descriptor_key {
+		public:
+			constexpr __iconv_descriptor_key() noexcept
+			: _M_to(), _M_from(), _M_to_size(0), _M_from_size(0), _M_valid(false) {
+			}
+
+			__iconv_descriptor_key(::std::string_view __to_name, ::std::string_view __from_name) noexcept
+			: _M_to(), _M_from(), _M_to_size(0), _M_from_size(0), _M_valid(false) {
+				if (__to_name.size() > __iconv_descriptor_cache_max_name_size
+					|| __from_name.size() > __iconv_descriptor_cache_max_name_size) {
+					return;
+				}
+				__to_name.copy(this->_M_to, __to_name.size());
+				__from_name.copy(this->_M_from, __from_name.size());
+				this->_M_to_size   = __to_name.size();
+				this->_M_from_size = __from_name.size();
+				this->_M_valid     = true;
+			}
+
+			bool _M_is_valid() const noexcept {
+				return this->_M_valid;
+			}
+
+			friend bool operator==(
+				const __iconv_descriptor_key& __left, const __iconv_descriptor_key& __right) noexcept {
+				return __left._M_valid && __right._M_valid
+					&& ::std::string_view(__left._M_to, __left._M_to_size)
+					== ::std::string_view(__right._M_to, __right._M_to_size)
+					&& ::std::string_view(__left._M_from, __left._M_from_size)
+					== ::std::string_view(__right._M_from, __right._M_from_size);
+			}
+
+		private:
+			char _M_to[__iconv_descriptor_cache_max_name_size];
+			char _M_from[__iconv_descriptor_cache_max_name_size];
+			::std::size_t _M_to_size;
+			::std::size_t _M_from_size;
+			bool _M_valid;
+		};
+
+		//////
+		/// @brief A small, per-thread pool of idle iconv descriptors. Descriptors are handed back in their initial
+		/// shift state and handed out to the next state that asks for the same (to, from) pair.
+		class __iconv_descriptor_cache {
+		private:
+			inline static constexpr ::std::size_t _Capacity = ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE_I_;
+
+			struct __entry {
+				__iconv_descriptor_key _M_key;
+				::ztd::plat::icnv::descriptor _M_descriptor;
+			};
+
+		public:
+			__iconv_descriptor_cache(bool& __is_destroyed) noexcept
+			: _M_entries(), _M_size(0), _M_is_destroyed(__is_destroyed) {
+			}
+
+			__iconv_descriptor_cache(const __iconv_descriptor_cache&)            = delete;
+			__iconv_descriptor_cache& operator=(const __iconv_descriptor_cache&) = delete;
+
+			//////
+			/// @brief Takes a descriptor matching the key out of the cache, or returns
+			/// `ztd::plat::icnv::failure_descriptor` if there is none.
+			::ztd::plat::icnv::descriptor _M_take(const __iconv_descriptor_key& __key) noexcept {
+				if (!__key._M_is_valid()) {
+					return ::ztd::plat::icnv::failure_descriptor;
+				}
+				// search from the back: the most recently returned descriptor is the most likely to be hot
+				for (::std::size_t __index = this->_M_size; __index-- > 0;) {
+					__entry& __candidate = this->_M_entries[__index];
+					if (__candidate._M_key == __key) {
+						::ztd::plat::icnv::descriptor __descriptor = __candidate._M_descriptor;
+						this->_M_remove(__index);
+						return __descriptor;
+					}
+				}
+				return ::ztd::plat::icnv::failure_descriptor;
+			}
+
+			//////
+			/// @brief Gives a reset descriptor back to the cache. Returns `false` if the cache could not take it
+			/// (full, or the key is not cacheable), in which case the caller is still responsible for closing it.
+			bool _M_give(const __iconv_descriptor_key& __key, ::ztd::plat::icnv::descriptor __descriptor) noexcept {
+				if (!__key._M_is_valid() || this->_M_size == _Capacity) {
+					return false;
+				}
+				__entry& __target      = this->_M_entries[this->_M_size];
+				__target._M_key        = __key;
+				__target._M_descriptor = __descriptor;
+				++this->_M_size;
+				return true;
+			}
+
+			//////
+			/// @brief Closes every idle descriptor held by this cache.
+			void _M_purge() noexcept {
+				for (; this->_M_size > 0; --this->_M_size) {
+					int __close_result
+						= ::ztd::plat::icnv::functions().close(this->_M_entries[this->_M_size - 1]._M_descriptor);
+					ZTD_TEXT_ASSERT(__close_result == ::ztd::plat::icnv::close_success);
+				}
+			}
+
+			~__iconv_descriptor_cache() {
+				this->_M_purge();
+				this->_M_is_destroyed = true;
+			}
+
+		private:
+			void _M_remove(::std::size_t __index) noexcept {
+				for (::std::size_t __next = __index + 1; __next < this->_M_size; ++__index, (void)++__next) {
+					this->_M_entries[__index] = this->_M_entries[__next];
+				}
+				--this->_M_size;
+			}
+
+			__entry _M_entries[_Capacity];
+			::std::size_t _M_size;
+			bool& _M_is_destroyed;
+		};
+
+		//////
+		/// @brief Returns the calling thread's cache, or a null pointer if the thread is already tearing it down.
+		///
+		/// @remarks A thread's `thread_local` objects are destroyed before any objects with static storage duration
+		/// (and, on other threads, in no particular order relative to each other), so a state kept in a static or
+		/// another `thread_local` can outlive the cache. The flag is trivially destructible and therefore stays
+		/// readable until the thread itself is gone: once it is set, states simply open and close their descriptors
+		/// themselves again.
+		inline __iconv_descriptor_cache* __thread_iconv_descriptor_cache() noexcept {
+			thread_local bool __is_destroyed = false;
+			if (__is_destroyed) {
+				return nullptr;
+			}
+			thread_local __iconv_descriptor_cache __cache(__is_destroyed);
+			return &__cache;
+		}
+
+		//////
+		/// @brief Takes a descriptor matching the key out of the calling thread's cache, or returns
+		/// `ztd::plat::icnv::failure_descriptor` if there is none (or no cache anymore).
+		inline ::ztd::plat::icnv::descriptor __take_cached_iconv_descriptor(
+			const __iconv_descriptor_key& __key) noexcept {
+			__iconv_descriptor_cache* __cache = __thread_iconv_descriptor_cache();
+			if (__cache == nullptr) {
+				return ::ztd::plat::icnv::failure_descriptor;
+			}
+			return __cache->_M_take(__key);
+		}
+
+		//////
+		/// @brief Gives a reset descriptor back to the calling thread's cache. Returns `false` if it could not be
+		/// taken, in which case the caller is still responsible for closing it.
+		inline bool __give_cached_iconv_descriptor(
+			const __iconv_descriptor_key& __key, ::ztd::plat::icnv::descriptor __descriptor) noexcept {
+			__iconv_descriptor_cache* __cache = __thread_iconv_descriptor_cache();
+			if (__cache == nullptr) {
+				return false;
+			}
+			return __cache->_M_give(__key, __descriptor);
+		}
+#endif
+	} // namespace __txt_detail
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_DETAIL_ICONV_DESCRIPTOR_CACHE_HPP
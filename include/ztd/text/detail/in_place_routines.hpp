@@ -0,0 +1,261 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_IN_PLACE_ROUTINES_HPP
+#define ZTD_TEXT_DETAIL_IN_PLACE_ROUTINES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		// The most bytes a single code point takes up in the given UTF encoding.
+		template <typename _Encoding>
+		inline constexpr ::std::size_t __utf_max_bytes_v
+			= (4 / __utf_bulk_width_v<_Encoding>) * sizeof(code_unit_t<_Encoding>);
+
+		// How many bytes the code points of each UTF-8 length class (U+0000-U+007F, U+0080-U+07FF, U+0800-U+FFFF,
+		// U+10000-U+10FFFF) take up in the given UTF encoding. Every code point in a class takes the same number of
+		// bytes in every UTF encoding, so the first one stands in for all of them.
+		template <typename _Encoding>
+		constexpr ::std::size_t __utf_class_bytes(::std::size_t __class) noexcept {
+			constexpr char32_t __class_first[4] = { 0x0, 0x80, 0x800, 0x10000 };
+			return __utf_bulk_size<__utf_bulk_width_v<_Encoding>>(__class_first[__class])
+				* sizeof(code_unit_t<_Encoding>);
+		}
+
+		template <typename _FromEncoding, typename _ToEncoding>
+		constexpr bool __is_utf_always_shrinking() noexcept {
+			for (::std::size_t __class = 0; __class < 4; ++__class) {
+				if (__utf_class_bytes<_ToEncoding>(__class) > __utf_class_bytes<_FromEncoding>(__class)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Whether no code point ever takes more bytes in _ToEncoding than it did in _FromEncoding: then, writing
+		// the output over the input from the front can never overtake the read position.
+		template <typename _FromEncoding, typename _ToEncoding>
+		inline constexpr bool __is_utf_always_shrinking_v = __is_utf_always_shrinking<_FromEncoding, _ToEncoding>();
+
+		// Reads one well-formed code point out of native-endian code units stored at any alignment. Returns how many
+		// bytes it took, or 0 if the sequence is ill-formed or cut off.
+		template <typename _Encoding>
+		::std::size_t __utf_in_place_read(
+			const ::std::byte* __first, ::std::size_t __size, char32_t& __code_point) noexcept {
+			using _CodeUnit                       = code_unit_t<_Encoding>;
+			constexpr ::std::size_t __width       = __utf_bulk_width_v<_Encoding>;
+			constexpr ::std::size_t __max_units   = 4 / __width;
+			_CodeUnit __units[__max_units]        = {};
+			const ::std::size_t __available_units = __size / sizeof(_CodeUnit);
+			const ::std::size_t __loaded_units
+				= __available_units < __max_units ? __available_units : __max_units;
+			if (__loaded_units == 0) {
+				return 0;
+			}
+			::std::memcpy(__units, __first, __loaded_units * sizeof(_CodeUnit));
+			return __utf_bulk_read<__width>(__units, __loaded_units, __code_point) * sizeof(_CodeUnit);
+		}
+
+		// Encodes one code point into a small byte buffer of at least __utf_max_bytes_v<_Encoding> bytes. Returns
+		// how many bytes it took.
+		template <typename _Encoding>
+		::std::size_t __utf_in_place_encode(char32_t __code_point, ::std::byte* __first) noexcept {
+			using _CodeUnit                     = code_unit_t<_Encoding>;
+			constexpr ::std::size_t __width     = __utf_bulk_width_v<_Encoding>;
+			constexpr ::std::size_t __max_units = 4 / __width;
+			_CodeUnit __units[__max_units]      = {};
+			const ::std::size_t __written_bytes
+				= __utf_bulk_write<__width>(__code_point, __units, __max_units) * sizeof(_CodeUnit);
+			::std::memcpy(__first, __units, __written_bytes);
+			return __written_bytes;
+		}
+
+		// Holds on to output that got ahead of the read position during an in-place conversion until there is
+		// room for it.
+		template <::std::size_t _Capacity, ::std::size_t _MaxStepBytes>
+		class __in_place_spill {
+		private:
+			::std::byte _M_storage[_Capacity + _MaxStepBytes];
+			::std::size_t _M_first;
+			::std::size_t _M_last;
+
+		public:
+			__in_place_spill() noexcept : _M_storage(), _M_first(0), _M_last(0) {
+			}
+
+			bool _M_empty() const noexcept {
+				return this->_M_first == this->_M_last;
+			}
+
+			// Takes at most _MaxStepBytes more bytes; the caller guarantees no more than _Capacity are held on to
+			// between steps.
+			void _M_push(const ::std::byte* __bytes, ::std::size_t __size) noexcept {
+				if (this->_M_last + __size > sizeof(this->_M_storage)) {
+					::std::memmove(
+						this->_M_storage, this->_M_storage + this->_M_first, this->_M_last - this->_M_first);
+					this->_M_last -= this->_M_first;
+					this->_M_first = 0;
+				}
+				::std::memcpy(this->_M_storage + this->_M_last, __bytes, __size);
+				this->_M_last += __size;
+			}
+
+			// Writes out as much as fits in front of __limit, and returns how many bytes were written.
+			::std::size_t _M_flush(::std::byte* __destination, ::std::size_t __limit) noexcept {
+				const ::std::size_t __held  = this->_M_last - this->_M_first;
+				const ::std::size_t __count = __held < __limit ? __held : __limit;
+				::std::memcpy(__destination, this->_M_storage + this->_M_first, __count);
+				this->_M_first += __count;
+				return __count;
+			}
+		};
+
+		// How many code units, at least 1, of the ill-formed UTF-8 at __first make up one maximal subpart (see the
+		// Unicode Standard, 3.9, "U+FFFD Substitution of Maximal Subparts"): the longest start of a well-formed
+		// sequence that is there, or just the first code unit if there is none.
+		template <typename _CodeUnit>
+		constexpr ::std::size_t __utf8_maximal_subpart_size(const _CodeUnit* __first, ::std::size_t __size) noexcept {
+			const unsigned char __lead = static_cast<unsigned char>(__first[0]);
+			unsigned char __second_low  = 0x80;
+			unsigned char __second_high = 0xBF;
+			::std::size_t __length      = 0;
+			if (__lead >= 0xC2 && __lead <= 0xDF) {
+				__length = 2;
+			}
+			else if (__lead >= 0xE0 && __lead <= 0xEF) {
+				__length = 3;
+				if (__lead == 0xE0) {
+					__second_low = 0xA0;
+				}
+				else if (__lead == 0xED) {
+					__second_high = 0x9F;
+				}
+			}
+			else if (__lead >= 0xF0 && __lead <= 0xF4) {
+				__length = 4;
+				if (__lead == 0xF0) {
+					__second_low = 0x90;
+				}
+				else if (__lead == 0xF4) {
+					__second_high = 0x8F;
+				}
+			}
+			else {
+				return 1;
+			}
+			::std::size_t __index = 1;
+			for (; __index < __length && __index < __size; ++__index) {
+				const unsigned char __unit = static_cast<unsigned char>(__first[__index]);
+				const unsigned char __low  = __index == 1 ? __second_low : 0x80;
+				const unsigned char __high = __index == 1 ? __second_high : 0xBF;
+				if (__unit < __low || __unit > __high) {
+					break;
+				}
+			}
+			return __index;
+		}
+
+		// Works out how many more code units than it started with sanitizing UTF-8 with a replacement of
+		// __replacement_size code units needs at its peak, without writing anything. Returns the number of
+		// ill-formed sequences found.
+		template <typename _CodeUnit>
+		::std::size_t __utf8_sanitize_growth(const _CodeUnit* __first, ::std::size_t __size,
+			::std::size_t __replacement_size, ::std::size_t& __growth) noexcept {
+			::std::size_t __read           = 0;
+			::std::size_t __handled_errors = 0;
+			__growth                       = 0;
+			for (;;) {
+				::std::size_t __valid_size = 0;
+				(void)__utf_bulk_count<1, 1>(__first + __read, __size - __read, __valid_size);
+				__read += __valid_size;
+				if (__read == __size) {
+					break;
+				}
+				const ::std::size_t __ill_formed_size
+					= __utf8_maximal_subpart_size(__first + __read, __size - __read);
+				__read += __ill_formed_size;
+				if (__replacement_size > __ill_formed_size) {
+					__growth += __replacement_size - __ill_formed_size;
+				}
+				++__handled_errors;
+			}
+			return __handled_errors;
+		}
+
+		// Replaces every maximal subpart of ill-formed UTF-8 in [__first + __read, __first + __size) with the
+		// replacement, writing the result from __first + __write. Well-formed runs are found with the bulk counter
+		// and only moved when an earlier replacement has shifted them. The caller makes sure the write position
+		// never gets ahead of the read position. Returns the final write position.
+		template <typename _CodeUnit>
+		::std::size_t __utf8_sanitize_forward(_CodeUnit* __first, ::std::size_t __read, ::std::size_t __size,
+			::std::size_t __write, const _CodeUnit* __replacement, ::std::size_t __replacement_size,
+			::std::size_t& __handled_errors) noexcept {
+			for (;;) {
+				::std::size_t __valid_size = 0;
+				(void)__utf_bulk_count<1, 1>(__first + __read, __size - __read, __valid_size);
+				if (__write != __read && __valid_size != 0) {
+					::std::memmove(__first + __write, __first + __read, __valid_size * sizeof(_CodeUnit));
+				}
+				__read += __valid_size;
+				__write += __valid_size;
+				if (__read == __size) {
+					break;
+				}
+				__read += __utf8_maximal_subpart_size(__first + __read, __size - __read);
+				::std::memcpy(__first + __write, __replacement, __replacement_size * sizeof(_CodeUnit));
+				__write += __replacement_size;
+				++__handled_errors;
+			}
+			return __write;
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_DETAIL_IN_PLACE_ROUTINES_HPP
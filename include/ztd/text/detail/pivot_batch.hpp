@@ -0,0 +1,147 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_PIVOT_BATCH_HPP
+#define ZTD_TEXT_DETAIL_PIVOT_BATCH_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/pass_handler.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		// Whether basic_transcode_into can decode a whole pivot's worth of code points before encoding any of them.
+		// Every decode step has to produce at most one code point and every encode step has to take at most one, so
+		// that a failure at a given code point maps straight back onto the decode step that produced it; and both
+		// the states and the working views have to be copyable, since a failed step is rolled back by copy.
+		template <typename _FromEncoding, typename _ToEncoding, typename _Input, typename _Output,
+			typename _FromState, typename _ToState, typename _PivotRange>
+		inline constexpr bool __is_pivot_batchable_v = max_code_points_v<_FromEncoding> == 1          // cf
+			&& max_code_points_v<_ToEncoding> == 1                                                   // cf
+			&& __is_contiguous_range_of_v<_PivotRange, code_point_t<_FromEncoding>>                  // cf
+			&& ::std::is_copy_constructible_v<_Input> && ::std::is_copy_assignable_v<_Input>         // cf
+			&& ::std::is_copy_constructible_v<_Output> && ::std::is_copy_assignable_v<_Output>       // cf
+			&& ::std::is_copy_constructible_v<_FromState> && ::std::is_copy_assignable_v<_FromState> // cf
+			&& ::std::is_copy_constructible_v<_ToState> && ::std::is_copy_assignable_v<_ToState>;
+
+		// Decodes as many code points as fit into the pivot, then encodes that whole batch into the output, using
+		// the pass handler on both sides. Only steps that succeed are kept: the input, output, and states are left
+		// just before the first step that failed (on either side), so the caller can redo that one step through
+		// transcode_one_into with the real error handlers. If the encode side stops early, the input is found again
+		// by re-decoding the number of code points that made it out from the start of the batch.
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromState, typename _ToState, typename _CodePoint>
+		constexpr void __pivot_batch_transcode(_Input& __input, _FromEncoding& __from_encoding, _Output& __output,
+			_ToEncoding& __to_encoding, _FromState& __from_state, _ToState& __to_state,
+			::ztd::span<_CodePoint> __pivot) {
+			using _PivotSpan = ::ztd::span<_CodePoint>;
+			pass_handler_t __pass_handler {};
+
+			const _Input __batch_input          = __input;
+			const _FromState __batch_from_state = __from_state;
+
+			// stage 1: decode into the whole pivot
+			::std::size_t __decoded = 0;
+			while (!ranges::ranges_adl::adl_empty(__input) && __decoded < __pivot.size()) {
+				const _FromState __step_state = __from_state;
+				_PivotSpan __pivot_rest       = __pivot.subspan(__decoded);
+				auto __decode_result
+					= __from_encoding.decode_one(_Input(__input), __pivot_rest, __pass_handler, __from_state);
+				if (__decode_result.error_code != encoding_error::ok) {
+					__from_state = __step_state;
+					break;
+				}
+				__input = ::std::move(__decode_result.input);
+				__decoded += __pivot_rest.size() - ranges::ranges_adl::adl_size(__decode_result.output);
+			}
+
+			// stage 2: encode the whole batch
+			::std::size_t __encoded = 0;
+			while (__encoded < __decoded) {
+				const _ToState __step_state = __to_state;
+				_PivotSpan __batch_rest     = __pivot.subspan(__encoded, __decoded - __encoded);
+				auto __encode_result
+					= __to_encoding.encode_one(__batch_rest, _Output(__output), __pass_handler, __to_state);
+				const ::std::size_t __taken
+					= __batch_rest.size() - ranges::ranges_adl::adl_size(__encode_result.input);
+				if (__encode_result.error_code != encoding_error::ok || __taken == 0) {
+					__to_state = __step_state;
+					break;
+				}
+				__output = ::std::move(__encode_result.output);
+				__encoded += __taken;
+			}
+			if (__encoded == __decoded) {
+				return;
+			}
+
+			// the encode side stopped early: walk the input forward again from the start of the batch, up to the
+			// decode step that produced the first code point which did not make it out
+			__input                   = __batch_input;
+			__from_state              = __batch_from_state;
+			::std::size_t __redecoded = 0;
+			while (__redecoded < __encoded) {
+				_PivotSpan __pivot_rest = __pivot.subspan(__redecoded, __encoded - __redecoded);
+				auto __decode_result
+					= __from_encoding.decode_one(_Input(__input), __pivot_rest, __pass_handler, __from_state);
+				if (__decode_result.error_code != encoding_error::ok) {
+					break;
+				}
+				__input = ::std::move(__decode_result.input);
+				__redecoded += __pivot_rest.size() - ranges::ranges_adl::adl_size(__decode_result.output);
+			}
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_DETAIL_PIVOT_BATCH_HPP
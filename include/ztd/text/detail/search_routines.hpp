@@ -0,0 +1,499 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_SEARCH_ROUTINES_HPP
+#define ZTD_TEXT_DETAIL_SEARCH_ROUTINES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/pass_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/detail/compare_routines.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/validate_count_routines.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/default_sentinel.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		inline constexpr ::std::size_t __search_npos = static_cast<::std::size_t>(-1);
+
+		// The first index in [__first, __last) holding __code_unit, or __last.
+		template <typename _CodeUnit>
+		constexpr ::std::size_t __find_code_unit(const _CodeUnit* __haystack, ::std::size_t __first,
+			::std::size_t __last, _CodeUnit __code_unit) noexcept {
+			if constexpr (sizeof(_CodeUnit) == 1) {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+				if (!::std::is_constant_evaluated())
+#endif
+				{
+					const void* __found = ::std::memchr(
+						__haystack + __first, static_cast<int>(__code_unit_bits(__code_unit)), __last - __first);
+					return __found == nullptr
+						? __last
+						: static_cast<::std::size_t>(static_cast<const _CodeUnit*>(__found) - __haystack);
+				}
+			}
+			else if constexpr (is_char_traitable_v<_CodeUnit>) {
+				// wmemchr (or the equivalent loop) for the wider character types
+				const _CodeUnit* __found
+					= ::std::char_traits<_CodeUnit>::find(__haystack + __first, __last - __first, __code_unit);
+				return __found == nullptr ? __last : static_cast<::std::size_t>(__found - __haystack);
+			}
+			for (::std::size_t __index = __first; __index < __last; ++__index) {
+				if (__code_unit_bits(__haystack[__index]) == __code_unit_bits(__code_unit)) {
+					return __index;
+				}
+			}
+			return __last;
+		}
+
+		// Finds the first (or, with _Last, the last) place the needle's code units show up in the haystack's code
+		// units, jumping between candidates with a scan for the needle's first code unit. Returns __search_npos if
+		// there is none.
+		template <bool _Last, typename _CodeUnit>
+		constexpr ::std::size_t __search_code_units(const _CodeUnit* __haystack, ::std::size_t __haystack_size,
+			const _CodeUnit* __needle, ::std::size_t __needle_size) noexcept {
+			if (__needle_size == 0) {
+				return _Last ? __haystack_size : 0;
+			}
+			if (__needle_size > __haystack_size) {
+				return __search_npos;
+			}
+			const ::std::size_t __candidates = __haystack_size - __needle_size + 1;
+			if constexpr (_Last) {
+				for (::std::size_t __position = __candidates; __position-- > 0;) {
+					if (__code_units_equal(__haystack + __position, __needle_size, __needle, __needle_size)) {
+						return __position;
+					}
+				}
+			}
+			else {
+				for (::std::size_t __position = 0; __position < __candidates; ++__position) {
+					__position = __find_code_unit(__haystack, __position, __candidates, __needle[0]);
+					if (__position == __candidates) {
+						break;
+					}
+					if (__code_units_equal(
+						     __haystack + __position + 1, __needle_size - 1, __needle + 1, __needle_size - 1)) {
+						return __position;
+					}
+				}
+			}
+			return __search_npos;
+		}
+
+		template <typename _Range, typename _CodeUnit>
+		constexpr bool __starts_with_code_units(
+			const _Range& __range, const _CodeUnit* __needle, ::std::size_t __needle_size) {
+			auto __first      = ranges::ranges_adl::adl_begin(__range);
+			const auto __last = ranges::ranges_adl::adl_end(__range);
+			for (::std::size_t __index = 0; __index < __needle_size; ++__index, (void)++__first) {
+				if (__first == __last || __code_unit_bits(*__first) != __code_unit_bits(__needle[__index])) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Whether a needle can be looked for as code units. Without a shift state, a code point is written with the
+		// same code units wherever it shows up; with one, the code units depend on the state the text is in there.
+		template <typename _Encoding>
+		inline constexpr bool __is_code_unit_searchable_v
+			= ::std::is_empty_v<decode_state_t<_Encoding>> && ::std::is_empty_v<encode_state_t<_Encoding>>;
+
+		// Whether the input, decoded from __state, starts with the needle, decoded from __needle_state. Both are read
+		// one decode step at a time from copies, so a mismatch only costs the steps it takes to find it. On a match,
+		// __match_end and __match_end_state are set to just past the last step of the input the needle covers.
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State, typename _CodeUnit,
+			typename _NeedleState>
+		constexpr bool __starts_with_decoded(const _Input& __input, const _Encoding& __encoding,
+			_ErrorHandler& __error_handler, const _State& __state, const _CodeUnit* __needle,
+			::std::size_t __needle_size, const _NeedleState& __needle_state,
+			ranges::range_iterator_t<_Input>& __match_end, _State& __match_end_state) {
+			using _UEncoding                       = remove_cvref_t<_Encoding>;
+			using _CodePoint                       = code_point_t<_UEncoding>;
+			constexpr ::std::size_t _MaxCodePoints = max_code_points_v<_UEncoding>;
+
+			pass_handler_t __needle_error_handler {};
+			_Input __rest                    = __input;
+			_State __rest_state              = __state;
+			_NeedleState __needle_rest_state = __needle_state;
+			::ztd::span<const _CodeUnit> __needle_rest(__needle, __needle_size);
+			_CodePoint __code_points[_MaxCodePoints] {};
+			_CodePoint __needle_code_points[_MaxCodePoints] {};
+			::std::size_t __position        = 0;
+			::std::size_t __size            = 0;
+			::std::size_t __needle_position = 0;
+			::std::size_t __needle_count    = 0;
+			for (;;) {
+				if (__needle_position == __needle_count) {
+					if (__needle_rest.empty() && text::is_state_complete(__needle_rest_state)) {
+						__match_end       = ranges::ranges_adl::adl_begin(__rest);
+						__match_end_state = ::std::move(__rest_state);
+						return true;
+					}
+					auto __result = __encoding.decode_one(::std::move(__needle_rest),
+						::ztd::span<_CodePoint>(__needle_code_points), __needle_error_handler,
+						__needle_rest_state);
+					if (__result.error_code != encoding_error::ok) {
+						return false;
+					}
+					__needle_rest     = ::std::move(__result.input);
+					__needle_position = 0;
+					__needle_count    = static_cast<::std::size_t>(__result.output.data() - __needle_code_points);
+				}
+				else if (__position == __size) {
+					if (ranges::ranges_adl::adl_empty(__rest) && text::is_state_complete(__rest_state)) {
+						return false;
+					}
+					auto __result = __encoding.decode_one(::std::move(__rest),
+						::ztd::span<_CodePoint>(__code_points), __error_handler, __rest_state);
+					if (__result.error_code != encoding_error::ok) {
+						return false;
+					}
+					__rest     = ::std::move(__result.input);
+					__position = 0;
+					__size     = static_cast<::std::size_t>(__result.output.data() - __code_points);
+				}
+				else {
+					if (__code_points[__position] != __needle_code_points[__needle_position]) {
+						return false;
+					}
+					++__position;
+					++__needle_position;
+				}
+			}
+		}
+
+		// Where a search stopped: the start and end of the match, or the end of the input twice if there was none.
+		template <typename _Iterator>
+		struct __search_result {
+			_Iterator position;
+			_Iterator end;
+			bool found;
+		};
+
+		// A failed search: the position is the end of the input, as an iterator rather than a sentinel.
+		template <typename _Input>
+		constexpr auto __search_not_found(_Input&& __input) {
+			using _WorkingInput = ranges::range_reconstruct_t<remove_cvref_t<_Input>>;
+			using _Iterator     = ranges::range_iterator_t<_WorkingInput>;
+
+			_WorkingInput __working_input(
+				ranges::reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			if constexpr (ranges::is_range_contiguous_range_v<_WorkingInput>) {
+				const _Iterator __end = ranges::ranges_adl::adl_begin(__working_input)
+					+ ranges::ranges_adl::adl_size(__working_input);
+				return __search_result<_Iterator> { __end, __end, false };
+			}
+			else {
+				_Iterator __end = ranges::ranges_adl::adl_begin(__working_input);
+				for (; __end != ranges::ranges_adl::adl_end(__working_input); ++__end) {
+				}
+				return __search_result<_Iterator> { __end, __end, false };
+			}
+		}
+
+		// Finds the first (or, with _Last, the last) code point boundary in the input where the needle starts. For
+		// the self-synchronizing encodings (UTF-8, UTF-16, UTF-32, ASCII) over contiguous code units, a match of a
+		// well-formed needle can only ever start on a boundary, so this is a plain code unit search. Everything else
+		// is walked one decode step at a time, checking for the needle at every boundary: as code units if the
+		// encoding has no shift state, or else decoded (from __needle_state) and compared code point by code point,
+		// since the needle's code units from one state say nothing about how it is written in another. On a match,
+		// __state is left as the state just past it. When nothing is found, the position is the end of the input.
+		template <bool _Last, typename _Input, typename _Encoding, typename _ErrorHandler, typename _State,
+			typename _CodeUnit, typename _NeedleState>
+		constexpr auto __search_encoded(_Input&& __input, const _Encoding& __encoding,
+			_ErrorHandler& __error_handler, _State& __state, const _CodeUnit* __needle,
+			::std::size_t __needle_size, const _NeedleState& __needle_state) {
+			using _UEncoding    = remove_cvref_t<_Encoding>;
+			using _WorkingInput = ranges::range_reconstruct_t<remove_cvref_t<_Input>>;
+			using _Iterator     = ranges::range_iterator_t<_WorkingInput>;
+			using _Result       = __search_result<_Iterator>;
+
+			_WorkingInput __working_input(
+				ranges::reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			if constexpr (__code_unit_order_width_v<_UEncoding> != 0 // cf
+				&& __is_code_unit_searchable_v<_UEncoding>          // cf
+				&& __is_contiguous_range_of_v<_WorkingInput, code_unit_t<_UEncoding>>) {
+				(void)__encoding;
+				(void)__error_handler;
+				(void)__state;
+				(void)__needle_state;
+				const ::std::size_t __size     = ranges::ranges_adl::adl_size(__working_input);
+				const ::std::size_t __position = __search_code_units<_Last>(
+					ranges::ranges_adl::adl_data(__working_input), __size, __needle, __needle_size);
+				const _Iterator __first = ranges::ranges_adl::adl_begin(__working_input);
+				if (__position == __search_npos) {
+					return _Result { __first + __size, __first + __size, false };
+				}
+				return _Result { __first + __position, __first + (__position + __needle_size), true };
+			}
+			else {
+				_Iterator __last_match {};
+				_Iterator __match_end {};
+				_State __match_end_state = __state;
+				bool __found             = false;
+				for (;;) {
+					bool __matched = false;
+					if constexpr (__is_code_unit_searchable_v<_UEncoding>) {
+						(void)__needle_state;
+						__matched = __starts_with_code_units(__working_input, __needle, __needle_size);
+						if (__matched) {
+							__match_end = ::std::next(ranges::ranges_adl::adl_begin(__working_input),
+								static_cast<::std::ptrdiff_t>(__needle_size));
+						}
+					}
+					else {
+						__matched = __starts_with_decoded(__working_input, __encoding, __error_handler, __state,
+							__needle, __needle_size, __needle_state, __match_end, __match_end_state);
+					}
+					if (__matched) {
+						__last_match = ranges::ranges_adl::adl_begin(__working_input);
+						__found      = true;
+						if constexpr (!_Last) {
+							break;
+						}
+					}
+					if (ranges::ranges_adl::adl_empty(__working_input) && text::is_state_complete(__state)) {
+						break;
+					}
+					auto __step = __basic_count_as_decoded_one(
+						::std::move(__working_input), __encoding, __error_handler, __state);
+					__working_input = ::std::move(__step.input);
+					if (__step.error_code != encoding_error::ok) {
+						break;
+					}
+				}
+				if (__found) {
+					__state = ::std::move(__match_end_state);
+					return _Result { ::std::move(__last_match), ::std::move(__match_end), true };
+				}
+				return __search_not_found(::std::move(__working_input));
+			}
+		}
+
+		// A lazy forward range over the pieces of a text view between occurrences of a delimiter. There is always one
+		// more piece than there are delimiters, so empty text gives one empty piece and a trailing delimiter gives a
+		// trailing empty piece. An empty delimiter does not split at all. Each piece starts in the state the text is
+		// in at that point, which only matters for encodings with a shift state.
+		template <typename _View, typename _DelimiterState>
+		class __text_split_range {
+		private:
+			using _Range        = typename _View::range_type;
+			using _WorkingRange = ranges::range_reconstruct_t<_Range>;
+			using _State        = typename _View::state_type;
+			using _CodeUnit     = code_unit_t<remove_cvref_t<typename _View::encoding_type>>;
+
+			static constexpr ::std::size_t _MaxDelimiterSize
+				= max_code_units_v<remove_cvref_t<typename _View::encoding_type>>;
+
+		public:
+			class iterator {
+			public:
+				using value_type        = _View;
+				using reference         = _View;
+				using difference_type   = ::std::ptrdiff_t;
+				using iterator_category = ::std::forward_iterator_tag;
+				using iterator_concept  = ::std::forward_iterator_tag;
+
+				constexpr iterator() = default;
+
+				constexpr explicit iterator(const __text_split_range& __parent)
+				: _M_parent(&__parent)
+				, _M_rest(ranges::reconstruct(::std::in_place_type<_Range>, __parent._M_view.base()))
+				, _M_piece(_M_rest)
+				, _M_rest_state(__parent._M_view._M_state)
+				, _M_piece_state(_M_rest_state)
+				, _M_last(false)
+				, _M_done(false) {
+					this->_M_next();
+				}
+
+				constexpr _View operator*() const {
+					_View __piece(this->_M_parent->_M_view);
+					__piece.base()   = this->_M_piece;
+					__piece._M_state = this->_M_piece_state;
+					return __piece;
+				}
+
+				constexpr iterator& operator++() {
+					if (this->_M_last) {
+						this->_M_done = true;
+					}
+					else {
+						this->_M_next();
+					}
+					return *this;
+				}
+
+				constexpr iterator operator++(int) {
+					iterator __copy = *this;
+					++*this;
+					return __copy;
+				}
+
+				friend constexpr bool operator==(const iterator& __left, const iterator& __right) {
+					if (__left._M_done || __right._M_done) {
+						return __left._M_done == __right._M_done;
+					}
+					return __left._M_last == __right._M_last
+						&& ranges::ranges_adl::adl_begin(__left._M_piece)
+						== ranges::ranges_adl::adl_begin(__right._M_piece);
+				}
+
+				friend constexpr bool operator!=(const iterator& __left, const iterator& __right) {
+					return !(__left == __right);
+				}
+
+				friend constexpr bool operator==(const iterator& __it, const ranges::default_sentinel_t&) noexcept {
+					return __it._M_done;
+				}
+
+				friend constexpr bool operator==(const ranges::default_sentinel_t&, const iterator& __it) noexcept {
+					return __it._M_done;
+				}
+
+				friend constexpr bool operator!=(const iterator& __it, const ranges::default_sentinel_t&) noexcept {
+					return !__it._M_done;
+				}
+
+				friend constexpr bool operator!=(const ranges::default_sentinel_t&, const iterator& __it) noexcept {
+					return !__it._M_done;
+				}
+
+			private:
+				constexpr void _M_next() {
+					const ::std::size_t __delimiter_size = this->_M_parent->_M_delimiter_size;
+					this->_M_piece_state                 = this->_M_rest_state;
+					if (__delimiter_size == 0) {
+						this->_M_piece = this->_M_rest;
+						this->_M_last  = true;
+						return;
+					}
+					// leaves _M_rest_state as the state just past the delimiter, where the next piece starts
+					auto __match = this->_M_parent->_M_view.template _M_search<false>(this->_M_rest,
+						this->_M_rest_state, this->_M_parent->_M_delimiter(), __delimiter_size,
+						this->_M_parent->_M_delimiter_state);
+					this->_M_piece = ranges::reconstruct(::std::in_place_type<_WorkingRange>,
+						ranges::ranges_adl::adl_begin(this->_M_rest), __match.position);
+					if (!__match.found) {
+						this->_M_last = true;
+						return;
+					}
+					this->_M_rest = ranges::reconstruct(::std::in_place_type<_WorkingRange>,
+						::std::move(__match.end), ranges::ranges_adl::adl_end(this->_M_rest));
+				}
+
+				const __text_split_range* _M_parent = nullptr;
+				_WorkingRange _M_rest {};
+				_WorkingRange _M_piece {};
+				_State _M_rest_state {};
+				_State _M_piece_state {};
+				bool _M_last = false;
+				bool _M_done = true;
+			};
+
+			constexpr __text_split_range(const _View& __view, const _CodeUnit* __delimiter,
+				::std::size_t __delimiter_size, const _DelimiterState& __delimiter_state) noexcept(
+				::std::is_nothrow_copy_constructible_v<_View> // cf
+				     && ::std::is_nothrow_copy_constructible_v<_DelimiterState>)
+			: _M_view(__view)
+			, _M_delimiter_storage()
+			, _M_external_delimiter(__delimiter)
+			, _M_delimiter_size(__delimiter_size)
+			, _M_delimiter_state(__delimiter_state) {
+			}
+
+			constexpr __text_split_range(::std::in_place_t, const _View& __view, const _CodeUnit* __delimiter,
+				::std::size_t __delimiter_size, const _DelimiterState& __delimiter_state) noexcept(
+				::std::is_nothrow_copy_constructible_v<_View> // cf
+				     && ::std::is_nothrow_copy_constructible_v<_DelimiterState>)
+			: _M_view(__view)
+			, _M_delimiter_storage()
+			, _M_external_delimiter(nullptr)
+			, _M_delimiter_size(__delimiter_size)
+			, _M_delimiter_state(__delimiter_state) {
+				for (::std::size_t __index = 0; __index < __delimiter_size; ++__index) {
+					this->_M_delimiter_storage[__index] = __delimiter[__index];
+				}
+			}
+
+			constexpr iterator begin() const {
+				return iterator(*this);
+			}
+
+			constexpr ranges::default_sentinel_t end() const noexcept {
+				return ranges::default_sentinel_t {};
+			}
+
+		private:
+			constexpr const _CodeUnit* _M_delimiter() const noexcept {
+				return this->_M_external_delimiter == nullptr ? this->_M_delimiter_storage
+				                                              : this->_M_external_delimiter;
+			}
+
+			_View _M_view;
+			_CodeUnit _M_delimiter_storage[_MaxDelimiterSize];
+			const _CodeUnit* _M_external_delimiter;
+			::std::size_t _M_delimiter_size;
+			_DelimiterState _M_delimiter_state;
+		};
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_DETAIL_SEARCH_ROUTINES_HPP
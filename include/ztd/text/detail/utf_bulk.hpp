@@ -0,0 +1,472 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_UTF_BULK_HPP
+#define ZTD_TEXT_DETAIL_UTF_BULK_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/utf8.hpp>
+#include <ztd/text/utf16.hpp>
+#include <ztd/text/utf32.hpp>
+#include <ztd/text/transcode_result.hpp>
+#include <ztd/text/pivot.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		// How many bytes a code unit of one of the strict, standard UTF encodings needs (1, 2, or 4), or 0 if the
+		// encoding is anything else (including the WTF-8 / MUTF-8 style variants, which accept things the
+		// routines below do not).
+		template <typename _Encoding>
+		inline constexpr ::std::size_t __utf_bulk_width_v
+			= is_specialization_of_v<_Encoding, basic_utf8> && sizeof(code_unit_t<_Encoding>) == 1 ? 1
+			: is_specialization_of_v<_Encoding, basic_utf16> && sizeof(code_unit_t<_Encoding>) >= 2 ? 2
+			: is_specialization_of_v<_Encoding, basic_utf32> && sizeof(code_unit_t<_Encoding>) >= 4 ? 4
+			: 0;
+
+		template <typename _FromEncoding, typename _ToEncoding, typename _Input, typename _Output>
+		inline constexpr bool __is_utf_bulk_transcodable_v = __utf_bulk_width_v<_FromEncoding> != 0 // cf
+			&& __utf_bulk_width_v<_ToEncoding> != 0                                             // cf
+			&& __is_contiguous_range_of_v<_Input, code_unit_t<_FromEncoding>>                   // cf
+			&& __is_contiguous_range_of_v<_Output, code_unit_t<_ToEncoding>>;
+
+		template <typename _FromEncoding, typename _ToEncoding, typename _Input>
+		inline constexpr bool __is_utf_bulk_countable_v = __utf_bulk_width_v<_FromEncoding> != 0 // cf
+			&& __utf_bulk_width_v<_ToEncoding> != 0                                           // cf
+			&& __is_contiguous_range_of_v<_Input, code_unit_t<_FromEncoding>>;
+
+		// Reads one well-formed code point. Returns how many code units it took, or 0 if the sequence is ill-formed
+		// or cut off by the end of the input: those are left for the encoding's own decode_one to report.
+		template <::std::size_t _Width, typename _CodeUnit>
+		constexpr ::std::size_t __utf_bulk_read(
+			const _CodeUnit* __first, ::std::size_t __size, char32_t& __code_point) noexcept {
+			if constexpr (_Width == 1) {
+				const char32_t __unit0 = static_cast<unsigned char>(__first[0]);
+				if (__unit0 < 0x80) {
+					__code_point = __unit0;
+					return 1;
+				}
+				if (__unit0 < 0xC2) {
+					// stray continuation byte, or an overlong two-byte lead
+					return 0;
+				}
+				if (__unit0 < 0xE0) {
+					if (__size < 2) {
+						return 0;
+					}
+					const char32_t __unit1 = static_cast<unsigned char>(__first[1]);
+					if ((__unit1 & 0xC0) != 0x80) {
+						return 0;
+					}
+					__code_point = ((__unit0 & 0x1F) << 6) | (__unit1 & 0x3F);
+					return 2;
+				}
+				if (__unit0 < 0xF0) {
+					if (__size < 3) {
+						return 0;
+					}
+					const char32_t __unit1 = static_cast<unsigned char>(__first[1]);
+					const char32_t __unit2 = static_cast<unsigned char>(__first[2]);
+					if ((__unit1 & 0xC0) != 0x80 || (__unit2 & 0xC0) != 0x80) {
+						return 0;
+					}
+					__code_point = ((__unit0 & 0x0F) << 12) | ((__unit1 & 0x3F) << 6) | (__unit2 & 0x3F);
+					if (__code_point < 0x800 || __ztd_idk_detail_is_surrogate(__code_point)) {
+						return 0;
+					}
+					return 3;
+				}
+				if (__unit0 < 0xF5) {
+					if (__size < 4) {
+						return 0;
+					}
+					const char32_t __unit1 = static_cast<unsigned char>(__first[1]);
+					const char32_t __unit2 = static_cast<unsigned char>(__first[2]);
+					const char32_t __unit3 = static_cast<unsigned char>(__first[3]);
+					if ((__unit1 & 0xC0) != 0x80 || (__unit2 & 0xC0) != 0x80 || (__unit3 & 0xC0) != 0x80) {
+						return 0;
+					}
+					__code_point = ((__unit0 & 0x07) << 18) | ((__unit1 & 0x3F) << 12) | ((__unit2 & 0x3F) << 6)
+						| (__unit3 & 0x3F);
+					if (__code_point < 0x10000 || __code_point > __ztd_idk_detail_last_unicode_code_point) {
+						return 0;
+					}
+					return 4;
+				}
+				return 0;
+			}
+			else if constexpr (_Width == 2) {
+				const char32_t __unit0 = static_cast<char32_t>(__first[0]);
+				if (__unit0 > 0xFFFF) {
+					return 0;
+				}
+				if (!__ztd_idk_detail_is_surrogate(__unit0)) {
+					__code_point = __unit0;
+					return 1;
+				}
+				if (__unit0 > 0xDBFF || __size < 2) {
+					// lone trailing surrogate, or a leading one cut off by the end of the input
+					return 0;
+				}
+				const char32_t __unit1 = static_cast<char32_t>(__first[1]);
+				if (__unit1 < 0xDC00 || __unit1 > 0xDFFF) {
+					return 0;
+				}
+				__code_point = 0x10000 + ((__unit0 - 0xD800) << 10) + (__unit1 - 0xDC00);
+				return 2;
+			}
+			else {
+				(void)__size;
+				const char32_t __unit0 = static_cast<char32_t>(__first[0]);
+				if (__unit0 > __ztd_idk_detail_last_unicode_code_point || __ztd_idk_detail_is_surrogate(__unit0)) {
+					return 0;
+				}
+				__code_point = __unit0;
+				return 1;
+			}
+		}
+
+		// Writes one (already valid) code point. Returns how many code units it took, or 0 if there is not enough
+		// room for all of them.
+		template <::std::size_t _Width, typename _CodeUnit>
+		constexpr ::std::size_t __utf_bulk_write(
+			char32_t __code_point, _CodeUnit* __first, ::std::size_t __size) noexcept {
+			if constexpr (_Width == 1) {
+				if (__code_point < 0x80) {
+					if (__size < 1) {
+						return 0;
+					}
+					__first[0] = static_cast<_CodeUnit>(__code_point);
+					return 1;
+				}
+				if (__code_point < 0x800) {
+					if (__size < 2) {
+						return 0;
+					}
+					__first[0] = static_cast<_CodeUnit>(0xC0 | (__code_point >> 6));
+					__first[1] = static_cast<_CodeUnit>(0x80 | (__code_point & 0x3F));
+					return 2;
+				}
+				if (__code_point < 0x10000) {
+					if (__size < 3) {
+						return 0;
+					}
+					__first[0] = static_cast<_CodeUnit>(0xE0 | (__code_point >> 12));
+					__first[1] = static_cast<_CodeUnit>(0x80 | ((__code_point >> 6) & 0x3F));
+					__first[2] = static_cast<_CodeUnit>(0x80 | (__code_point & 0x3F));
+					return 3;
+				}
+				if (__size < 4) {
+					return 0;
+				}
+				__first[0] = static_cast<_CodeUnit>(0xF0 | (__code_point >> 18));
+				__first[1] = static_cast<_CodeUnit>(0x80 | ((__code_point >> 12) & 0x3F));
+				__first[2] = static_cast<_CodeUnit>(0x80 | ((__code_point >> 6) & 0x3F));
+				__first[3] = static_cast<_CodeUnit>(0x80 | (__code_point & 0x3F));
+				return 4;
+			}
+			else if constexpr (_Width == 2) {
+				if (__code_point < 0x10000) {
+					if (__size < 1) {
+						return 0;
+					}
+					__first[0] = static_cast<_CodeUnit>(__code_point);
+					return 1;
+				}
+				if (__size < 2) {
+					return 0;
+				}
+				const char32_t __offset = __code_point - 0x10000;
+				__first[0]              = static_cast<_CodeUnit>(0xD800 + (__offset >> 10));
+				__first[1]              = static_cast<_CodeUnit>(0xDC00 + (__offset & 0x3FF));
+				return 2;
+			}
+			else {
+				if (__size < 1) {
+					return 0;
+				}
+				__first[0] = static_cast<_CodeUnit>(__code_point);
+				return 1;
+			}
+		}
+
+		// How many code units a (valid) code point takes up.
+		template <::std::size_t _Width>
+		constexpr ::std::size_t __utf_bulk_size(char32_t __code_point) noexcept {
+			if constexpr (_Width == 1) {
+				return __code_point < 0x80 ? 1 : __code_point < 0x800 ? 2 : __code_point < 0x10000 ? 3 : 4;
+			}
+			else if constexpr (_Width == 2) {
+				return __code_point < 0x10000 ? 1 : 2;
+			}
+			else {
+				(void)__code_point;
+				return 1;
+			}
+		}
+
+		// Counts how many output code units the well-formed input turns into, stopping in front of the first
+		// sequence that is ill-formed or cut off.
+		template <::std::size_t _FromWidth, ::std::size_t _ToWidth, typename _FromCodeUnit>
+		constexpr ::std::size_t __utf_bulk_count(
+			const _FromCodeUnit* __input, ::std::size_t __input_size, ::std::size_t& __read_count) noexcept {
+			constexpr ::std::size_t __ascii_block = 8;
+			::std::size_t __read                  = 0;
+			::std::size_t __count                 = 0;
+			for (;;) {
+				if constexpr (_FromWidth == 1) {
+					// ASCII is one code unit in, one code unit out, whatever the output encoding
+					while (__input_size - __read >= __ascii_block) {
+						::std::uint_least64_t __word = 0;
+						for (::std::size_t __index = 0; __index < __ascii_block; ++__index) {
+							__word |= static_cast<::std::uint_least64_t>(
+								          static_cast<unsigned char>(__input[__read + __index]))
+								<< (__index * 8);
+						}
+						if ((__word & 0x8080808080808080ull) != 0) {
+							break;
+						}
+						__read += __ascii_block;
+						__count += __ascii_block;
+					}
+				}
+				if (__read == __input_size) {
+					break;
+				}
+				char32_t __code_point          = 0;
+				const ::std::size_t __in_count = __utf_bulk_read<_FromWidth>(
+					__input + __read, __input_size - __read, __code_point);
+				if (__in_count == 0) {
+					break;
+				}
+				__read += __in_count;
+				__count += __utf_bulk_size<_ToWidth>(__code_point);
+			}
+			__read_count = __read;
+			return __count;
+		}
+
+		// Like __utf_bulk_count, but also stops in front of the first code point whose output would take the count
+		// past __max_count.
+		template <::std::size_t _FromWidth, ::std::size_t _ToWidth, typename _FromCodeUnit>
+		constexpr ::std::size_t __utf_bulk_count_until(const _FromCodeUnit* __input, ::std::size_t __input_size,
+			::std::size_t __max_count, ::std::size_t& __read_count) noexcept {
+			constexpr ::std::size_t __ascii_block = 8;
+			::std::size_t __read                  = 0;
+			::std::size_t __count                 = 0;
+			for (;;) {
+				if constexpr (_FromWidth == 1) {
+					while (__input_size - __read >= __ascii_block && __max_count - __count >= __ascii_block) {
+						::std::uint_least64_t __word = 0;
+						for (::std::size_t __index = 0; __index < __ascii_block; ++__index) {
+							__word |= static_cast<::std::uint_least64_t>(
+								          static_cast<unsigned char>(__input[__read + __index]))
+								<< (__index * 8);
+						}
+						if ((__word & 0x8080808080808080ull) != 0) {
+							break;
+						}
+						__read += __ascii_block;
+						__count += __ascii_block;
+					}
+				}
+				if (__read == __input_size || __count == __max_count) {
+					break;
+				}
+				char32_t __code_point          = 0;
+				const ::std::size_t __in_count = __utf_bulk_read<_FromWidth>(
+					__input + __read, __input_size - __read, __code_point);
+				if (__in_count == 0) {
+					break;
+				}
+				const ::std::size_t __out_count = __utf_bulk_size<_ToWidth>(__code_point);
+				if (__max_count - __count < __out_count) {
+					break;
+				}
+				__read += __in_count;
+				__count += __out_count;
+			}
+			__read_count = __read;
+			return __count;
+		}
+
+		// Converts as much well-formed input as fits into the output, stopping in front of the first sequence that
+		// is ill-formed, cut off, or does not fit.
+		template <::std::size_t _FromWidth, ::std::size_t _ToWidth, typename _FromCodeUnit, typename _ToCodeUnit>
+		constexpr void __utf_bulk_convert(const _FromCodeUnit* __input, ::std::size_t __input_size,
+			::std::size_t& __read_count, _ToCodeUnit* __output, ::std::size_t __output_size,
+			::std::size_t& __written_count) noexcept {
+			constexpr ::std::size_t __ascii_block = 8;
+			::std::size_t __read                  = 0;
+			::std::size_t __written               = 0;
+			for (;;) {
+				if constexpr (_FromWidth == 1) {
+					// Runs of ASCII are the overwhelmingly common case for UTF-8: check them a whole 64-bit word
+					// at a time, and copy them over (one code unit each, whatever the output is) without decoding.
+					while (__input_size - __read >= __ascii_block && __output_size - __written >= __ascii_block) {
+						::std::uint_least64_t __word = 0;
+						for (::std::size_t __index = 0; __index < __ascii_block; ++__index) {
+							__word |= static_cast<::std::uint_least64_t>(
+								          static_cast<unsigned char>(__input[__read + __index]))
+								<< (__index * 8);
+						}
+						if ((__word & 0x8080808080808080ull) != 0) {
+							break;
+						}
+						for (::std::size_t __index = 0; __index < __ascii_block; ++__index) {
+							__output[__written + __index]
+								= static_cast<_ToCodeUnit>(static_cast<unsigned char>(__input[__read + __index]));
+						}
+						__read += __ascii_block;
+						__written += __ascii_block;
+					}
+				}
+				if (__read == __input_size) {
+					break;
+				}
+				char32_t __code_point          = 0;
+				const ::std::size_t __in_count = __utf_bulk_read<_FromWidth>(
+					__input + __read, __input_size - __read, __code_point);
+				if (__in_count == 0) {
+					break;
+				}
+				const ::std::size_t __out_count = __utf_bulk_write<_ToWidth>(
+					__code_point, __output + __written, __output_size - __written);
+				if (__out_count == 0) {
+					break;
+				}
+				__read += __in_count;
+				__written += __out_count;
+			}
+			__read_count    = __read;
+			__written_count = __written;
+		}
+
+		// Transcoding between two of the standard UTF encodings over contiguous memory. Everything well-formed is
+		// converted directly, without going through code point buffers; only the sequences the fast loop stops at
+		// (ill-formed or incomplete input, or not enough room) go through the encodings' own decode_one / encode_one,
+		// so the error handlers see exactly what they normally would. After that one sequence, the fast loop picks
+		// right back up: one bad byte does not slow the rest of the input down.
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
+			typename _PivotRange>
+		constexpr auto __utf_bulk_transcode_into(_Input&& __input, const _FromEncoding& __from_encoding,
+			_Output&& __output, const _ToEncoding& __to_encoding, _FromErrorHandler&& __from_error_handler,
+			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
+			pivot<_PivotRange>& __pivot) {
+			using _UInput                 = remove_cvref_t<_Input>;
+			using _UOutput                = remove_cvref_t<_Output>;
+			using _WorkingInput           = ranges::range_reconstruct_t<_UInput>;
+			using _WorkingOutput          = ranges::range_reconstruct_t<_UOutput>;
+			using _Result                 = transcode_result<_WorkingInput, _WorkingOutput, _FromState, _ToState>;
+			using _IntermediateCodePoint  = code_point_t<_FromEncoding>;
+			constexpr ::std::size_t _FromWidth = __utf_bulk_width_v<_FromEncoding>;
+			constexpr ::std::size_t _ToWidth   = __utf_bulk_width_v<_ToEncoding>;
+
+			_WorkingInput __working_input
+				= ranges::reconstruct(::std::in_place_type<_UInput>, ::std::forward<_Input>(__input));
+			_WorkingOutput __working_output
+				= ranges::reconstruct(::std::in_place_type<_UOutput>, ::std::forward<_Output>(__output));
+			::std::size_t __handled_errors = 0;
+			for (;;) {
+				::std::size_t __read_count    = 0;
+				::std::size_t __written_count = 0;
+				__utf_bulk_convert<_FromWidth, _ToWidth>(ranges::ranges_adl::adl_data(__working_input),
+					ranges::ranges_adl::adl_size(__working_input), __read_count,
+					ranges::ranges_adl::adl_data(__working_output), ranges::ranges_adl::adl_size(__working_output),
+					__written_count);
+				__working_input  = ranges::reconstruct(::std::in_place_type<_UInput>,
+					 ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+					 ranges::ranges_adl::adl_end(__working_input));
+				__working_output = ranges::reconstruct(::std::in_place_type<_UOutput>,
+					ranges::ranges_adl::adl_begin(__working_output) + __written_count,
+					ranges::ranges_adl::adl_end(__working_output));
+				if (ranges::ranges_adl::adl_empty(__working_input)) {
+					return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+						__to_state, encoding_error::ok, __handled_errors);
+				}
+				// the fast loop stopped in front of something: push exactly that through the usual machinery, and
+				// (like the one-by-one loop) report it as unread if it could not be handled
+				_IntermediateCodePoint __intermediate_storage[max_code_points_v<_FromEncoding>] {};
+				::ztd::span<_IntermediateCodePoint> __intermediate(__intermediate_storage);
+				_WorkingInput __sequence_input = __working_input;
+				auto __decode_result           = __from_encoding.decode_one(
+					::std::move(__working_input), __intermediate, __from_error_handler, __from_state);
+				__handled_errors += __decode_result.handled_errors;
+				__working_input = ::std::move(__decode_result.input);
+				if (__decode_result.error_code != encoding_error::ok) {
+					__pivot.error_code = __decode_result.error_code;
+					return _Result(::std::move(__sequence_input), ::std::move(__working_output), __from_state,
+						__to_state, __decode_result.error_code, __handled_errors);
+				}
+				::ztd::span<_IntermediateCodePoint> __decoded(
+					__intermediate_storage, __decode_result.output.data() - __intermediate_storage);
+				while (!__decoded.empty()) {
+					auto __encode_result = __to_encoding.encode_one(
+						::std::move(__decoded), ::std::move(__working_output), __to_error_handler, __to_state);
+					__handled_errors += __encode_result.handled_errors;
+					__working_output = ::std::move(__encode_result.output);
+					if (__encode_result.error_code != encoding_error::ok) {
+						return _Result(::std::move(__sequence_input), ::std::move(__working_output), __from_state,
+							__to_state, __encode_result.error_code, __handled_errors);
+					}
+					__decoded = ::std::move(__encode_result.input);
+				}
+			}
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_DETAIL_UTF_BULK_HPP
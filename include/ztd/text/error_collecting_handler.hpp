@@ -0,0 +1,274 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_ERROR_COLLECTING_HANDLER_HPP
+#define ZTD_TEXT_ERROR_COLLECTING_HANDLER_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/assert.hpp>
+
+#include <ztd/ranges/range.hpp>
+#include <ztd/idk/ebco.hpp>
+#include <ztd/idk/span.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief A single error seen by a ztd::text::error_collecting_handler.
+	struct error_record {
+		//////
+		/// @brief The offset, in elements of the input, of the first element of the sequence that failed.
+		::std::size_t input_offset;
+		//////
+		/// @brief The error that occurred.
+		encoding_error error_code;
+		//////
+		/// @brief The number of input elements read as part of the sequence that failed.
+		::std::size_t input_length;
+	};
+
+	//////
+	/// @brief An error handler that writes down where every error happened into a caller-provided buffer of
+	/// ztd::text::error_record, and then lets another error handler (by default, the ztd::text::replacement_handler_t)
+	/// deal with the error so the operation can keep going.
+	///
+	/// @tparam _ErrorHandler The error handler to invoke after the error has been recorded.
+	///
+	/// @remarks Offsets are computed from the size of the input given at construction time and the size of the
+	/// input that remains when the error is reported, so the input must be a sized range and the handler must be
+	/// given the whole of that input. This is true of every error the "from" encoding reports during a decode or
+	/// transcode, including the ones reported from the bulk paths, which only hand the bad sequence to the
+	/// encoding's `decode_one` and the error handler. For a transcode, pass it as the "from" error handler: the "to"
+	/// encoding reports errors against the intermediate code points, not the input. The handler can be moved but not
+	/// copied, so that its buffer only ever has one count of what is in it: when it is the only error handler given
+	/// to a transcode, the "to" encoding cannot get a copy of it and uses the ztd::text::default_handler_t instead.
+	/// When the buffer is full, errors are still counted (see error_count()) but no longer written down.
+	/// ztd::text::encoding_error::insufficient_output_space is not recorded, since it does not describe the input.
+	template <typename _ErrorHandler = replacement_handler_t>
+	class error_collecting_handler : private ebco<_ErrorHandler> {
+	private:
+		using __error_handler_base_t = ebco<_ErrorHandler>;
+
+	public:
+		//////
+		/// @brief The underlying error handler type.
+		using error_handler = _ErrorHandler;
+
+		//////
+		/// @brief Constructs a ztd::text::error_collecting_handler with a default-constructed internal error handler.
+		///
+		/// @param[in] __input_size The size of the input, in code units or code points, that errors will be
+		/// reported against.
+		/// @param[in] __records The buffer to write the error records into.
+		constexpr error_collecting_handler(::std::size_t __input_size, ::ztd::span<error_record> __records) noexcept(
+			::std::is_nothrow_default_constructible_v<__error_handler_base_t>)
+		: __error_handler_base_t(), _M_records(__records), _M_input_size(__input_size), _M_error_count(0) {
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::error_collecting_handler with the provided internal error handler object.
+		///
+		/// @param[in] __input_size The size of the input, in code units or code points, that errors will be
+		/// reported against.
+		/// @param[in] __records The buffer to write the error records into.
+		/// @param[in] __error_handler The error handler to invoke after an error has been recorded.
+		constexpr error_collecting_handler(::std::size_t __input_size, ::ztd::span<error_record> __records,
+			_ErrorHandler __error_handler) noexcept(::std::is_nothrow_move_constructible_v<_ErrorHandler>)
+		: __error_handler_base_t(::std::move(__error_handler))
+		, _M_records(__records)
+		, _M_input_size(__input_size)
+		, _M_error_count(0) {
+		}
+
+		//////
+		/// @brief Cannot copy-construct a ztd::text::error_collecting_handler object.
+		error_collecting_handler(const error_collecting_handler&) = delete;
+		//////
+		/// @brief Cannot copy-assign a ztd::text::error_collecting_handler object.
+		error_collecting_handler& operator=(const error_collecting_handler&) = delete;
+		//////
+		/// @brief Move-constructs a ztd::text::error_collecting_handler object.
+		error_collecting_handler(error_collecting_handler&&) = default;
+		//////
+		/// @brief Move-assigns a ztd::text::error_collecting_handler object.
+		error_collecting_handler& operator=(error_collecting_handler&&) = default;
+
+		//////
+		/// @brief Returns the base error handler that is called after an error has been recorded.
+		constexpr _ErrorHandler& base() & noexcept {
+			return this->__error_handler_base_t::get_value();
+		}
+
+		//////
+		/// @brief Returns the base error handler that is called after an error has been recorded.
+		constexpr const _ErrorHandler& base() const& noexcept {
+			return this->__error_handler_base_t::get_value();
+		}
+
+		//////
+		/// @brief Returns the base error handler that is called after an error has been recorded.
+		constexpr _ErrorHandler&& base() && noexcept {
+			return ::std::move(this->__error_handler_base_t::get_value());
+		}
+
+		//////
+		/// @brief Records the error, then invokes the error handler this object was constructed with.
+		///
+		/// @param[in] __encoding The Encoding that experienced the error.
+		/// @param[in] __result The current state of the encode or decode operation.
+		/// @param[in] __input_progress Any code units or code points that were read but not yet used before the
+		/// failure occurred.
+		/// @param[in] __output_progress Any code points or code units that have not yet been written before the
+		/// failure occurred.
+		template <typename _Encoding, typename _Result, typename _InputProgress, typename _OutputProgress>
+		constexpr auto operator()(const _Encoding& __encoding, _Result __result,
+			const _InputProgress& __input_progress,
+			const _OutputProgress& __output_progress) const& // cf
+			noexcept(::std::is_nothrow_invocable_v<const _ErrorHandler&, const _Encoding&, _Result&&,
+			     const _InputProgress&, const _OutputProgress&>) {
+			this->_M_record(__result, __input_progress);
+			return this->__error_handler_base_t::get_value()(
+				__encoding, ::std::move(__result), __input_progress, __output_progress);
+		}
+
+		//////
+		/// @brief Records the error, then invokes the error handler this object was constructed with.
+		///
+		/// @param[in] __encoding The Encoding that experienced the error.
+		/// @param[in] __result The current state of the encode or decode operation.
+		/// @param[in] __input_progress Any code units or code points that were read but not yet used before the
+		/// failure occurred.
+		/// @param[in] __output_progress Any code points or code units that have not yet been written before the
+		/// failure occurred.
+		template <typename _Encoding, typename _Result, typename _InputProgress, typename _OutputProgress>
+		constexpr auto operator()(const _Encoding& __encoding, _Result __result,
+			const _InputProgress& __input_progress,
+			const _OutputProgress& __output_progress) & // cf
+			noexcept(::std::is_nothrow_invocable_v<_ErrorHandler&, const _Encoding&, _Result&&,
+			     const _InputProgress&, const _OutputProgress&>) {
+			this->_M_record(__result, __input_progress);
+			return this->__error_handler_base_t::get_value()(
+				__encoding, ::std::move(__result), __input_progress, __output_progress);
+		}
+
+		//////
+		/// @brief Records the error, then invokes the error handler this object was constructed with.
+		///
+		/// @param[in] __encoding The Encoding that experienced the error.
+		/// @param[in] __result The current state of the encode or decode operation.
+		/// @param[in] __input_progress Any code units or code points that were read but not yet used before the
+		/// failure occurred.
+		/// @param[in] __output_progress Any code points or code units that have not yet been written before the
+		/// failure occurred.
+		template <typename _Encoding, typename _Result, typename _InputProgress, typename _OutputProgress>
+		constexpr auto operator()(const _Encoding& __encoding, _Result __result,
+			const _InputProgress& __input_progress,
+			const _OutputProgress& __output_progress) && // cf
+			noexcept(::std::is_nothrow_invocable_v<_ErrorHandler&&, const _Encoding&, _Result&&,
+			     const _InputProgress&, const _OutputProgress&>) {
+			this->_M_record(__result, __input_progress);
+			return ::std::move(this->__error_handler_base_t::get_value())(
+				__encoding, ::std::move(__result), __input_progress, __output_progress);
+		}
+
+		//////
+		/// @brief The errors that have been written down so far, in the order they occurred.
+		constexpr ::ztd::span<error_record> records() const noexcept {
+			return this->_M_records.first(
+				this->_M_error_count < this->_M_records.size() ? this->_M_error_count : this->_M_records.size());
+		}
+
+		//////
+		/// @brief The number of errors seen so far, including the ones that did not fit in the buffer.
+		constexpr ::std::size_t error_count() const noexcept {
+			return this->_M_error_count;
+		}
+
+		//////
+		/// @brief Whether or not more errors were seen than could be written down.
+		constexpr bool overflowed() const noexcept {
+			return this->_M_error_count > this->_M_records.size();
+		}
+
+		//////
+		/// @brief Forgets all recorded errors, so the buffer can be reused for a new input.
+		///
+		/// @param[in] __input_size The size of the new input.
+		constexpr void reset(::std::size_t __input_size) noexcept {
+			this->_M_input_size  = __input_size;
+			this->_M_error_count = 0;
+		}
+
+	private:
+		template <typename _Result, typename _InputProgress>
+		constexpr void _M_record(const _Result& __result, const _InputProgress& __input_progress) const noexcept {
+			static_assert(ranges::is_sized_range_v<decltype(__result.input)>,
+				"the input must be a sized range to be able to compute where errors occurred");
+			if (__result.error_code == encoding_error::insufficient_output_space) {
+				return;
+			}
+			const ::std::size_t __index = this->_M_error_count;
+			++this->_M_error_count;
+			if (__index >= this->_M_records.size()) {
+				return;
+			}
+			const ::std::size_t __input_length
+				= static_cast<::std::size_t>(ranges::ranges_adl::adl_size(__input_progress));
+			const ::std::size_t __consumed_size
+				= static_cast<::std::size_t>(ranges::ranges_adl::adl_size(__result.input)) + __input_length;
+			ZTD_TEXT_ASSERT_MESSAGE("the error handler was given more input than it was constructed with",
+				__consumed_size <= this->_M_input_size);
+			this->_M_records[__index]
+				= error_record { this->_M_input_size - __consumed_size, __result.error_code, __input_length };
+		}
+
+		::ztd::span<error_record> _M_records;
+		::std::size_t _M_input_size;
+		mutable ::std::size_t _M_error_count;
+	};
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_ERROR_COLLECTING_HANDLER_HPP
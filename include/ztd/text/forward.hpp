@@ -149,6 +149,14 @@ namespace ztd { namespace text {
 	constexpr auto encode_one_into(_Input&& __input, _Encoding&& __encoding, _Output&& __output,
 		_ErrorHandler&& __error_handler, _State& __state);
 
+	template <typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler, typename _State>
+	constexpr auto decode_into(_Input&& __input, _Encoding&& __encoding, _Output&& __output,
+		_ErrorHandler&& __error_handler, _State& __state);
+
+	template <typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler, typename _State>
+	constexpr auto encode_into(_Input&& __input, _Encoding&& __encoding, _Output&& __output,
+		_ErrorHandler&& __error_handler, _State& __state);
+
 	template <typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler, typename _State>
 	constexpr auto basic_decode_into(_Input&& __input, _Encoding&& __encoding, _Output&& __output,
 		_ErrorHandler&& __error_handler, _State& __state);
@@ -35,6 +35,7 @@
 
 #include <ztd/text/version.hpp>
 
+#include <ztd/text/forward.hpp>
 #include <ztd/text/encode_result.hpp>
 #include <ztd/text/decode_result.hpp>
 #include <ztd/text/encoding_error.hpp>
@@ -44,13 +45,18 @@
 #include <ztd/text/utf8.hpp>
 #include <ztd/text/utf16.hpp>
 #include <ztd/text/assert.hpp>
+#include <ztd/text/locale_encoding.hpp>
+#include <ztd/text/scratch_memory.hpp>
 #include <ztd/text/detail/progress_handler.hpp>
 #include <ztd/text/detail/encoding_name.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
 
 #include <ztd/ranges/range.hpp>
 #include <ztd/idk/span.hpp>
 #include <ztd/idk/encoding_detection.hpp>
 #include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/char_traits.hpp>
 #include <ztd/idk/detail/windows.hpp>
 
 #if (ZTD_IS_ON(ZTD_CUCHAR) || ZTD_IS_ON(ZTD_UCHAR)) && ZTD_IS_OFF(ZTD_PLATFORM_MAC_OS)
@@ -66,6 +72,7 @@ extern "C" {
 // clang-format on
 #include <cwchar>
 #include <cstdint>
+#include <string>
 
 #include <ztd/prologue.hpp>
 
@@ -190,7 +197,7 @@ namespace ztd { namespace text {
 			/// platform-specific means (such as `nl_langinfo` for POSIX, ACP probing on Windows, or fallin back to
 			/// `std::setlocale` name checking otherwise).
 			static bool contains_unicode_encoding() noexcept {
-				return ztd::is_execution_encoding_unicode();
+				return __txt_detail::__is_execution_encoding_unicode();
 			}
 
 			//////
@@ -225,7 +232,7 @@ namespace ztd { namespace text {
 					= __txt_detail::__reconstruct_encode_result_t<_InputRange, _OutputRange, encode_state>;
 				constexpr bool __call_error_handler = !is_ignorable_error_handler_v<_UErrorHandler>;
 
-				if (ztd::is_execution_encoding_utf8()) {
+				if (__txt_detail::__is_execution_encoding_utf8()) {
 					// just go straight to UTF8
 					using __execution_utf8 = __txt_impl::__utf8_with<__execution_cuchar, code_unit, code_point,
 						decode_state, encode_state>;
@@ -427,7 +434,7 @@ namespace ztd { namespace text {
 					= __txt_detail::__reconstruct_decode_result_t<_InputRange, _OutputRange, decode_state>;
 				constexpr bool __call_error_handler = !is_ignorable_error_handler_v<_UErrorHandler>;
 
-				if (ztd::is_execution_encoding_utf8()) {
+				if (__txt_detail::__is_execution_encoding_utf8()) {
 					// just go straight to UTF8
 					using __execution_utf8 = __txt_impl::__utf8_with<__execution_cuchar, code_unit, code_point,
 						decode_state, encode_state>;
@@ -669,6 +676,327 @@ namespace ztd { namespace text {
 						__s, encoding_error::ok);
 				}
 			}
+
+		private:
+#if ZTD_IS_OFF(ZTD_PLATFORM_WINDOWS) && ZTD_IS_ON(ZTD_WCHAR_T_UTF32_COMPATIBLE)
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static auto _S_decode_chunks(_InputRange&& __input, _OutputRange&& __output,
+				_ErrorHandler&& __error_handler, decode_state& __s, ::ztd::span<code_unit> __narrow_buffer,
+				::ztd::span<wchar_t> __wide_buffer) {
+				using _UInputRange   = remove_cvref_t<_InputRange>;
+				using _UOutputRange  = remove_cvref_t<_OutputRange>;
+				using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+				using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+				using _Result        = decode_result<_WorkingInput, _WorkingOutput, decode_state>;
+
+				// both chunks keep room for a null terminator after the code units being converted
+				const ::std::size_t __narrow_max = __narrow_buffer.size();
+				const ::std::size_t __wide_max   = __wide_buffer.size();
+				const ::std::size_t __chunk_max  = (__narrow_max < __wide_max ? __narrow_max : __wide_max) - 1;
+				code_unit* const __narrow_chunk  = __narrow_buffer.data();
+				wchar_t* const __wide_chunk      = __wide_buffer.data();
+
+				_WorkingInput __working_input = ranges::reconstruct(
+					::std::in_place_type<_UInputRange>, ::std::forward<_InputRange>(__input));
+				_WorkingOutput __working_output = ranges::reconstruct(
+					::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output));
+				::std::size_t __handled_errors = 0;
+				for (;;) {
+					if (ranges::ranges_adl::adl_empty(__working_input)) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __s,
+							encoding_error::ok, __handled_errors);
+					}
+					const ::std::size_t __input_size  = ranges::ranges_adl::adl_size(__working_input);
+					const ::std::size_t __output_size = ranges::ranges_adl::adl_size(__working_output);
+					::std::size_t __read_count        = 0;
+					::std::size_t __written_count     = 0;
+					if (!__s.__output_pending && __output_size > 0) {
+						// every character takes at least one code unit, so this many code units always fit
+						::std::size_t __chunk_size = __input_size < __chunk_max ? __input_size : __chunk_max;
+						__chunk_size               = __output_size < __chunk_size ? __output_size : __chunk_size;
+						::std::char_traits<code_unit>::copy(
+							__narrow_chunk, ranges::ranges_adl::adl_data(__working_input), __chunk_size);
+						__narrow_chunk[__chunk_size]             = '\0';
+						const ::std::mbstate_t __preserved_state = __s.__narrow_state;
+						const code_unit* __chunk_read            = __narrow_chunk;
+						::std::size_t __res
+							= ::std::mbsrtowcs(__wide_chunk, &__chunk_read, __chunk_size, &__s.__narrow_state);
+						if (__res == static_cast<::std::size_t>(-1)) {
+							// everything before the bad sequence is fine, but how much got written (and the
+							// state) is now unspecified: go back and convert just that part again
+							__read_count       = static_cast<::std::size_t>(__chunk_read - __narrow_chunk);
+							__s.__narrow_state = __preserved_state;
+							if (__read_count > 0) {
+								__narrow_chunk[__read_count] = '\0';
+								__chunk_read                 = __narrow_chunk;
+								__res                        = ::std::mbsrtowcs(
+									__wide_chunk, &__chunk_read, __chunk_size, &__s.__narrow_state);
+								ZTD_TEXT_ASSERT_I_(__res != static_cast<::std::size_t>(-1));
+								__written_count = __res;
+							}
+						}
+						else if (__chunk_read == nullptr) {
+							// stopped on a null character: either ours, or one that was in the input (in which
+							// case it has been converted and stored, too)
+							__read_count    = ::std::char_traits<code_unit>::length(__narrow_chunk);
+							__written_count = __res;
+							if (__read_count < __chunk_size) {
+								++__read_count;
+								++__written_count;
+							}
+						}
+						else {
+							// ran out of room or ended on an incomplete sequence: stop just after the last
+							// character
+							__read_count    = static_cast<::std::size_t>(__chunk_read - __narrow_chunk);
+							__written_count = __res;
+						}
+					}
+					if (__read_count == 0) {
+						// could not make any progress in bulk (an error, a sequence cut off at the end, no
+						// room left, or pending output): do exactly one with the usual machinery, which gives the
+						// error handler everything it expects
+						auto __one_result = decode_one(
+							::std::move(__working_input), ::std::move(__working_output), __error_handler, __s);
+						__handled_errors += __one_result.handled_errors;
+						if (__one_result.error_code != encoding_error::ok) {
+							return _Result(::std::move(__one_result.input), ::std::move(__one_result.output),
+								__s, __one_result.error_code, __handled_errors);
+						}
+						__working_input  = ::std::move(__one_result.input);
+						__working_output = ::std::move(__one_result.output);
+						continue;
+					}
+					auto __out_it = ranges::ranges_adl::adl_data(__working_output);
+					for (::std::size_t __index = 0; __index < __written_count; ++__index, (void)++__out_it) {
+						*__out_it = static_cast<code_point>(static_cast<char32_t>(__wide_chunk[__index]));
+					}
+					__working_input  = ranges::reconstruct(::std::in_place_type<_UInputRange>,
+						 ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+						 ranges::ranges_adl::adl_end(__working_input));
+					__working_output = ranges::reconstruct(::std::in_place_type<_UOutputRange>,
+						ranges::ranges_adl::adl_begin(__working_output) + __written_count,
+						ranges::ranges_adl::adl_end(__working_output));
+				}
+			}
+#endif
+
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static auto _S_decode(_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler,
+				decode_state& __s) {
+				using _UInputRange   = remove_cvref_t<_InputRange>;
+				using _UOutputRange  = remove_cvref_t<_OutputRange>;
+				using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+				using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+				using _Result        = decode_result<_WorkingInput, _WorkingOutput, decode_state>;
+
+				if (__txt_detail::__is_execution_encoding_utf8() && !__s.__output_pending
+					&& ::std::mbsinit(::std::addressof(__s.__narrow_state)) != 0) {
+					// check once for the whole input, then let UTF-8 do all of the work; but the UTF-8 encoding
+					// knows nothing of a sequence the C library is partway through, so only from the initial state
+					using __execution_utf8 = __txt_impl::__utf8_with<__execution_cuchar, code_unit, code_point,
+						decode_state, encode_state>;
+					auto __result = ::ztd::text::decode_into(::std::forward<_InputRange>(__input),
+						__execution_utf8 {}, ::std::forward<_OutputRange>(__output),
+						::std::forward<_ErrorHandler>(__error_handler), __s);
+					return _Result(
+						ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::move(__result.input)),
+						ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::move(__result.output)),
+						__s, __result.error_code, __result.handled_errors);
+				}
+#if ZTD_IS_OFF(ZTD_PLATFORM_WINDOWS) && ZTD_IS_ON(ZTD_WCHAR_T_UTF32_COMPATIBLE)
+				// wchar_t is UTF-32 here, so the C library's multi-character conversion can do whole chunks at once
+				constexpr ::std::size_t __chunk_max = ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(wchar_t);
+				return __txt_detail::__with_scratch_buffer<code_unit, __chunk_max + 1, 2>(
+					[&](::ztd::span<code_unit> __narrow_chunk) {
+						return __txt_detail::__with_scratch_buffer<wchar_t, __chunk_max + 1, 2>(
+							[&](::ztd::span<wchar_t> __wide_chunk) {
+								return _S_decode_chunks(::std::forward<_InputRange>(__input),
+									::std::forward<_OutputRange>(__output), __error_handler, __s,
+									__narrow_chunk, __wide_chunk);
+							});
+					});
+#else
+				auto __result = ::ztd::text::basic_decode_into(::std::forward<_InputRange>(__input),
+					__execution_cuchar {}, ::std::forward<_OutputRange>(__output),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+				return _Result(ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::move(__result.input)),
+					ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::move(__result.output)), __s,
+					__result.error_code, __result.handled_errors);
+#endif
+			}
+
+#if ZTD_IS_OFF(ZTD_PLATFORM_WINDOWS) && ZTD_IS_ON(ZTD_WCHAR_T_UTF32_COMPATIBLE)
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static auto _S_encode_chunks(_InputRange&& __input, _OutputRange&& __output,
+				_ErrorHandler&& __error_handler, encode_state& __s, ::ztd::span<wchar_t> __wide_buffer,
+				::ztd::span<code_unit> __narrow_buffer) {
+				using _UInputRange   = remove_cvref_t<_InputRange>;
+				using _UOutputRange  = remove_cvref_t<_OutputRange>;
+				using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+				using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+				using _Result        = encode_result<_WorkingInput, _WorkingOutput, encode_state>;
+
+				// the wide chunk keeps room for a null terminator after the code points being converted
+				const ::std::size_t __chunk_max        = __wide_buffer.size() - 1;
+				const ::std::size_t __narrow_chunk_max = __narrow_buffer.size();
+				wchar_t* const __wide_chunk            = __wide_buffer.data();
+				code_unit* const __narrow_chunk        = __narrow_buffer.data();
+
+				_WorkingInput __working_input = ranges::reconstruct(
+					::std::in_place_type<_UInputRange>, ::std::forward<_InputRange>(__input));
+				_WorkingOutput __working_output = ranges::reconstruct(
+					::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output));
+				::std::size_t __handled_errors = 0;
+				for (;;) {
+					if (ranges::ranges_adl::adl_empty(__working_input)) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __s,
+							encoding_error::ok, __handled_errors);
+					}
+					const ::std::size_t __input_size  = ranges::ranges_adl::adl_size(__working_input);
+					const ::std::size_t __output_size = ranges::ranges_adl::adl_size(__working_output);
+					::std::size_t __read_count        = 0;
+					::std::size_t __written_count     = 0;
+					if (__output_size > 0) {
+						const ::std::size_t __chunk_size
+							= __input_size < __chunk_max ? __input_size : __chunk_max;
+						const ::std::size_t __narrow_size
+							= __output_size < __narrow_chunk_max ? __output_size : __narrow_chunk_max;
+						auto __in_it = ranges::ranges_adl::adl_data(__working_input);
+						for (::std::size_t __index = 0; __index < __chunk_size; ++__index, (void)++__in_it) {
+							__wide_chunk[__index] = static_cast<wchar_t>(static_cast<char32_t>(*__in_it));
+						}
+						__wide_chunk[__chunk_size]               = L'\0';
+						const ::std::mbstate_t __preserved_state = __s.__narrow_state;
+						const wchar_t* __chunk_read              = __wide_chunk;
+						::std::size_t __res                      = ::std::wcsrtombs(
+							__narrow_chunk, &__chunk_read, __narrow_size, &__s.__narrow_state);
+						if (__res == static_cast<::std::size_t>(-1)) {
+							// everything before the bad code point is fine, but how much got written (and the
+							// state) is now unspecified: go back and convert just that part again
+							__read_count       = static_cast<::std::size_t>(__chunk_read - __wide_chunk);
+							__s.__narrow_state = __preserved_state;
+							if (__read_count > 0) {
+								__wide_chunk[__read_count] = L'\0';
+								__chunk_read               = __wide_chunk;
+								__res                      = ::std::wcsrtombs(
+									__narrow_chunk, &__chunk_read, __narrow_size, &__s.__narrow_state);
+								ZTD_TEXT_ASSERT_I_(__res != static_cast<::std::size_t>(-1));
+								__written_count = __res;
+							}
+						}
+						else if (__chunk_read == nullptr) {
+							// stopped on a null character: either ours, or one that was in the input (in which
+							// case it has been converted and stored, too)
+							__read_count    = ::std::char_traits<wchar_t>::length(__wide_chunk);
+							__written_count = __res;
+							if (__read_count < __chunk_size) {
+								++__read_count;
+								++__written_count;
+							}
+						}
+						else {
+							// ran out of room: stop just after the last character
+							__read_count    = static_cast<::std::size_t>(__chunk_read - __wide_chunk);
+							__written_count = __res;
+						}
+					}
+					if (__read_count == 0) {
+						// could not make any progress in bulk (an error or no room left): do exactly one with the
+						// usual machinery, which gives the error handler everything it expects
+						auto __one_result = encode_one(
+							::std::move(__working_input), ::std::move(__working_output), __error_handler, __s);
+						__handled_errors += __one_result.handled_errors;
+						if (__one_result.error_code != encoding_error::ok) {
+							return _Result(::std::move(__one_result.input), ::std::move(__one_result.output),
+								__s, __one_result.error_code, __handled_errors);
+						}
+						__working_input  = ::std::move(__one_result.input);
+						__working_output = ::std::move(__one_result.output);
+						continue;
+					}
+					::std::char_traits<code_unit>::copy(
+						ranges::ranges_adl::adl_data(__working_output), __narrow_chunk, __written_count);
+					__working_input  = ranges::reconstruct(::std::in_place_type<_UInputRange>,
+						 ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+						 ranges::ranges_adl::adl_end(__working_input));
+					__working_output = ranges::reconstruct(::std::in_place_type<_UOutputRange>,
+						ranges::ranges_adl::adl_begin(__working_output) + __written_count,
+						ranges::ranges_adl::adl_end(__working_output));
+				}
+			}
+#endif
+
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static auto _S_encode(_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler,
+				encode_state& __s) {
+				using _UInputRange   = remove_cvref_t<_InputRange>;
+				using _UOutputRange  = remove_cvref_t<_OutputRange>;
+				using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+				using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+				using _Result        = encode_result<_WorkingInput, _WorkingOutput, encode_state>;
+
+				if (__txt_detail::__is_execution_encoding_utf8() && !__s.__output_pending
+					&& ::std::mbsinit(::std::addressof(__s.__narrow_state)) != 0) {
+					// check once for the whole input, then let UTF-8 do all of the work; but the UTF-8 encoding
+					// knows nothing of a sequence the C library is partway through, so only from the initial state
+					using __execution_utf8 = __txt_impl::__utf8_with<__execution_cuchar, code_unit, code_point,
+						decode_state, encode_state>;
+					auto __result = ::ztd::text::encode_into(::std::forward<_InputRange>(__input),
+						__execution_utf8 {}, ::std::forward<_OutputRange>(__output),
+						::std::forward<_ErrorHandler>(__error_handler), __s);
+					return _Result(
+						ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::move(__result.input)),
+						ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::move(__result.output)),
+						__s, __result.error_code, __result.handled_errors);
+				}
+#if ZTD_IS_OFF(ZTD_PLATFORM_WINDOWS) && ZTD_IS_ON(ZTD_WCHAR_T_UTF32_COMPATIBLE)
+				// wchar_t is UTF-32 here, so the C library's multi-character conversion can do whole chunks at once
+				constexpr ::std::size_t __chunk_max        = ZTD_TEXT_INTERMEDIATE_ENCODE_BUFFER_SIZE_I_(wchar_t);
+				constexpr ::std::size_t __narrow_chunk_max = ZTD_TEXT_INTERMEDIATE_ENCODE_BUFFER_SIZE_I_(code_unit);
+				return __txt_detail::__with_scratch_buffer<wchar_t, __chunk_max + 1, 2>(
+					[&](::ztd::span<wchar_t> __wide_chunk) {
+						return __txt_detail::__with_scratch_buffer<code_unit, __narrow_chunk_max, max_code_units>(
+							[&](::ztd::span<code_unit> __narrow_chunk) {
+								return _S_encode_chunks(::std::forward<_InputRange>(__input),
+									::std::forward<_OutputRange>(__output), __error_handler, __s, __wide_chunk,
+									__narrow_chunk);
+							});
+					});
+#else
+				auto __result = ::ztd::text::basic_encode_into(::std::forward<_InputRange>(__input),
+					__execution_cuchar {}, ::std::forward<_OutputRange>(__output),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+				return _Result(ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::move(__result.input)),
+					ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::move(__result.output)), __s,
+					__result.error_code, __result.handled_errors);
+#endif
+			}
+
+			// Bulk conversions: the locale is checked once per call rather than once per code point, and then
+			// either UTF-8 or the C library's multi-character conversion functions do the work for contiguous
+			// input and output.
+			template <typename _Self, typename _InputRange, typename _OutputRange, typename _ErrorHandler,
+				::std::enable_if_t<::std::is_base_of_v<__execution_cuchar, _Self>                       // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_InputRange, code_unit>                // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_OutputRange, code_point>>* = nullptr> // cf
+			friend auto __text_decode(::ztd::tag<_Self>, _InputRange&& __input,
+				type_identity_t<const __execution_cuchar&>, _OutputRange&& __output,
+				_ErrorHandler&& __error_handler, decode_state& __s) {
+				return _S_decode(::std::forward<_InputRange>(__input), ::std::forward<_OutputRange>(__output),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+			}
+
+			template <typename _Self, typename _InputRange, typename _OutputRange, typename _ErrorHandler,
+				::std::enable_if_t<::std::is_base_of_v<__execution_cuchar, _Self>                      // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_InputRange, code_point>              // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_OutputRange, code_unit>>* = nullptr> // cf
+			friend auto __text_encode(::ztd::tag<_Self>, _InputRange&& __input,
+				type_identity_t<const __execution_cuchar&>, _OutputRange&& __output,
+				_ErrorHandler&& __error_handler, encode_state& __s) {
+				return _S_encode(::std::forward<_InputRange>(__input), ::std::forward<_OutputRange>(__output),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+			}
 		};
 	} // namespace __txt_impl
 
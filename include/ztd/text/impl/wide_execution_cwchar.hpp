@@ -41,6 +41,7 @@
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/unicode_code_point.hpp>
 #include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/locale_encoding.hpp>
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/progress_handler.hpp>
 
@@ -182,10 +183,10 @@ namespace ztd { namespace text {
 			static bool contains_unicode_encoding() noexcept {
 				// even if the wide encoding is unicode, we have to round-trip through the execution encoding, so if
 				// this doesn't work then nothing works with all unicode code points!
-				if (!ztd::is_execution_encoding_unicode()) {
+				if (!__txt_detail::__is_execution_encoding_unicode()) {
 					return false;
 				}
-				return ztd::is_wide_execution_encoding_unicode();
+				return __txt_detail::__is_wide_execution_encoding_unicode();
 			}
 
 			//////
@@ -35,19 +35,29 @@
 
 #include <ztd/text/version.hpp>
 
+#include <ztd/text/forward.hpp>
 #include <ztd/text/execution.hpp>
+#include <ztd/text/utf8.hpp>
+#include <ztd/text/utf16.hpp>
+#include <ztd/text/utf32.hpp>
 #include <ztd/text/encode_result.hpp>
 #include <ztd/text/decode_result.hpp>
+#include <ztd/text/transcode_result.hpp>
+#include <ztd/text/pivot.hpp>
 #include <ztd/text/is_ignorable_error_handler.hpp>
 #include <ztd/text/is_unicode_encoding.hpp>
 #include <ztd/text/is_full_range_representable.hpp>
+#include <ztd/text/scratch_memory.hpp>
 #include <ztd/text/detail/progress_handler.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
 
 #include <ztd/ranges/range.hpp>
 #include <ztd/idk/span.hpp>
 #include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/tag.hpp>
 
 #include <cwchar>
+#include <cstddef>
 #include <iterator>
 #include <utility>
 
@@ -147,6 +157,255 @@ namespace ztd { namespace text {
 				return __base_encoding.encode_one(::std::forward<_InputRange>(__input),
 					::std::forward<_OutputRange>(__output), ::std::forward<_ErrorHandler>(__error_handler), __s);
 			}
+
+		private:
+			// A wchar_t here is a UTF-32 code unit, so the only thing that can go wrong with one is that it is a
+			// surrogate or past the last code point. That makes it cheap to check a whole block of them first and
+			// then move the valid part over in one go, only going through decode_one / encode_one (and the error
+			// handler) for the values that fail the check.
+			template <typename _Pointer>
+			static constexpr ::std::size_t _S_valid_prefix(_Pointer __first, ::std::size_t __size) noexcept {
+				::std::size_t __index = 0;
+				for (; __index < __size; ++__index) {
+					const char32_t __value = static_cast<char32_t>(__first[__index]);
+					if (__value > __ztd_idk_detail_last_unicode_code_point
+						|| __ztd_idk_detail_is_surrogate(__value)) {
+						break;
+					}
+				}
+				return __index;
+			}
+
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static constexpr auto _S_decode(
+				_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler, decode_state& __s) {
+				using _UInputRange   = remove_cvref_t<_InputRange>;
+				using _UOutputRange  = remove_cvref_t<_OutputRange>;
+				using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+				using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+				using _Result        = decode_result<_WorkingInput, _WorkingOutput, decode_state>;
+
+				_WorkingInput __working_input
+					= ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::forward<_InputRange>(__input));
+				_WorkingOutput __working_output
+					= ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output));
+				::std::size_t __handled_errors = 0;
+				for (;;) {
+					const ::std::size_t __input_size  = ranges::ranges_adl::adl_size(__working_input);
+					const ::std::size_t __output_size = ranges::ranges_adl::adl_size(__working_output);
+					const auto __in_first             = ranges::ranges_adl::adl_data(__working_input);
+					const ::std::size_t __valid_size
+						= _S_valid_prefix(__in_first, __input_size < __output_size ? __input_size : __output_size);
+					auto __out_first = ranges::ranges_adl::adl_data(__working_output);
+					for (::std::size_t __index = 0; __index < __valid_size; ++__index) {
+						__out_first[__index] = static_cast<code_point>(static_cast<char32_t>(__in_first[__index]));
+					}
+					__working_input  = ranges::reconstruct(::std::in_place_type<_UInputRange>,
+						 ranges::ranges_adl::adl_begin(__working_input) + __valid_size,
+						 ranges::ranges_adl::adl_end(__working_input));
+					__working_output = ranges::reconstruct(::std::in_place_type<_UOutputRange>,
+						ranges::ranges_adl::adl_begin(__working_output) + __valid_size,
+						ranges::ranges_adl::adl_end(__working_output));
+					if (ranges::ranges_adl::adl_empty(__working_input)) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __s,
+							encoding_error::ok, __handled_errors);
+					}
+					// a bad code unit, or no more room: let the usual machinery handle (and report) it
+					auto __one_result
+						= decode_one(::std::move(__working_input), ::std::move(__working_output), __error_handler, __s);
+					__handled_errors += __one_result.handled_errors;
+					if (__one_result.error_code != encoding_error::ok) {
+						return _Result(::std::move(__one_result.input), ::std::move(__one_result.output), __s,
+							__one_result.error_code, __handled_errors);
+					}
+					__working_input  = ::std::move(__one_result.input);
+					__working_output = ::std::move(__one_result.output);
+				}
+			}
+
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static constexpr auto _S_encode(
+				_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler, encode_state& __s) {
+				using _UInputRange   = remove_cvref_t<_InputRange>;
+				using _UOutputRange  = remove_cvref_t<_OutputRange>;
+				using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+				using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+				using _Result        = encode_result<_WorkingInput, _WorkingOutput, encode_state>;
+
+				_WorkingInput __working_input
+					= ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::forward<_InputRange>(__input));
+				_WorkingOutput __working_output
+					= ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output));
+				::std::size_t __handled_errors = 0;
+				for (;;) {
+					const ::std::size_t __input_size  = ranges::ranges_adl::adl_size(__working_input);
+					const ::std::size_t __output_size = ranges::ranges_adl::adl_size(__working_output);
+					const auto __in_first             = ranges::ranges_adl::adl_data(__working_input);
+					const ::std::size_t __valid_size
+						= _S_valid_prefix(__in_first, __input_size < __output_size ? __input_size : __output_size);
+					auto __out_first = ranges::ranges_adl::adl_data(__working_output);
+					for (::std::size_t __index = 0; __index < __valid_size; ++__index) {
+						__out_first[__index] = static_cast<code_unit>(static_cast<char32_t>(__in_first[__index]));
+					}
+					__working_input  = ranges::reconstruct(::std::in_place_type<_UInputRange>,
+						 ranges::ranges_adl::adl_begin(__working_input) + __valid_size,
+						 ranges::ranges_adl::adl_end(__working_input));
+					__working_output = ranges::reconstruct(::std::in_place_type<_UOutputRange>,
+						ranges::ranges_adl::adl_begin(__working_output) + __valid_size,
+						ranges::ranges_adl::adl_end(__working_output));
+					if (ranges::ranges_adl::adl_empty(__working_input)) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __s,
+							encoding_error::ok, __handled_errors);
+					}
+					auto __one_result
+						= encode_one(::std::move(__working_input), ::std::move(__working_output), __error_handler, __s);
+					__handled_errors += __one_result.handled_errors;
+					if (__one_result.error_code != encoding_error::ok) {
+						return _Result(::std::move(__one_result.input), ::std::move(__one_result.output), __s,
+							__one_result.error_code, __handled_errors);
+					}
+					__working_input  = ::std::move(__one_result.input);
+					__working_output = ::std::move(__one_result.output);
+				}
+			}
+
+			template <typename _InputRange, typename _ToEncoding, typename _OutputRange, typename _FromErrorHandler,
+				typename _ToErrorHandler, typename _ToState, typename _IntermediatePoint>
+			static constexpr auto _S_transcode_blocks(_InputRange&& __input, const _ToEncoding& __to_encoding,
+				_OutputRange&& __output, _FromErrorHandler&& __from_error_handler,
+				_ToErrorHandler&& __to_error_handler, decode_state& __from_state, _ToState& __to_state,
+				::ztd::span<_IntermediatePoint> __block_buffer) {
+				using _UInputRange   = remove_cvref_t<_InputRange>;
+				using _UOutputRange  = remove_cvref_t<_OutputRange>;
+				using _WorkingInput  = ranges::range_reconstruct_t<_UInputRange>;
+				using _WorkingOutput = ranges::range_reconstruct_t<_UOutputRange>;
+				using _Result        = transcode_result<_WorkingInput, _WorkingOutput, decode_state, _ToState>;
+				const ::std::size_t __block_max   = __block_buffer.size();
+				_IntermediatePoint* const __block = __block_buffer.data();
+
+				_WorkingInput __working_input
+					= ranges::reconstruct(::std::in_place_type<_UInputRange>, ::std::forward<_InputRange>(__input));
+				_WorkingOutput __working_output
+					= ranges::reconstruct(::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output));
+				::std::size_t __handled_errors = 0;
+				for (;;) {
+					if (ranges::ranges_adl::adl_empty(__working_input)) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+							__to_state, encoding_error::ok, __handled_errors);
+					}
+					const ::std::size_t __input_size = ranges::ranges_adl::adl_size(__working_input);
+					const auto __in_first            = ranges::ranges_adl::adl_data(__working_input);
+					const ::std::size_t __valid_size
+						= _S_valid_prefix(__in_first, __input_size < __block_max ? __input_size : __block_max);
+					if (__valid_size > 0) {
+						// the whole block is already known-good code points: hand all of it to the other encoding
+						for (::std::size_t __index = 0; __index < __valid_size; ++__index) {
+							__block[__index]
+								= static_cast<_IntermediatePoint>(static_cast<char32_t>(__in_first[__index]));
+						}
+						auto __encode_result = ::ztd::text::encode_into(
+							::ztd::span<const _IntermediatePoint>(__block, __valid_size), __to_encoding,
+							::std::move(__working_output), __to_error_handler, __to_state);
+						__handled_errors += __encode_result.handled_errors;
+						const ::std::size_t __read_count
+							= static_cast<::std::size_t>(__encode_result.input.data() - __block);
+						__working_input  = ranges::reconstruct(::std::in_place_type<_UInputRange>,
+							 ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+							 ranges::ranges_adl::adl_end(__working_input));
+						__working_output = ::std::move(__encode_result.output);
+						if (__encode_result.error_code != encoding_error::ok) {
+							return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+								__to_state, __encode_result.error_code, __handled_errors);
+						}
+						continue;
+					}
+					// a bad code unit at the very front: decode it with the usual machinery so the "from" error
+					// handler gets to deal with it, and then encode whatever that produced
+					code_point __intermediate_storage[max_code_points] {};
+					::ztd::span<code_point> __intermediate(__intermediate_storage);
+					// (keep the input where it was until the encode succeeds, so a failure reports the sequence that
+					// could not be transcoded)
+					auto __decode_result
+						= decode_one(__working_input, __intermediate, __from_error_handler, __from_state);
+					__handled_errors += __decode_result.handled_errors;
+					if (__decode_result.error_code != encoding_error::ok) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+							__to_state, __decode_result.error_code, __handled_errors);
+					}
+					::ztd::span<code_point> __decoded(
+						__intermediate_storage, __decode_result.output.data() - __intermediate_storage);
+					while (!__decoded.empty()) {
+						auto __encode_result = __to_encoding.encode_one(
+							::std::move(__decoded), ::std::move(__working_output), __to_error_handler, __to_state);
+						__handled_errors += __encode_result.handled_errors;
+						__working_output = ::std::move(__encode_result.output);
+						if (__encode_result.error_code != encoding_error::ok) {
+							return _Result(::std::move(__working_input), ::std::move(__working_output),
+								__from_state, __to_state, __encode_result.error_code, __handled_errors);
+						}
+						__decoded = ::std::move(__encode_result.input);
+					}
+					__working_input = ::std::move(__decode_result.input);
+				}
+			}
+
+			template <typename _InputRange, typename _ToEncoding, typename _OutputRange, typename _FromErrorHandler,
+				typename _ToErrorHandler, typename _ToState>
+			static constexpr auto _S_transcode(_InputRange&& __input, const _ToEncoding& __to_encoding,
+				_OutputRange&& __output, _FromErrorHandler&& __from_error_handler,
+				_ToErrorHandler&& __to_error_handler, decode_state& __from_state, _ToState& __to_state) {
+				using _IntermediatePoint = code_point_t<_ToEncoding>;
+				constexpr ::std::size_t __block_max = ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(_IntermediatePoint);
+
+				return __txt_detail::__with_scratch_buffer<_IntermediatePoint, __block_max, 1>(
+					[&](::ztd::span<_IntermediatePoint> __block) {
+						return _S_transcode_blocks(::std::forward<_InputRange>(__input), __to_encoding,
+							::std::forward<_OutputRange>(__output), __from_error_handler, __to_error_handler,
+							__from_state, __to_state, __block);
+					});
+			}
+
+			// Bulk conversions for contiguous input and output.
+			template <typename _Self, typename _InputRange, typename _OutputRange, typename _ErrorHandler,
+				::std::enable_if_t<::std::is_base_of_v<__wide_execution_iso10646, _Self>                // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_InputRange, code_unit>                // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_OutputRange, code_point>>* = nullptr> // cf
+			friend constexpr auto __text_decode(::ztd::tag<_Self>, _InputRange&& __input,
+				type_identity_t<const __wide_execution_iso10646&>, _OutputRange&& __output,
+				_ErrorHandler&& __error_handler, decode_state& __s) {
+				return _S_decode(::std::forward<_InputRange>(__input), ::std::forward<_OutputRange>(__output),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+			}
+
+			template <typename _Self, typename _InputRange, typename _OutputRange, typename _ErrorHandler,
+				::std::enable_if_t<::std::is_base_of_v<__wide_execution_iso10646, _Self>               // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_InputRange, code_point>              // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_OutputRange, code_unit>>* = nullptr> // cf
+			friend constexpr auto __text_encode(::ztd::tag<_Self>, _InputRange&& __input,
+				type_identity_t<const __wide_execution_iso10646&>, _OutputRange&& __output,
+				_ErrorHandler&& __error_handler, encode_state& __s) {
+				return _S_encode(::std::forward<_InputRange>(__input), ::std::forward<_OutputRange>(__output),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+			}
+
+			// Going to UTF-8 or UTF-16 does not need to decode anything first: check a block of code units, then
+			// encode all of them at once.
+			template <typename _Self, typename _ToSelf, typename _InputRange, typename _OutputRange,
+				typename _FromErrorHandler, typename _ToErrorHandler, typename _ToState, typename _PivotRange,
+				::std::enable_if_t<::std::is_base_of_v<__wide_execution_iso10646, _Self>                          // cf
+				     && (::std::is_base_of_v<__utf8_tag, _ToSelf> || ::std::is_base_of_v<__utf16_tag, _ToSelf>) // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_InputRange, code_unit>                          // cf
+				     && __txt_detail::__is_contiguous_range_of_v<_OutputRange, code_unit_t<_ToSelf>>>* = nullptr> // cf
+			friend constexpr auto __text_transcode(::ztd::tag<_Self, _ToSelf>, _InputRange&& __input,
+				type_identity_t<const __wide_execution_iso10646&>, _OutputRange&& __output,
+				type_identity_t<const _ToSelf&> __to_encoding, _FromErrorHandler&& __from_error_handler,
+				_ToErrorHandler&& __to_error_handler, decode_state& __from_state, _ToState& __to_state,
+				pivot<_PivotRange>& __pivot) {
+				(void)__pivot;
+				return _S_transcode(::std::forward<_InputRange>(__input), __to_encoding,
+					::std::forward<_OutputRange>(__output), ::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+			}
 		};
 
 	} // namespace __txt_impl
@@ -56,6 +56,12 @@ namespace ztd { namespace text {
 		inline constexpr bool __is_already_decoded_v = encoded_id_v<_FromEncoding> == decoded_id_v<_ToEncoding> // cf
 			     && decoded_id_v<_FromEncoding> != ::ztd::text_encoding_id::unknown                            // cf
 			     && encoded_id_v<_ToEncoding> != ::ztd::text_encoding_id::unknown;
+
+		template <typename _From, typename _To>
+		struct __is_decode_redundant : ::std::is_same<_From, _To> { };
+
+		template <typename _From, typename _To>
+		struct __is_encode_redundant : ::std::is_same<_From, _To> { };
 	} // namespace __txt_detail
 
 	//////
@@ -64,9 +70,15 @@ namespace ztd { namespace text {
 	/// @{
 
 	//////
-	/// @brief Whether or not the decode encoding is
+	/// @brief Whether or not decoding with the `_From` encoding and then encoding with the `_To` encoding leaves the
+	/// code units exactly as they were, meaning the decode step can be skipped entirely.
+	///
+	/// @remarks This is always true for identical encodings. Other pairs of encodings can opt into it (e.g.,
+	/// ztd::text::wide_execution_t and ztd::text::wide_utf32_t on platforms where `wchar_t` is UTF-32).
 	template <typename _From, typename _To>
-	using is_decode_redundant = ::std::is_same<::ztd::remove_cvref_t<_From>, ::ztd::remove_cvref_t<_To>>;
+	class is_decode_redundant
+	: public ::std::integral_constant<bool,
+		  __txt_detail::__is_decode_redundant<::ztd::remove_cvref_t<_From>, ::ztd::remove_cvref_t<_To>>::value> { };
 
 	//////
 	/// @brief An alias of the inner `value` for `ztd::text::is_decode_redundant<_From, _To>`.
@@ -74,9 +86,14 @@ namespace ztd { namespace text {
 	inline constexpr bool is_decode_redundant_v = is_decode_redundant<_From, _To>::value;
 
 	//////
-	/// @brief Whether or not the decode encoding is
+	/// @brief Whether or not encoding with the `_To` encoding the code points decoded by the `_From` encoding
+	/// produces exactly the code units that were decoded, meaning the encode step can be skipped entirely.
+	///
+	/// @remarks See ztd::text::is_decode_redundant.
 	template <typename _From, typename _To>
-	using is_encode_redundant = ::std::is_same<::ztd::remove_cvref_t<_From>, ::ztd::remove_cvref_t<_To>>;
+	class is_encode_redundant
+	: public ::std::integral_constant<bool,
+		  __txt_detail::__is_encode_redundant<::ztd::remove_cvref_t<_From>, ::ztd::remove_cvref_t<_To>>::value> { };
 
 	//////
 	/// @brief An alias of the inner `value` for `ztd::text::is_encode_redundant<_From, _To>`.
@@ -0,0 +1,128 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_LOCALE_ENCODING_HPP
+#define ZTD_TEXT_LOCALE_ENCODING_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/idk/encoding_detection.hpp>
+
+#if ZTD_IS_ON(ZTD_TEXT_LOCALE_ENCODING_CACHE)
+#include <atomic>
+#include <cstddef>
+#endif
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+#if ZTD_IS_ON(ZTD_TEXT_LOCALE_ENCODING_CACHE)
+		inline ::std::atomic<::std::size_t>& __locale_encoding_epoch() noexcept {
+			static ::std::atomic<::std::size_t> __epoch(1);
+			return __epoch;
+		}
+
+		struct __locale_encoding_cache {
+			::std::size_t _M_epoch         = 0;
+			bool _M_execution_unicode      = false;
+			bool _M_execution_utf8         = false;
+			bool _M_wide_execution_unicode = false;
+		};
+
+		inline const __locale_encoding_cache& __current_locale_encoding() noexcept {
+			thread_local __locale_encoding_cache __cache {};
+			const ::std::size_t __epoch = __locale_encoding_epoch().load(::std::memory_order_acquire);
+			if (__cache._M_epoch != __epoch) {
+				__cache._M_execution_unicode      = ::ztd::is_execution_encoding_unicode();
+				__cache._M_execution_utf8         = ::ztd::is_execution_encoding_utf8();
+				__cache._M_wide_execution_unicode = ::ztd::is_wide_execution_encoding_unicode();
+				__cache._M_epoch                  = __epoch;
+			}
+			return __cache;
+		}
+#endif
+
+		inline bool __is_execution_encoding_unicode() noexcept {
+#if ZTD_IS_ON(ZTD_TEXT_LOCALE_ENCODING_CACHE)
+			return __current_locale_encoding()._M_execution_unicode;
+#else
+			return ::ztd::is_execution_encoding_unicode();
+#endif
+		}
+
+		inline bool __is_execution_encoding_utf8() noexcept {
+#if ZTD_IS_ON(ZTD_TEXT_LOCALE_ENCODING_CACHE)
+			return __current_locale_encoding()._M_execution_utf8;
+#else
+			return ::ztd::is_execution_encoding_utf8();
+#endif
+		}
+
+		inline bool __is_wide_execution_encoding_unicode() noexcept {
+#if ZTD_IS_ON(ZTD_TEXT_LOCALE_ENCODING_CACHE)
+			return __current_locale_encoding()._M_wide_execution_unicode;
+#else
+			return ::ztd::is_wide_execution_encoding_unicode();
+#endif
+		}
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_properties Property and Trait Helpers
+	///
+	/// @{
+
+	//////
+	/// @brief Tells the library that the locale may have changed, so the next time the execution or wide execution
+	/// encodings need to know what the locale's encoding is, they ask the C library again.
+	///
+	/// @remarks This only matters when `ZTD_TEXT_LOCALE_ENCODING_CACHE` is turned on: the answers are then kept per
+	/// thread, so call this after any `setlocale` or `uselocale` call that should be respected. Otherwise, the locale
+	/// is queried every time and this does nothing.
+	inline void refresh_locale_encoding() noexcept {
+#if ZTD_IS_ON(ZTD_TEXT_LOCALE_ENCODING_CACHE)
+		__txt_detail::__locale_encoding_epoch().fetch_add(1, ::std::memory_order_acq_rel);
+#endif
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_LOCALE_ENCODING_HPP
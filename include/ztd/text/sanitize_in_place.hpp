@@ -0,0 +1,207 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_SANITIZE_IN_PLACE_HPP
+#define ZTD_TEXT_SANITIZE_IN_PLACE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/assert.hpp>
+#include <ztd/text/detail/in_place_routines.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_sanitize_in_place ztd::text::sanitize_in_place
+	/// @brief These functions replace the ill-formed sequences in UTF-8 text inside of the storage it is already in,
+	/// without allocating a second buffer for the output.
+	/// @{
+
+	//////
+	/// @brief The result of ztd::text::sanitize_in_place.
+	///
+	/// @tparam _Output The type of the sanitized text.
+	template <typename _Output>
+	class sanitize_result {
+	public:
+		//////
+		/// @brief The sanitized text: every ill-formed sequence in it has been replaced.
+		_Output output;
+		//////
+		/// @brief How many ill-formed sequences were replaced.
+		::std::size_t handled_errors;
+
+		//////
+		/// @brief Constructs a ztd::text::sanitize_result.
+		///
+		/// @param[in] __output The sanitized text.
+		/// @param[in] __handled_errors How many ill-formed sequences were replaced.
+		constexpr sanitize_result(_Output __output, ::std::size_t __handled_errors) noexcept(
+			::std::is_nothrow_move_constructible_v<_Output>)
+		: output(::std::move(__output)), handled_errors(__handled_errors) {
+		}
+
+		//////
+		/// @brief Whether or not any ill-formed sequences were found and replaced.
+		///
+		/// @remarks When this is `false`, the input was already well-formed and nothing was written to it.
+		constexpr bool errors_were_handled() const noexcept {
+			return this->handled_errors > 0;
+		}
+	};
+
+	//////
+	/// @brief Replaces every ill-formed sequence in the UTF-8 code units of `__buffer` with `__replacement`, moving
+	/// the well-formed text after it down to close the gap.
+	///
+	/// @param[in, out] __buffer The UTF-8 code units to sanitize.
+	/// @param[in] __replacement The code unit to put in place of each ill-formed sequence. It must be ASCII.
+	///
+	/// @returns A ztd::text::sanitize_result whose `output` is the front of `__buffer` that holds the sanitized text.
+	///
+	/// @remarks A single-code unit replacement never takes more room than the sequence it replaces, so this always
+	/// fits and runs in a single forward pass. Well-formed runs are found with the same word-at-a-time ASCII scan
+	/// that the bulk transcoding routines use; they are only moved once an earlier replacement has made the text
+	/// shorter, so well-formed input is read once and never written to. One replacement is made per maximal subpart
+	/// of an ill-formed sequence, as recommended by the Unicode Standard (section 3.9, "U+FFFD Substitution of
+	/// Maximal Subparts"): a truncated sequence such as `0xE2 0x82` becomes one replacement, while a stray
+	/// continuation byte or a byte that can never appear in UTF-8 becomes one replacement each.
+	template <typename _CodeUnit>
+	sanitize_result<::ztd::span<_CodeUnit>> sanitize_in_place(
+		::ztd::span<_CodeUnit> __buffer, type_identity_t<_CodeUnit> __replacement) noexcept {
+		static_assert(sizeof(_CodeUnit) == 1, "sanitize_in_place only works on UTF-8 code units");
+		ZTD_TEXT_ASSERT_MESSAGE_I_("the replacement code unit must be ASCII so that the output stays well-formed",
+			static_cast<unsigned char>(__replacement) < 0x80);
+		::std::size_t __handled_errors = 0;
+		const ::std::size_t __written  = __txt_detail::__utf8_sanitize_forward(
+			__buffer.data(), 0, __buffer.size(), 0, &__replacement, 1, __handled_errors);
+		return sanitize_result<::ztd::span<_CodeUnit>>(__buffer.subspan(0, __written), __handled_errors);
+	}
+
+	//////
+	/// @brief Replaces every ill-formed sequence in the UTF-8 code units of `__buffer` with a question mark (`?`).
+	///
+	/// @param[in, out] __buffer The UTF-8 code units to sanitize.
+	///
+	/// @returns A ztd::text::sanitize_result whose `output` is the front of `__buffer` that holds the sanitized text.
+	template <typename _CodeUnit>
+	sanitize_result<::ztd::span<_CodeUnit>> sanitize_in_place(::ztd::span<_CodeUnit> __buffer) noexcept {
+		return sanitize_in_place(__buffer, static_cast<_CodeUnit>('?'));
+	}
+
+	//////
+	/// @brief Replaces every ill-formed sequence in the UTF-8 string with `__replacement`, then shrinks the string to
+	/// the sanitized text.
+	///
+	/// @param[in, out] __str The UTF-8 string to sanitize.
+	/// @param[in] __replacement The code unit to put in place of each ill-formed sequence. It must be ASCII.
+	///
+	/// @returns A ztd::text::sanitize_result whose `output` is a view of the sanitized string.
+	///
+	/// @remarks The string is never reallocated. See the ztd::span overload for how ill-formed sequences are counted.
+	template <typename _CodeUnit, typename _Traits, typename _Allocator>
+	sanitize_result<::ztd::span<_CodeUnit>> sanitize_in_place(
+		::std::basic_string<_CodeUnit, _Traits, _Allocator>& __str,
+		type_identity_t<_CodeUnit> __replacement) noexcept {
+		::ztd::span<_CodeUnit> __buffer(__str.data(), __str.size());
+		auto __result = sanitize_in_place(__buffer, __replacement);
+		if (__result.errors_were_handled()) {
+			__str.resize(__result.output.size());
+		}
+		return __result;
+	}
+
+	//////
+	/// @brief Replaces every ill-formed sequence in the UTF-8 string with U+FFFD REPLACEMENT CHARACTER, growing the
+	/// string only by as much as the replacements need.
+	///
+	/// @param[in, out] __str The UTF-8 string to sanitize.
+	///
+	/// @returns A ztd::text::sanitize_result whose `output` is a view of the sanitized string.
+	///
+	/// @remarks U+FFFD takes 3 code units, so it is longer than a 1- or 2-code unit ill-formed sequence. The string is
+	/// first scanned without writing anything to count the ill-formed sequences and how much room their replacements
+	/// need: well-formed input stops there, untouched. If the replacements fit in the space the string already
+	/// takes up, it is sanitized in one forward pass and shrunk. Otherwise, the string is grown once by exactly the
+	/// extra room needed, its contents are moved to the end, and the same forward pass writes the sanitized text
+	/// from the front, so the only reallocation is the one `resize` may need to do. See the ztd::span overload for
+	/// how ill-formed sequences are counted.
+	template <typename _CodeUnit, typename _Traits, typename _Allocator>
+	sanitize_result<::ztd::span<_CodeUnit>> sanitize_in_place(
+		::std::basic_string<_CodeUnit, _Traits, _Allocator>& __str) {
+		static_assert(sizeof(_CodeUnit) == 1, "sanitize_in_place only works on UTF-8 code units");
+		constexpr ::std::size_t __replacement_size = 3;
+		const _CodeUnit __replacement[__replacement_size]
+			= { static_cast<_CodeUnit>(0xEF), static_cast<_CodeUnit>(0xBF), static_cast<_CodeUnit>(0xBD) };
+		const ::std::size_t __size = __str.size();
+		::std::size_t __growth     = 0;
+		::std::size_t __handled_errors
+			= __txt_detail::__utf8_sanitize_growth(__str.data(), __size, __replacement_size, __growth);
+		if (__handled_errors == 0) {
+			return sanitize_result<::ztd::span<_CodeUnit>>(::ztd::span<_CodeUnit>(__str.data(), __size), 0);
+		}
+		__handled_errors = 0;
+		if (__growth != 0) {
+			// start reading far enough ahead that the writes, which only ever gain this much on the reads, never
+			// catch up to them
+			__str.resize(__size + __growth);
+			_CodeUnit* const __first = __str.data();
+			::std::memmove(__first + __growth, __first, __size * sizeof(_CodeUnit));
+		}
+		const ::std::size_t __written = __txt_detail::__utf8_sanitize_forward(__str.data(), __growth,
+			__size + __growth, 0, __replacement, __replacement_size, __handled_errors);
+		__str.resize(__written);
+		return sanitize_result<::ztd::span<_CodeUnit>>(
+			::ztd::span<_CodeUnit>(__str.data(), __str.size()), __handled_errors);
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_SANITIZE_IN_PLACE_HPP
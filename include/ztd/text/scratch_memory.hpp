@@ -0,0 +1,266 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_SCRATCH_MEMORY_HPP
+#define ZTD_TEXT_SCRATCH_MEMORY_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/idk/span.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		struct __scratch_memory_arena {
+			// the part of the scratch memory no buffer has been taken out of yet
+			::std::byte* _M_first;
+			::std::byte* _M_last;
+			// the most any one buffer taken out of it gets, in bytes
+			::std::size_t _M_buffer_size;
+		};
+
+		inline __scratch_memory_arena*& __thread_scratch_memory() noexcept {
+			static thread_local __scratch_memory_arena* __arena = nullptr;
+			return __arena;
+		}
+
+		class __scratch_memory_restore {
+		public:
+			__scratch_memory_restore(__scratch_memory_arena& __arena) noexcept
+			: _M_arena(__arena), _M_first(__arena._M_first) {
+			}
+
+			__scratch_memory_restore(const __scratch_memory_restore&)            = delete;
+			__scratch_memory_restore& operator=(const __scratch_memory_restore&) = delete;
+
+			~__scratch_memory_restore() {
+				_M_arena._M_first = _M_first;
+			}
+
+		private:
+			__scratch_memory_arena& _M_arena;
+			::std::byte* _M_first;
+		};
+
+		// never inlined, so the array is only on the stack while the fallback is actually in use rather than sitting
+		// in the frame of every caller
+		template <typename _Ty, ::std::size_t _Size, typename _Fn>
+		ZTD_TEXT_NOINLINE_I_ constexpr auto __with_stack_buffer(_Fn&& __fn) {
+			_Ty __buffer[_Size] {};
+			return ::std::forward<_Fn>(__fn)(::ztd::span<_Ty>(__buffer));
+		}
+
+		template <typename _Ty, ::std::size_t _StackSize, ::std::size_t _MinSize, typename _Fn>
+		auto __with_thread_scratch_buffer(_Fn&& __fn) {
+			if constexpr (::std::is_trivially_destructible_v<_Ty>) {
+				__scratch_memory_arena* __arena = __thread_scratch_memory();
+				if (__arena != nullptr) {
+					void* __first         = __arena->_M_first;
+					::std::size_t __space = static_cast<::std::size_t>(__arena->_M_last - __arena->_M_first);
+					if (::std::align(alignof(_Ty), sizeof(_Ty) * _MinSize, __first, __space) != nullptr) {
+						// as much as the scope allows for one buffer, however big the stack buffer would have
+						// been; the rest is left to whatever else needs a buffer while this one is in use
+						const ::std::size_t __bytes
+							= __space < __arena->_M_buffer_size ? __space : __arena->_M_buffer_size;
+						::std::size_t __size = __bytes / sizeof(_Ty);
+						if (__size >= _MinSize) {
+							_Ty* __buffer = static_cast<_Ty*>(__first);
+							if constexpr (!::std::is_trivially_default_constructible_v<_Ty>) {
+								// each one gets constructed: make no more than the stack would have
+								__size = __size < _StackSize ? __size : _StackSize;
+								for (::std::size_t __index = 0; __index < __size; ++__index) {
+									::new (static_cast<void*>(__buffer + __index)) _Ty();
+								}
+							}
+							__scratch_memory_restore __restore(*__arena);
+							__arena->_M_first = reinterpret_cast<::std::byte*>(__buffer + __size);
+							return ::std::forward<_Fn>(__fn)(::ztd::span<_Ty>(__buffer, __size));
+						}
+					}
+				}
+			}
+			return __with_stack_buffer<_Ty, _StackSize>(::std::forward<_Fn>(__fn));
+		}
+
+		//////
+		/// @brief Calls `__fn` with a span of at least `_MinSize` elements: as many as the calling thread's
+		/// ztd::text::scratch_memory_scope gives each buffer when one is installed and has room, or `_StackSize`
+		/// elements on the stack otherwise.
+		template <typename _Ty, ::std::size_t _StackSize, ::std::size_t _MinSize, typename _Fn>
+		constexpr auto __with_scratch_buffer(_Fn&& __fn) {
+			static_assert(_MinSize <= _StackSize, "the stack buffer must always be big enough on its own");
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+			if (!::std::is_constant_evaluated()) {
+				return __with_thread_scratch_buffer<_Ty, _StackSize, _MinSize>(::std::forward<_Fn>(__fn));
+			}
+#endif
+			return __with_stack_buffer<_Ty, _StackSize>(::std::forward<_Fn>(__fn));
+		}
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_scratch_memory Scratch Memory
+	///
+	/// @{
+
+	//////
+	/// @brief Installs a block of memory as the calling thread's scratch memory for as long as this object lives.
+	///
+	/// @remarks While one is installed, the conversion functions that would otherwise put their pivot and
+	/// intermediate buffers on the stack (the ones not given a ztd::text::pivot by the caller, the intermediate
+	/// storage of the `_to` functions, and the chunks the execution and wide execution encodings convert through) take
+	/// those buffers out of this memory instead. Each buffer gets the buffer size given to the constructor, or
+	/// whatever is left if that is less; this is independent of `ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_BYTE_SIZE`,
+	/// `ZTD_TEXT_INTERMEDIATE_ENCODE_BUFFER_BYTE_SIZE` and `ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_BYTE_SIZE`, which
+	/// only size the stack buffers and can stay small. Buffers of trivial types, such as code units and code points,
+	/// are not initialized up front. A conversion which needs two buffers at once (e.g. ztd::text::transcode_to needs
+	/// a pivot and an intermediate output) takes both, one after the other. If what is left cannot hold even the
+	/// smallest buffer the conversion can work with, the stack is used as before. Scopes nest: a new one takes over
+	/// from the current one until it is destroyed. Scratch memory is never used during constant evaluation, or when
+	/// `std::is_constant_evaluated` is not available.
+	class scratch_memory_scope {
+	private:
+		using __deallocate_function = void (*)(void*, void*, ::std::size_t);
+
+		template <typename _MemoryResource>
+		static void _S_deallocate(void* __resource, void* __pointer, ::std::size_t __size) {
+			static_cast<_MemoryResource*>(__resource)->deallocate(__pointer, __size, alignof(::std::max_align_t));
+		}
+
+	public:
+		//////
+		/// @brief Uses the given memory as this thread's scratch memory, giving each buffer half of it. The memory
+		/// is not owned, and must outlive this object.
+		///
+		/// @param[in] __storage The memory to use.
+		scratch_memory_scope(::ztd::span<::std::byte> __storage) noexcept
+		: scratch_memory_scope(__storage, __storage.size() / 2) {
+		}
+
+		//////
+		/// @brief Uses the given memory as this thread's scratch memory. The memory is not owned, and must outlive
+		/// this object.
+		///
+		/// @param[in] __storage The memory to use.
+		/// @param[in] __buffer_size The most bytes any one buffer (e.g. the pivot) is given.
+		scratch_memory_scope(::ztd::span<::std::byte> __storage, ::std::size_t __buffer_size) noexcept
+		: _M_arena { __storage.data(), __storage.data() + __storage.size(), __buffer_size }
+		, _M_previous(__txt_detail::__thread_scratch_memory())
+		, _M_storage(__storage)
+		, _M_resource(nullptr)
+		, _M_deallocate(nullptr) {
+			__txt_detail::__thread_scratch_memory() = &_M_arena;
+		}
+
+		//////
+		/// @brief Allocates `__size` bytes from `__resource` and uses them as this thread's scratch memory, giving
+		/// each buffer half of it and giving it back to `__resource` when this object is destroyed.
+		///
+		/// @param[in] __resource A `std::pmr::memory_resource`, or anything else with its `allocate(size,
+		/// alignment)` and `deallocate(pointer, size, alignment)` member functions. Must outlive this object.
+		/// @param[in] __size The number of bytes to allocate.
+		template <typename _MemoryResource,
+			::std::enable_if_t<!::std::is_convertible_v<_MemoryResource&, ::ztd::span<::std::byte>>>* = nullptr>
+		scratch_memory_scope(_MemoryResource& __resource, ::std::size_t __size)
+		: scratch_memory_scope(__resource, __size, __size / 2) {
+		}
+
+		//////
+		/// @brief Allocates `__size` bytes from `__resource` and uses them as this thread's scratch memory, giving
+		/// them back to `__resource` when this object is destroyed.
+		///
+		/// @param[in] __resource A `std::pmr::memory_resource`, or anything else with its `allocate(size,
+		/// alignment)` and `deallocate(pointer, size, alignment)` member functions. Must outlive this object.
+		/// @param[in] __size The number of bytes to allocate.
+		/// @param[in] __buffer_size The most bytes any one buffer (e.g. the pivot) is given.
+		template <typename _MemoryResource,
+			::std::enable_if_t<!::std::is_convertible_v<_MemoryResource&, ::ztd::span<::std::byte>>>* = nullptr>
+		scratch_memory_scope(_MemoryResource& __resource, ::std::size_t __size, ::std::size_t __buffer_size)
+		: scratch_memory_scope(
+			::ztd::span<::std::byte>(
+				static_cast<::std::byte*>(__resource.allocate(__size, alignof(::std::max_align_t))), __size),
+			__buffer_size) {
+			_M_resource   = ::std::addressof(__resource);
+			_M_deallocate = &_S_deallocate<_MemoryResource>;
+		}
+
+		scratch_memory_scope(const scratch_memory_scope&)            = delete;
+		scratch_memory_scope& operator=(const scratch_memory_scope&) = delete;
+
+		//////
+		/// @brief Puts back whatever scratch memory was installed before this object was created, and gives the
+		/// memory back to the memory resource if it came from one.
+		~scratch_memory_scope() {
+			__txt_detail::__thread_scratch_memory() = _M_previous;
+			if (_M_deallocate != nullptr) {
+				_M_deallocate(_M_resource, _M_storage.data(), _M_storage.size());
+			}
+		}
+
+		//////
+		/// @brief The memory this object installed.
+		::ztd::span<::std::byte> storage() const noexcept {
+			return _M_storage;
+		}
+
+		//////
+		/// @brief The most bytes any one buffer is given.
+		::std::size_t buffer_size() const noexcept {
+			return _M_arena._M_buffer_size;
+		}
+
+	private:
+		__txt_detail::__scratch_memory_arena _M_arena;
+		__txt_detail::__scratch_memory_arena* _M_previous;
+		::ztd::span<::std::byte> _M_storage;
+		void* _M_resource;
+		__deallocate_function _M_deallocate;
+	};
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_SCRATCH_MEMORY_HPP
@@ -0,0 +1,224 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_SEGMENTED_RANGE_HPP
+#define ZTD_TEXT_SEGMENTED_RANGE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/encoding_error.hpp>
+
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+#include <ztd/ranges/algorithm.hpp>
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		template <typename _Range>
+		using __detect_adl_text_segments = decltype(text_segments(::std::declval<const _Range&>()));
+
+		template <typename _Range>
+		using __segment_code_unit_t = ::std::remove_const_t<ranges::range_value_type_t<
+			ranges::range_value_type_t<remove_cvref_t<__detect_adl_text_segments<_Range>>>>>;
+
+		struct __segment_step {
+			::std::size_t _M_consumed;
+			bool _M_stopped;
+		};
+
+		struct __seam_deferral {
+			bool _M_deferred;
+			::std::size_t _M_remaining;
+
+			constexpr __segment_step _M_step(
+				::std::size_t __size, ::std::size_t __unread, bool __failed) const noexcept {
+				if (this->_M_deferred) {
+					return __segment_step { __size - this->_M_remaining, false };
+				}
+				return __segment_step { __size - __unread, __failed };
+			}
+
+			constexpr ::std::size_t _M_handled(::std::size_t __handled_errors) const noexcept {
+				// the deferred sequence was not really handled: it is tried again once it is stitched together
+				return (this->_M_deferred && __handled_errors > 0) ? __handled_errors - 1 : __handled_errors;
+			}
+		};
+
+		template <::std::size_t _MaxUnits, typename _ErrorHandler>
+		class __seam_deferring_handler {
+		public:
+			constexpr __seam_deferring_handler(
+				_ErrorHandler& __error_handler, __seam_deferral& __deferral, bool __deferrable) noexcept
+			: _M_error_handler(__error_handler), _M_deferral(__deferral), _M_deferrable(__deferrable) {
+			}
+
+			template <typename _Encoding, typename _Result, typename _InputProgress, typename _OutputProgress>
+			constexpr remove_cvref_t<_Result> operator()(const _Encoding& __encoding, _Result&& __result,
+				const _InputProgress& __input_progress, const _OutputProgress& __output_progress) const {
+				if (this->_M_deferrable && __result.error_code == encoding_error::incomplete_sequence) {
+					const ::std::size_t __remaining
+						= static_cast<::std::size_t>(ranges::ranges_adl::adl_size(__result.input))
+						+ static_cast<::std::size_t>(ranges::ranges_adl::adl_size(__input_progress));
+					if (__remaining < _MaxUnits) {
+						// only the end of the segment was cut off: hand it back untouched, so the driver can
+						// stitch it onto the start of the next segment
+						this->_M_deferral._M_deferred  = true;
+						this->_M_deferral._M_remaining = __remaining;
+						return ::std::forward<_Result>(__result);
+					}
+				}
+				return this->_M_error_handler(
+					__encoding, ::std::forward<_Result>(__result), __input_progress, __output_progress);
+			}
+
+		private:
+			_ErrorHandler& _M_error_handler;
+			__seam_deferral& _M_deferral;
+			bool _M_deferrable;
+		};
+
+		template <::std::size_t _MaxUnits, typename _Input, typename _Process>
+		constexpr __segment_step __segmented_drive(const _Input& __input, _Process& __process) {
+			using _CodeUnit = __segment_code_unit_t<_Input>;
+			using _Units    = ::ztd::span<const _CodeUnit>;
+
+			// a sequence cut by a seam leaves fewer than _MaxUnits behind, and at most _MaxUnits more are needed to
+			// finish it
+			_CodeUnit __stitch[_MaxUnits * 2] {};
+			::std::size_t __carry    = 0;
+			::std::size_t __position = 0;
+			auto&& __segments        = text_segments(__input);
+			for (auto&& __segment : __segments) {
+				const _CodeUnit* __first   = ranges::ranges_adl::adl_data(__segment);
+				const ::std::size_t __size = static_cast<::std::size_t>(ranges::ranges_adl::adl_size(__segment));
+				::std::size_t __offset     = 0;
+				while (__carry > 0 && __offset < __size) {
+					const ::std::size_t __carried = __carry;
+					const ::std::size_t __taken   = (::std::min)(__size - __offset, _MaxUnits);
+					ranges::__rng_detail::__copy_n_unsafe(__first + __offset, __taken, __stitch + __carried);
+					const ::std::size_t __stitched = __carried + __taken;
+					__segment_step __step          = __process(_Units(__stitch, __stitched), true);
+					__position += __step._M_consumed;
+					if (__step._M_stopped) {
+						return __segment_step { __position, true };
+					}
+					if (__step._M_consumed >= __carried) {
+						// past the seam: the rest can be read straight out of the segment again
+						__offset += __step._M_consumed - __carried;
+						__carry = 0;
+					}
+					else {
+						__carry = __stitched - __step._M_consumed;
+						ranges::__rng_detail::__copy_n_unsafe(__stitch + __step._M_consumed, __carry, __stitch);
+						__offset += __taken;
+					}
+				}
+				if (__offset < __size) {
+					__segment_step __step = __process(_Units(__first + __offset, __size - __offset), true);
+					__position += __step._M_consumed;
+					if (__step._M_stopped) {
+						return __segment_step { __position, true };
+					}
+					__offset += __step._M_consumed;
+					__carry = __size - __offset;
+					ranges::__rng_detail::__copy_n_unsafe(__first + __offset, __carry, __stitch);
+				}
+			}
+			if (__carry > 0) {
+				// nothing left to stitch on: whatever is still carried is really incomplete
+				__segment_step __step = __process(_Units(__stitch, __carry), false);
+				__position += __step._M_consumed;
+				return __segment_step { __position, __step._M_stopped };
+			}
+			return __segment_step { __position, false };
+		}
+
+		template <typename _Input>
+		constexpr auto __segmented_rest(_Input&& __input, ::std::size_t __position) {
+			using _UInput = remove_cvref_t<_Input>;
+			auto __first  = ranges::ranges_adl::adl_begin(__input);
+			::std::advance(__first, static_cast<ranges::range_difference_type_t<_UInput>>(__position));
+			return ranges::reconstruct(
+				::std::in_place_type<_UInput>, ::std::move(__first), ranges::ranges_adl::adl_end(__input));
+		}
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_properties Property and Trait Helpers
+	///
+	/// @{
+
+	//////
+	/// @brief Whether or not the given `_Range` is stored as a sequence of contiguous segments, such as a gap buffer
+	/// or a rope.
+	///
+	/// @tparam _Range The range type to check.
+	///
+	/// @remarks A range opts in by providing an ADL-findable `text_segments(const _Range&)` that returns a range of
+	/// contiguous ranges of code units, in order, which together cover exactly the range. When this is true,
+	/// ztd::text::transcode_into, ztd::text::count_as_decoded, ztd::text::count_as_transcoded,
+	/// ztd::text::validate_decodable_as and ztd::text::validate_transcodable_as run their contiguous loops over each
+	/// segment and only copy out the few code units of a sequence split across two segments, rather than going
+	/// through the range's (usually slow) iterators one code unit at a time. The input on the result of these
+	/// operations is still the `_Range` itself, reconstructed past what was read.
+	template <typename _Range>
+	class is_segmented_range
+	: public ::std::integral_constant<bool,
+		  is_detected_v<__txt_detail::__detect_adl_text_segments, ::ztd::remove_cvref_t<_Range>>> { };
+
+	//////
+	/// @brief An alias of the inner `value` for ztd::text::is_segmented_range.
+	template <typename _Range>
+	inline constexpr bool is_segmented_range_v = is_segmented_range<::ztd::remove_cvref_t<_Range>>::value;
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_SEGMENTED_RANGE_HPP
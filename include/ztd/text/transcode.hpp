@@ -39,16 +39,20 @@
 #include <ztd/text/code_unit.hpp>
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/state.hpp>
+#include <ztd/text/scratch_memory.hpp>
 #include <ztd/text/default_encoding.hpp>
 #include <ztd/text/transcode_result.hpp>
 #include <ztd/text/is_unicode_code_point.hpp>
 #include <ztd/text/transcode_one.hpp>
 #include <ztd/text/pivot.hpp>
+#include <ztd/text/segmented_range.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/transcode_extension_points.hpp>
 #include <ztd/text/detail/span_or_reconstruct.hpp>
 #include <ztd/text/detail/forward_if_move_only.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+#include <ztd/text/detail/pivot_batch.hpp>
 
 #include <ztd/idk/tag.hpp>
 #include <ztd/idk/span.hpp>
@@ -106,7 +110,11 @@ namespace ztd { namespace text {
 	/// @remark This function detects whether or not the ADL extension point `text_transcode` can be called with the
 	/// provided parameters. If so, it will use that ADL extension point over the default implementation. Otherwise, it
 	/// will loop over the two encodings and attempt to transcode by first decoding the input code units to code
-	/// points, then encoding the intermediate code points to the desired, output code units.
+	/// points, then encoding the intermediate code points to the desired, output code units. When both encodings
+	/// work one code point at a time, their states are copyable, and `__pivot` is a contiguous range of code points,
+	/// it decodes a whole pivot's worth of code points before encoding any of them; the step where either side fails
+	/// is redone on its own with the given error handlers, so the result is the same as going one code point at a
+	/// time.
 	template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
 		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
 		typename _PivotRange>
@@ -137,6 +145,22 @@ namespace ztd { namespace text {
 
 		::std::size_t __handled_errors = 0;
 		for (;;) {
+			if constexpr (__txt_detail::__is_pivot_batchable_v<_UFromEncoding, _UToEncoding, _WorkingInput,
+				              _WorkingOutput, _FromState, _ToState, _PivotRange>) {
+				// decode a whole pivot's worth, then encode all of it; whatever step it stops at (an error, or a
+				// full output) is then done once, below, with the real error handlers
+				::ztd::span<code_point_t<_UFromEncoding>> __pivot_span(
+					ranges::ranges_adl::adl_data(__pivot.intermediate),
+					ranges::ranges_adl::adl_size(__pivot.intermediate));
+				if (__pivot_span.size() > 1 && !ranges::ranges_adl::adl_empty(__working_input)) {
+					__txt_detail::__pivot_batch_transcode(__working_input, __from_encoding, __working_output,
+						__to_encoding, __from_state, __to_state, __pivot_span);
+					if (ranges::ranges_adl::adl_empty(__working_input) && text::is_state_complete(__from_state)
+						&& text::is_state_complete(__to_state)) {
+						break;
+					}
+				}
+			}
 			auto __transcode_result
 				= transcode_one_into(::std::move(__working_input), __from_encoding, ::std::move(__working_output),
 				     __to_encoding, __from_error_handler, __to_error_handler, __from_state, __to_state, __pivot);
@@ -236,6 +260,45 @@ namespace ztd { namespace text {
 					ranges::reconstruct(::std::in_place_type<_UOutput>, ::std::move(__result.out)), __from_state,
 					__to_state);
 			}
+			else if constexpr (is_segmented_range_v<_UInput>) {
+				// Gap buffers, ropes and the like: run the contiguous loops over each segment, and only stitch
+				// together the few code units of a sequence that straddles two segments.
+				using _WorkingOutput = ranges::range_reconstruct_t<_UOutput>;
+				using _Result
+					= __txt_detail::__reconstruct_transcode_result_t<_UInput, _UOutput, _FromState, _ToState>;
+				using _SeamHandler = __txt_detail::__seam_deferring_handler<max_code_units_v<_UFromEncoding>,
+					::std::remove_reference_t<_FromErrorHandler>>;
+				_WorkingOutput __working_output
+					= ranges::reconstruct(::std::in_place_type<_UOutput>, ::std::forward<_Output>(__output));
+				encoding_error __error_code    = encoding_error::ok;
+				::std::size_t __handled_errors = 0;
+				__txt_detail::__seam_deferral __deferral {};
+				auto __process = [&](auto __units, bool __deferrable) {
+					__deferral = __txt_detail::__seam_deferral {};
+					_SeamHandler __seam_handler(__from_error_handler, __deferral, __deferrable);
+					auto __result = transcode_into(__units, __from_encoding, __working_output, __to_encoding,
+						__seam_handler, __to_error_handler, __from_state, __to_state, __pivot);
+					__working_output
+						= ranges::reconstruct(::std::in_place_type<_WorkingOutput>, ::std::move(__result.output));
+					__handled_errors += __deferral._M_handled(__result.handled_errors);
+					__error_code = __deferral._M_deferred ? encoding_error::ok : __result.error_code;
+					return __deferral._M_step(ranges::ranges_adl::adl_size(__units),
+						ranges::ranges_adl::adl_size(__result.input), __error_code != encoding_error::ok);
+				};
+				__txt_detail::__segment_step __read
+					= __txt_detail::__segmented_drive<max_code_units_v<_UFromEncoding>>(__input, __process);
+				return _Result(__txt_detail::__segmented_rest(__input, __read._M_consumed),
+					::std::move(__working_output), __from_state, __to_state, __error_code, __handled_errors);
+			}
+			else if constexpr (__txt_detail::__is_utf_bulk_transcodable_v<_UFromEncoding, _UToEncoding, _UInput,
+				                   _UOutput>) {
+				// Between the standard UTF encodings, over contiguous memory: convert directly, and only fall back
+				// to decode_one / encode_one for the individual sequences the error handlers need to see.
+				return __txt_detail::__utf_bulk_transcode_into(::std::forward<_Input>(__input), __from_encoding,
+					::std::forward<_Output>(__output), __to_encoding,
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			}
 			else if constexpr (__txt_detail::__is_decode_same_as_encode_v<_UFromEncoding, _UToEncoding>) {
 				// We can skip one of the steps. This tends to be the case for e.g.
 				// UTF-16 to UTF-32 transcoding conversions, where decoding from UTF-16 does not need a further
@@ -272,6 +335,16 @@ namespace ztd { namespace text {
 					ranges::reconstruct(::std::in_place_type<_UOutput>, ::std::move(__result.output)),
 					__from_state, __to_state);
 			}
+			else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_transcode, _Input,
+				                   _FromEncoding, _Output, _ToEncoding, _FromErrorHandler, _ToErrorHandler,
+				                   _FromState, _ToState, _PivotRange>) {
+				return __text_transcode(
+					::ztd::tag<::ztd::remove_cvref_t<_FromEncoding>, ::ztd::remove_cvref_t<_ToEncoding>> {},
+					::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+					::std::forward<_Output>(__output), ::std::forward<_ToEncoding>(__to_encoding),
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			}
 			else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_transcode_one, _Input,
 				                   _FromEncoding, _Output, _ToEncoding, _FromErrorHandler, _ToErrorHandler,
 				                   _FromState, _ToState, _PivotRange>) {
@@ -327,18 +400,22 @@ namespace ztd { namespace text {
 		using _CodePoint     = code_point_t<_UFromEncoding>;
 		using _PivotSpan     = ::ztd::span<_CodePoint>;
 
+		constexpr ::std::size_t __intermediate_buffer_min = max_code_points_v<_UFromEncoding>;
 		constexpr ::std::size_t __intermediate_buffer_max
 			= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>)
-			     < max_code_points_v<_UFromEncoding>
-			? max_code_points_v<_UFromEncoding>
+			     < __intermediate_buffer_min
+			? __intermediate_buffer_min
 			: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>);
 
-		_CodePoint __intermediate[__intermediate_buffer_max] {};
-		pivot<_PivotSpan> __pivot { _PivotSpan(__intermediate), encoding_error::ok };
-		return transcode_into(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
-			::std::forward<_Output>(__output), ::std::forward<_ToEncoding>(__to_encoding),
-			::std::forward<_FromErrorHandler>(__from_error_handler),
-			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+		return __txt_detail::__with_scratch_buffer<_CodePoint, __intermediate_buffer_max, __intermediate_buffer_min>(
+			[&](_PivotSpan __intermediate) {
+				pivot<_PivotSpan> __pivot { __intermediate, encoding_error::ok };
+				return transcode_into(::std::forward<_Input>(__input),
+					::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_Output>(__output),
+					::std::forward<_ToEncoding>(__to_encoding),
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			});
 	}
 
 	//////
@@ -514,21 +591,16 @@ namespace ztd { namespace text {
 		constexpr auto __intermediate_transcode_to_storage(_Input&& __input, _FromEncoding&& __from_encoding,
 			_OutputContainer& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
 			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
-			pivot<_PivotRange>& __pivot) {
+			pivot<_PivotRange>& __pivot,
+			::ztd::span<code_unit_t<remove_cvref_t<_ToEncoding>>> __intermediate_initial) {
 			// … Weeeellll. Here we go …
 			using _UToEncoding                 = remove_cvref_t<_ToEncoding>;
 			using _UFromEncoding               = remove_cvref_t<_FromEncoding>;
 			using _IntermediateInputValueType  = code_point_t<_UFromEncoding>;
 			using _IntermediateOutputValueType = code_unit_t<_UToEncoding>;
-			constexpr ::std::size_t _IntermediateOutputMax
-				= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_IntermediateOutputValueType)
-				     < max_code_units_v<_UToEncoding>
-				? max_code_units_v<_UToEncoding>
-				: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_IntermediateOutputValueType);
-			using _InitialInput              = __string_view_or_span_or_reconstruct_t<_Input>;
-			using _IntermediateInput         = ::ztd::span<_IntermediateInputValueType>;
-			using _IntermediateOutputInitial = ::ztd::span<_IntermediateOutputValueType, _IntermediateOutputMax>;
-			using _IntermediateOutput        = ::ztd::span<_IntermediateOutputValueType>;
+			using _InitialInput                = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _IntermediateInput           = ::ztd::span<_IntermediateInputValueType>;
+			using _IntermediateOutput          = ::ztd::span<_IntermediateOutputValueType>;
 			using _DecodeResult = decltype(__txt_detail::__basic_decode_one<__txt_detail::__consume::__no>(
 				::std::declval<_InitialInput>(), ::std::forward<_FromEncoding>(__from_encoding),
 				::std::declval<_IntermediateInput>(), __from_error_handler, __from_state));
@@ -544,8 +616,6 @@ namespace ztd { namespace text {
 
 			_WorkingInput __working_input(
 				__txt_detail::__string_view_or_span_or_reconstruct(::std::forward<_Input>(__input)));
-			_IntermediateOutputValueType __intermediate_output_storage[_IntermediateOutputMax] {};
-			_IntermediateOutputInitial __intermediate_initial(__intermediate_output_storage);
 			for (;;) {
 				auto __result = transcode_into(::std::move(__working_input), __from_encoding,
 					__intermediate_initial, __to_encoding, __from_error_handler, __to_error_handler, __from_state,
@@ -576,21 +646,21 @@ namespace ztd { namespace text {
 			}
 		}
 
-		template <bool _OutputOnly, typename _OutputContainer, typename _Input, typename _FromEncoding,
-			typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
-			typename _ToState, typename _PivotRange>
-		constexpr auto __transcode_dispatch(_Input&& __input, _FromEncoding&& __from_encoding,
-			_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		template <typename _Input, typename _FromEncoding, typename _OutputContainer, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
+			typename _PivotRange>
+		constexpr auto __transcode_into_container_dispatch(_Input&& __input, _FromEncoding&& __from_encoding,
+			_OutputContainer& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
 			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
 			pivot<_PivotRange>& __pivot) {
 			using _UFromEncoding = remove_cvref_t<_FromEncoding>;
 
-			_OutputContainer __output {};
 			if constexpr (is_detected_v<ranges::detect_adl_size, _Input>) {
 				using _SizeType = decltype(ranges::ranges_adl::adl_size(__input));
 				if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputContainer, _SizeType>) {
 					_SizeType __output_size_hint = static_cast<_SizeType>(ranges::ranges_adl::adl_size(__input));
-					__output.reserve(__output_size_hint);
+					__output.reserve(
+						static_cast<_SizeType>(ranges::ranges_adl::adl_size(__output)) + __output_size_hint);
 				}
 			}
 			if constexpr (__txt_detail::__is_decode_range_category_output_v<_UFromEncoding>) {
@@ -598,34 +668,51 @@ namespace ztd { namespace text {
 				using _Unbounded            = ranges::unbounded_view<_BackInserterIterator>;
 				// We can use the unbounded stuff
 				_Unbounded __insert_view(::std::back_inserter(__output));
-				auto __stateful_result = transcode_into(__txt_detail::__forward_if_move_only<_Input>(__input),
+				return transcode_into(__txt_detail::__forward_if_move_only<_Input>(__input),
 					::std::forward<_FromEncoding>(__from_encoding), ::std::move(__insert_view),
 					::std::forward<_ToEncoding>(__to_encoding),
 					::std::forward<_FromErrorHandler>(__from_error_handler),
 					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
-				if constexpr (_OutputOnly) {
-					(void)__stateful_result;
-					return __output;
-				}
-				else {
-					return __txt_detail::__replace_result_output(
-						::std::move(__stateful_result), ::std::move(__output));
-				}
 			}
 			else {
-				auto __stateful_result = __txt_detail::__intermediate_transcode_to_storage(
-					::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding), __output,
-					::std::forward<_ToEncoding>(__to_encoding),
-					::std::forward<_FromErrorHandler>(__from_error_handler),
-					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
-				if constexpr (_OutputOnly) {
-					(void)__stateful_result;
-					return __output;
-				}
-				else {
-					return __txt_detail::__replace_result_output(
-						::std::move(__stateful_result), ::std::move(__output));
-				}
+				using _UToEncoding                 = remove_cvref_t<_ToEncoding>;
+				using _IntermediateOutputValueType = code_unit_t<_UToEncoding>;
+				constexpr ::std::size_t _IntermediateOutputMin = max_code_units_v<_UToEncoding>;
+				constexpr ::std::size_t _IntermediateOutputMax
+					= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_IntermediateOutputValueType)
+					     < _IntermediateOutputMin
+					? _IntermediateOutputMin
+					: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_IntermediateOutputValueType);
+				return __txt_detail::__with_scratch_buffer<_IntermediateOutputValueType, _IntermediateOutputMax,
+					_IntermediateOutputMin>([&](::ztd::span<_IntermediateOutputValueType> __intermediate_buffer) {
+					return __txt_detail::__intermediate_transcode_to_storage(::std::forward<_Input>(__input),
+						::std::forward<_FromEncoding>(__from_encoding), __output,
+						::std::forward<_ToEncoding>(__to_encoding),
+						::std::forward<_FromErrorHandler>(__from_error_handler),
+						::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot,
+						__intermediate_buffer);
+				});
+			}
+		}
+
+		template <bool _OutputOnly, typename _OutputContainer, typename _Input, typename _FromEncoding,
+			typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+			typename _ToState, typename _PivotRange>
+		constexpr auto __transcode_dispatch(_Input&& __input, _FromEncoding&& __from_encoding,
+			_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
+			pivot<_PivotRange>& __pivot) {
+			_OutputContainer __output {};
+			auto __stateful_result = __transcode_into_container_dispatch(::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), __output,
+				::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			if constexpr (_OutputOnly) {
+				(void)__stateful_result;
+				return __output;
+			}
+			else {
+				return __txt_detail::__replace_result_output(::std::move(__stateful_result), ::std::move(__output));
 			}
 		}
 	} // namespace __txt_detail
@@ -720,18 +807,21 @@ namespace ztd { namespace text {
 		using _CodePoint     = code_point_t<_UFromEncoding>;
 		using _PivotSpan     = ::ztd::span<_CodePoint>;
 
+		constexpr ::std::size_t __intermediate_buffer_min = max_code_points_v<_UFromEncoding>;
 		constexpr ::std::size_t __intermediate_buffer_max
 			= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>)
-			     < max_code_points_v<_UFromEncoding>
-			? max_code_points_v<_UFromEncoding>
+			     < __intermediate_buffer_min
+			? __intermediate_buffer_min
 			: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>);
 
-		_CodePoint __intermediate[__intermediate_buffer_max] {};
-		pivot<_PivotSpan> __pivot { _PivotSpan(__intermediate), encoding_error::ok };
-		return transcode_to<_OutputContainer>(::std::forward<_Input>(__input),
-			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
-			::std::forward<_FromErrorHandler>(__from_error_handler),
-			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+		return __txt_detail::__with_scratch_buffer<_CodePoint, __intermediate_buffer_max, __intermediate_buffer_min>(
+			[&](_PivotSpan __intermediate) {
+				pivot<_PivotSpan> __pivot { __intermediate, encoding_error::ok };
+				return transcode_to<_OutputContainer>(::std::forward<_Input>(__input),
+					::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			});
 	}
 
 	//////
@@ -918,6 +1008,216 @@ namespace ztd { namespace text {
 		}
 	}
 
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding, appending them to the end of an already-existing container.
+	///
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append the encoded code units to. It is not cleared beforehand.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	/// @param[in,out] __from_state A reference to the associated state for the `__from_encoding` 's decode step.
+	/// @param[in,out] __to_state A reference to the associated state for the `__to_encoding` 's encode step.
+	/// @param[in, out] __pivot A reference to a descriptor of a (potentially usable) pivot range, usually a range of
+	/// contiguous data from a span provided by the implementation but customizable by the end-user.
+	///
+	/// @returns A ztd::text::transcode_result object that contains references to `__from_state`, @p
+	/// __to_state, and an `output` that is a reference to `__output`.
+	///
+	/// @remarks Unlike ztd::text::transcode_to, the container is never default-constructed by this function. This
+	/// makes it the right entry point for containers whose allocator must be supplied at construction time (e.g., a
+	/// `std::pmr::u16string` using a `std::pmr::monotonic_buffer_resource`), or for re-using a container's
+	/// capacity across many conversions. If the container has a `container.reserve` function, it is called with the
+	/// container's current size plus some multiple of the input's size.
+	template <typename _Input, typename _FromEncoding, typename _OutputContainer, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
+		typename _PivotRange>
+	constexpr auto transcode_into_container(_Input&& __input, _FromEncoding&& __from_encoding,
+		_OutputContainer& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
+		pivot<_PivotRange>& __pivot) {
+		auto __stateful_result = __txt_detail::__transcode_into_container_dispatch(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), __output, ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+		return __txt_detail::__replace_result_output(
+			::std::move(__stateful_result), ::ztd::reference_wrapper<_OutputContainer>(__output));
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding, appending them to the end of an already-existing container.
+	///
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append the encoded code units to. It is not cleared beforehand.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	/// @param[in,out] __from_state A reference to the associated state for the `__from_encoding` 's decode step.
+	/// @param[in,out] __to_state A reference to the associated state for the `__to_encoding` 's encode step.
+	///
+	/// @returns A ztd::text::transcode_result object that contains references to `__from_state`, @p
+	/// __to_state, and an `output` that is a reference to `__output`.
+	template <typename _Input, typename _FromEncoding, typename _OutputContainer, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
+	constexpr auto transcode_into_container(_Input&& __input, _FromEncoding&& __from_encoding,
+		_OutputContainer& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state) {
+		using _UFromEncoding = ::ztd::remove_cvref_t<_FromEncoding>;
+		using _CodePoint     = code_point_t<_UFromEncoding>;
+		using _PivotSpan     = ::ztd::span<_CodePoint>;
+
+		constexpr ::std::size_t __intermediate_buffer_min = max_code_points_v<_UFromEncoding>;
+		constexpr ::std::size_t __intermediate_buffer_max
+			= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>)
+			     < __intermediate_buffer_min
+			? __intermediate_buffer_min
+			: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>);
+
+		return __txt_detail::__with_scratch_buffer<_CodePoint, __intermediate_buffer_max, __intermediate_buffer_min>(
+			[&](_PivotSpan __intermediate) {
+				pivot<_PivotSpan> __pivot { __intermediate, encoding_error::ok };
+				return transcode_into_container(::std::forward<_Input>(__input),
+					::std::forward<_FromEncoding>(__from_encoding), __output,
+					::std::forward<_ToEncoding>(__to_encoding),
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			});
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding, appending them to the end of an already-existing container.
+	///
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append the encoded code units to. It is not cleared beforehand.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	/// @param[in,out] __from_state A reference to the associated state for the `__from_encoding` 's decode step.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object whose `output` is a reference to `__output`.
+	///
+	/// @remarks A `to_state` is created using ztd::text::make_encode_state. The result is stateless since that
+	/// state lives on the stack of this function.
+	template <typename _Input, typename _FromEncoding, typename _OutputContainer, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState>
+	constexpr auto transcode_into_container(_Input&& __input, _FromEncoding&& __from_encoding,
+		_OutputContainer& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler, _FromState& __from_state) {
+		using _UToEncoding = remove_cvref_t<_ToEncoding>;
+		using _ToState     = encode_state_t<_UToEncoding>;
+
+		_ToState __to_state = make_encode_state(__to_encoding);
+
+		auto __stateful_result = transcode_into_container(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), __output, ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+
+		return __txt_detail::__slice_to_stateless(::std::move(__stateful_result));
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding, appending them to the end of an already-existing container.
+	///
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append the encoded code units to. It is not cleared beforehand.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object whose `output` is a reference to `__output`.
+	///
+	/// @remarks A `from_state` is created using ztd::text::make_decode_state.
+	template <typename _Input, typename _FromEncoding, typename _OutputContainer, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler>
+	constexpr auto transcode_into_container(_Input&& __input, _FromEncoding&& __from_encoding,
+		_OutputContainer& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler) {
+		using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+		using _FromState     = decode_state_t<_UFromEncoding>;
+
+		_FromState __from_state = make_decode_state(__from_encoding);
+
+		return transcode_into_container(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), __output, ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state);
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding, appending them to the end of an already-existing container.
+	///
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append the encoded code units to. It is not cleared beforehand.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object whose `output` is a reference to `__output`.
+	///
+	/// @remarks A `to_error_handler` for the encode step is created by duplicating `__from_error_handler` or, if that
+	/// is not possible, using a careless ztd::text::default_handler_t.
+	template <typename _Input, typename _FromEncoding, typename _OutputContainer, typename _ToEncoding,
+		typename _FromErrorHandler>
+	constexpr auto transcode_into_container(_Input&& __input, _FromEncoding&& __from_encoding,
+		_OutputContainer& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler) {
+		auto __handler = __txt_detail::__duplicate_or_be_careless(__from_error_handler);
+
+		return transcode_into_container(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), __output, ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler), __handler);
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding, appending them to the end of an already-existing container.
+	///
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append the encoded code units to. It is not cleared beforehand.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object whose `output` is a reference to `__output`.
+	///
+	/// @remarks A `from_error_handler` is created using default construction of a ztd::text::default_handler_t that is
+	/// marked as careless.
+	template <typename _Input, typename _FromEncoding, typename _OutputContainer, typename _ToEncoding>
+	constexpr auto transcode_into_container(_Input&& __input, _FromEncoding&& __from_encoding,
+		_OutputContainer& __output, _ToEncoding&& __to_encoding) {
+		default_handler_t __handler {};
+
+		return transcode_into_container(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), __output, ::std::forward<_ToEncoding>(__to_encoding),
+			__handler);
+	}
+
 	//////
 	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
 	/// encoding for the output, which is then returned in a result structure with additional information about
@@ -1006,18 +1306,21 @@ namespace ztd { namespace text {
 		using _CodePoint     = code_point_t<_UFromEncoding>;
 		using _PivotSpan     = ::ztd::span<_CodePoint>;
 
+		constexpr ::std::size_t __intermediate_buffer_min = max_code_points_v<_UFromEncoding>;
 		constexpr ::std::size_t __intermediate_buffer_max
 			= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>)
-			     < max_code_points_v<_UFromEncoding>
-			? max_code_points_v<_UFromEncoding>
+			     < __intermediate_buffer_min
+			? __intermediate_buffer_min
 			: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>);
 
-		_CodePoint __intermediate[__intermediate_buffer_max] {};
-		pivot<_PivotSpan> __pivot { _PivotSpan(__intermediate), encoding_error::ok };
-		return transcode<_OutputContainer>(::std::forward<_Input>(__input),
-			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
-			::std::forward<_FromErrorHandler>(__from_error_handler),
-			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+		return __txt_detail::__with_scratch_buffer<_CodePoint, __intermediate_buffer_max, __intermediate_buffer_min>(
+			[&](_PivotSpan __intermediate) {
+				pivot<_PivotSpan> __pivot { __intermediate, encoding_error::ok };
+				return transcode<_OutputContainer>(::std::forward<_Input>(__input),
+					::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			});
 	}
 
 	//////
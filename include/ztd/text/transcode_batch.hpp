@@ -0,0 +1,446 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_TRANSCODE_BATCH_HPP
+#define ZTD_TEXT_TRANSCODE_BATCH_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/pivot.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/transcode_result.hpp>
+#include <ztd/text/scratch_memory.hpp>
+#include <ztd/text/assert.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/reference_wrapper.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_transcode_batch ztd::text::transcode_batch[_into_container]
+	/// @brief These functions transcode many separate inputs, laid out one after the other in a single range of code
+	/// units and delimited by an offsets range, into a single output range with a matching offsets range. This is the
+	/// layout used by columnar formats such as Apache Arrow's string arrays: `N` inputs are described by `N + 1`
+	/// offsets, and input `i` is the code units from `offsets[i]` up to `offsets[i + 1]`.
+	/// @{
+
+	namespace __txt_detail {
+		// stands in for the outcomes container when the caller has not asked for one
+		struct __ignore_batch_outcomes {
+			constexpr void push_back(const transcode_batch_outcome&) noexcept {
+			}
+		};
+	} // namespace __txt_detail
+
+	//////
+	/// @brief Transcodes every input in `__input_data` delimited by `__input_offsets`, appending the results to the
+	/// `__output` container, the output offsets to the `__output_offsets` container and what happened to each input
+	/// to the `__output_outcomes` container.
+	///
+	/// @param[in]     __input_offsets A range of `N + 1` offsets into `__input_data`, delimiting `N` inputs.
+	/// @param[in]     __input_data A contiguous range of code units holding all of the inputs.
+	/// @param[in]     __from_encoding The encoding that will be used to decode each input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append every input's encoded code units to.
+	/// @param[in,out] __output_offsets The container to append the output offsets to. If it is empty, the current size
+	/// of `__output` is appended first, so that it ends up with `N + 1` offsets.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step. It is used for
+	/// every input.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step. It is used for
+	/// every input.
+	/// @param[in,out] __output_outcomes The container to append one ztd::text::transcode_batch_outcome per input to,
+	/// in the same order as the inputs.
+	///
+	/// @returns A ztd::text::transcode_batch_result whose `output` and `output_offsets` are references to
+	/// `__output` and `__output_offsets`. `error_code` and `error_index` say what went wrong with the first input
+	/// that could not be transcoded, and for which input; `handled_errors` counts the errors handled over the whole
+	/// batch.
+	///
+	/// @remarks An input that cannot be transcoded does not stop the batch: whatever was written for it is taken back
+	/// out of `__output`, so its output range is empty, and the batch carries on with the next input. Each input
+	/// starts from a freshly-made decode and encode state, so no shift state leaks from one input into the next. The
+	/// fixed costs of a conversion are only paid once for the whole batch: the pivot buffer is acquired once, and the
+	/// containers are reserved once for all of the inputs.
+	template <typename _InputOffsets, typename _InputData, typename _FromEncoding, typename _OutputContainer,
+		typename _OutputOffsets, typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler,
+		typename _OutputOutcomes>
+	constexpr auto transcode_batch_into_container(_InputOffsets&& __input_offsets, _InputData&& __input_data,
+		_FromEncoding&& __from_encoding, _OutputContainer& __output, _OutputOffsets& __output_offsets,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
+		_OutputOutcomes& __output_outcomes) {
+		using _UInputData    = remove_cvref_t<_InputData>;
+		using _CodeUnit      = remove_cvref_t<ranges::range_value_type_t<_UInputData>>;
+		using _InputSpan     = ::ztd::span<const _CodeUnit>;
+		using _OutputOffset  = remove_cvref_t<ranges::range_value_type_t<_OutputOffsets>>;
+		using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = remove_cvref_t<_ToEncoding>;
+		using _FromState     = decode_state_t<_UFromEncoding>;
+		using _ToState       = encode_state_t<_UToEncoding>;
+		using _CodePoint     = code_point_t<_UFromEncoding>;
+		using _PivotSpan     = ::ztd::span<_CodePoint>;
+		using _Result        = transcode_batch_result<::ztd::reference_wrapper<_OutputContainer>,
+               ::ztd::reference_wrapper<_OutputOffsets>>;
+
+		auto __offsets_first      = ranges::ranges_adl::adl_begin(__input_offsets);
+		const auto __offsets_last = ranges::ranges_adl::adl_end(__input_offsets);
+		if (__offsets_first == __offsets_last) {
+			return _Result(__output, __output_offsets, encoding_error::ok, 0, 0);
+		}
+		if (ranges::ranges_adl::adl_empty(__output_offsets)) {
+			__output_offsets.push_back(static_cast<_OutputOffset>(ranges::ranges_adl::adl_size(__output)));
+		}
+		if constexpr (is_detected_v<ranges::detect_adl_size, _InputOffsets>) {
+			using _SizeType = decltype(ranges::ranges_adl::adl_size(__output_offsets));
+			if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputOffsets, _SizeType>) {
+				__output_offsets.reserve(static_cast<_SizeType>(ranges::ranges_adl::adl_size(__output_offsets)
+					+ ranges::ranges_adl::adl_size(__input_offsets) - 1));
+			}
+			if constexpr (is_detected_v<ranges::detect_adl_size, _OutputOutcomes>) {
+				using _OutcomesSizeType = decltype(ranges::ranges_adl::adl_size(__output_outcomes));
+				if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputOutcomes, _OutcomesSizeType>) {
+					__output_outcomes.reserve(
+						static_cast<_OutcomesSizeType>(ranges::ranges_adl::adl_size(__output_outcomes)
+							+ ranges::ranges_adl::adl_size(__input_offsets) - 1));
+				}
+			}
+		}
+		{
+			using _SizeType = decltype(ranges::ranges_adl::adl_size(__output));
+			if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputContainer, _SizeType>) {
+				__output.reserve(static_cast<_SizeType>(ranges::ranges_adl::adl_size(__output)
+					+ ranges::ranges_adl::adl_size(__input_data)));
+			}
+		}
+
+		constexpr ::std::size_t __intermediate_buffer_min = max_code_points_v<_UFromEncoding>;
+		constexpr ::std::size_t __intermediate_buffer_max
+			= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_CodePoint) < __intermediate_buffer_min
+			? __intermediate_buffer_min
+			: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_CodePoint);
+
+		return __txt_detail::__with_scratch_buffer<_CodePoint, __intermediate_buffer_max, __intermediate_buffer_min>(
+			[&](_PivotSpan __intermediate) {
+				const _CodeUnit* __data         = ranges::ranges_adl::adl_data(__input_data);
+				const ::std::size_t __data_size = ranges::ranges_adl::adl_size(__input_data);
+				::std::size_t __handled_errors  = 0;
+				::std::size_t __index           = 0;
+				::std::size_t __error_index     = 0;
+				encoding_error __error_code     = encoding_error::ok;
+				::std::size_t __input_first     = static_cast<::std::size_t>(*__offsets_first);
+				for (++__offsets_first; __offsets_first != __offsets_last; ++__offsets_first, ++__index) {
+					const ::std::size_t __input_last = static_cast<::std::size_t>(*__offsets_first);
+					ZTD_TEXT_ASSERT_MESSAGE("input offsets must be ascending and within the input data",
+						__input_first <= __input_last && __input_last <= __data_size);
+					const auto __output_size = ranges::ranges_adl::adl_size(__output);
+					_InputSpan __input(__data + __input_first, __input_last - __input_first);
+					// every input gets its own, fresh states
+					_FromState __from_state = make_decode_state(__from_encoding);
+					_ToState __to_state     = make_encode_state(__to_encoding);
+					pivot<_PivotSpan> __pivot { __intermediate, encoding_error::ok };
+					auto __result = transcode_into_container(__input, __from_encoding, __output, __to_encoding,
+						__from_error_handler, __to_error_handler, __from_state, __to_state, __pivot);
+					__handled_errors += __result.handled_errors;
+					if (__result.error_code != encoding_error::ok) {
+						// leave this one with an empty output range and carry on with the rest
+						__output.erase(ranges::ranges_adl::adl_begin(__output) + __output_size,
+							ranges::ranges_adl::adl_end(__output));
+						if (__error_code == encoding_error::ok) {
+							__error_code  = __result.error_code;
+							__error_index = __index;
+						}
+					}
+					__output_offsets.push_back(static_cast<_OutputOffset>(ranges::ranges_adl::adl_size(__output)));
+					__output_outcomes.push_back(
+						transcode_batch_outcome(__result.error_code, __result.handled_errors));
+					__input_first = __input_last;
+				}
+				if (__error_code == encoding_error::ok) {
+					__error_index = __index;
+				}
+				return _Result(__output, __output_offsets, __error_code, __error_index, __handled_errors);
+			});
+	}
+
+	//////
+	/// @brief Transcodes every input in `__input_data` delimited by `__input_offsets`, appending the results to the
+	/// `__output` container and the output offsets to the `__output_offsets` container.
+	///
+	/// @param[in]     __input_offsets A range of `N + 1` offsets into `__input_data`, delimiting `N` inputs.
+	/// @param[in]     __input_data A contiguous range of code units holding all of the inputs.
+	/// @param[in]     __from_encoding The encoding that will be used to decode each input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append every input's encoded code units to.
+	/// @param[in,out] __output_offsets The container to append the output offsets to.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	///
+	/// @remarks This calls the overload which also takes an outcomes container, without keeping the outcomes of
+	/// each input.
+	template <typename _InputOffsets, typename _InputData, typename _FromEncoding, typename _OutputContainer,
+		typename _OutputOffsets, typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler>
+	constexpr auto transcode_batch_into_container(_InputOffsets&& __input_offsets, _InputData&& __input_data,
+		_FromEncoding&& __from_encoding, _OutputContainer& __output, _OutputOffsets& __output_offsets,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler) {
+		__txt_detail::__ignore_batch_outcomes __output_outcomes {};
+
+		return transcode_batch_into_container(::std::forward<_InputOffsets>(__input_offsets),
+			::std::forward<_InputData>(__input_data), ::std::forward<_FromEncoding>(__from_encoding), __output,
+			__output_offsets, ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __output_outcomes);
+	}
+
+	//////
+	/// @brief Transcodes every input in `__input_data` delimited by `__input_offsets`, appending the results to the
+	/// `__output` container and the output offsets to the `__output_offsets` container.
+	///
+	/// @param[in]     __input_offsets A range of `N + 1` offsets into `__input_data`, delimiting `N` inputs.
+	/// @param[in]     __input_data A contiguous range of code units holding all of the inputs.
+	/// @param[in]     __from_encoding The encoding that will be used to decode each input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append every input's encoded code units to.
+	/// @param[in,out] __output_offsets The container to append the output offsets to.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	///
+	/// @remarks A `to_error_handler` for the encode step is created by duplicating `__from_error_handler` or, if that
+	/// is not possible, using a careless ztd::text::default_handler_t.
+	template <typename _InputOffsets, typename _InputData, typename _FromEncoding, typename _OutputContainer,
+		typename _OutputOffsets, typename _ToEncoding, typename _FromErrorHandler>
+	constexpr auto transcode_batch_into_container(_InputOffsets&& __input_offsets, _InputData&& __input_data,
+		_FromEncoding&& __from_encoding, _OutputContainer& __output, _OutputOffsets& __output_offsets,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler) {
+		auto __handler = __txt_detail::__duplicate_or_be_careless(__from_error_handler);
+
+		return transcode_batch_into_container(::std::forward<_InputOffsets>(__input_offsets),
+			::std::forward<_InputData>(__input_data), ::std::forward<_FromEncoding>(__from_encoding), __output,
+			__output_offsets, ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler), __handler);
+	}
+
+	//////
+	/// @brief Transcodes every input in `__input_data` delimited by `__input_offsets`, appending the results to the
+	/// `__output` container and the output offsets to the `__output_offsets` container.
+	///
+	/// @param[in]     __input_offsets A range of `N + 1` offsets into `__input_data`, delimiting `N` inputs.
+	/// @param[in]     __input_data A contiguous range of code units holding all of the inputs.
+	/// @param[in]     __from_encoding The encoding that will be used to decode each input's code units into
+	/// intermediate code points.
+	/// @param[in,out] __output The container to append every input's encoded code units to.
+	/// @param[in,out] __output_offsets The container to append the output offsets to.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	///
+	/// @remarks A `from_error_handler` is created using default construction of a ztd::text::default_handler_t that is
+	/// marked as careless.
+	template <typename _InputOffsets, typename _InputData, typename _FromEncoding, typename _OutputContainer,
+		typename _OutputOffsets, typename _ToEncoding>
+	constexpr auto transcode_batch_into_container(_InputOffsets&& __input_offsets, _InputData&& __input_data,
+		_FromEncoding&& __from_encoding, _OutputContainer& __output, _OutputOffsets& __output_offsets,
+		_ToEncoding&& __to_encoding) {
+		default_handler_t __handler {};
+
+		return transcode_batch_into_container(::std::forward<_InputOffsets>(__input_offsets),
+			::std::forward<_InputData>(__input_data), ::std::forward<_FromEncoding>(__from_encoding), __output,
+			__output_offsets, ::std::forward<_ToEncoding>(__to_encoding), __handler);
+	}
+
+	//////
+	/// @brief Transcodes every input in `__input_data` delimited by `__input_offsets` into one output container
+	/// and one output offsets container, which are returned in a result structure.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a `std::vector` of some sort.
+	/// @tparam _OutputOffsets The container to default-construct and put the output offsets into. Defaults to a @c
+	/// std::vector of the `__input_offsets` 's value type.
+	///
+	/// @param[in] __input_offsets A range of `N + 1` offsets into `__input_data`, delimiting `N` inputs.
+	/// @param[in] __input_data A contiguous range of code units holding all of the inputs.
+	/// @param[in] __from_encoding The encoding that will be used to decode each input's code units into
+	/// intermediate code points.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in] __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in] __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	/// @param[in,out] __output_outcomes The container to append one ztd::text::transcode_batch_outcome per input to,
+	/// in the same order as the inputs.
+	///
+	/// @returns A ztd::text::transcode_batch_result holding the `_OutputContainer` and the `_OutputOffsets`.
+	template <typename _OutputContainer = void, typename _OutputOffsets = void, typename _InputOffsets,
+		typename _InputData, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+		typename _ToErrorHandler, typename _OutputOutcomes>
+	constexpr auto transcode_batch(_InputOffsets&& __input_offsets, _InputData&& __input_data,
+		_FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler, _OutputOutcomes& __output_outcomes) {
+		using _UToEncoding              = remove_cvref_t<_ToEncoding>;
+		using _OutputCodeUnit           = code_unit_t<_UToEncoding>;
+		using _InputOffset              = remove_cvref_t<ranges::range_value_type_t<remove_cvref_t<_InputOffsets>>>;
+		constexpr bool _IsVoidContainer = ::std::is_void_v<_OutputContainer>;
+		constexpr bool _IsStringable
+			= (is_char_traitable_v<_OutputCodeUnit> || is_unicode_code_point_v<_OutputCodeUnit>);
+		using _RealOutputContainer      = ::std::conditional_t<_IsVoidContainer,
+               ::std::conditional_t<_IsStringable, ::std::basic_string<_OutputCodeUnit>,
+                    ::std::vector<_OutputCodeUnit>>,
+               _OutputContainer>;
+		using _RealOutputOffsets
+			= ::std::conditional_t<::std::is_void_v<_OutputOffsets>, ::std::vector<_InputOffset>, _OutputOffsets>;
+		using _Result = transcode_batch_result<_RealOutputContainer, _RealOutputOffsets>;
+
+		_RealOutputContainer __output {};
+		_RealOutputOffsets __output_offsets {};
+		auto __result = transcode_batch_into_container(::std::forward<_InputOffsets>(__input_offsets),
+			::std::forward<_InputData>(__input_data), ::std::forward<_FromEncoding>(__from_encoding), __output,
+			__output_offsets, ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __output_outcomes);
+		return _Result(::std::move(__output), ::std::move(__output_offsets), __result.error_code,
+			__result.error_index, __result.handled_errors);
+	}
+
+	//////
+	/// @brief Transcodes every input in `__input_data` delimited by `__input_offsets` into one output container
+	/// and one output offsets container, which are returned in a result structure.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into.
+	/// @tparam _OutputOffsets The container to default-construct and put the output offsets into.
+	///
+	/// @param[in] __input_offsets A range of `N + 1` offsets into `__input_data`, delimiting `N` inputs.
+	/// @param[in] __input_data A contiguous range of code units holding all of the inputs.
+	/// @param[in] __from_encoding The encoding that will be used to decode each input's code units into
+	/// intermediate code points.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in] __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in] __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	///
+	/// @remarks This calls the overload which also takes an outcomes container, without keeping the outcomes of
+	/// each input.
+	template <typename _OutputContainer = void, typename _OutputOffsets = void, typename _InputOffsets,
+		typename _InputData, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+		typename _ToErrorHandler>
+	constexpr auto transcode_batch(_InputOffsets&& __input_offsets, _InputData&& __input_data,
+		_FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler) {
+		__txt_detail::__ignore_batch_outcomes __output_outcomes {};
+
+		return transcode_batch<_OutputContainer, _OutputOffsets>(::std::forward<_InputOffsets>(__input_offsets),
+			::std::forward<_InputData>(__input_data), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __output_outcomes);
+	}
+
+	//////
+	/// @brief Transcodes every input in `__input_data` delimited by `__input_offsets` into one output container
+	/// and one output offsets container, which are returned in a result structure.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into.
+	/// @tparam _OutputOffsets The container to default-construct and put the output offsets into.
+	///
+	/// @param[in] __input_offsets A range of `N + 1` offsets into `__input_data`, delimiting `N` inputs.
+	/// @param[in] __input_data A contiguous range of code units holding all of the inputs.
+	/// @param[in] __from_encoding The encoding that will be used to decode each input's code units into
+	/// intermediate code points.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in] __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	///
+	/// @remarks A `to_error_handler` for the encode step is created by duplicating `__from_error_handler` or, if that
+	/// is not possible, using a careless ztd::text::default_handler_t.
+	template <typename _OutputContainer = void, typename _OutputOffsets = void, typename _InputOffsets,
+		typename _InputData, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler>
+	constexpr auto transcode_batch(_InputOffsets&& __input_offsets, _InputData&& __input_data,
+		_FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler) {
+		auto __handler = __txt_detail::__duplicate_or_be_careless(__from_error_handler);
+
+		return transcode_batch<_OutputContainer, _OutputOffsets>(::std::forward<_InputOffsets>(__input_offsets),
+			::std::forward<_InputData>(__input_data), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+			__handler);
+	}
+
+	//////
+	/// @brief Transcodes every input in `__input_data` delimited by `__input_offsets` into one output container
+	/// and one output offsets container, which are returned in a result structure.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into.
+	/// @tparam _OutputOffsets The container to default-construct and put the output offsets into.
+	///
+	/// @param[in] __input_offsets A range of `N + 1` offsets into `__input_data`, delimiting `N` inputs.
+	/// @param[in] __input_data A contiguous range of code units holding all of the inputs.
+	/// @param[in] __from_encoding The encoding that will be used to decode each input's code units into
+	/// intermediate code points.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	///
+	/// @remarks A `from_error_handler` is created using default construction of a ztd::text::default_handler_t that is
+	/// marked as careless.
+	template <typename _OutputContainer = void, typename _OutputOffsets = void, typename _InputOffsets,
+		typename _InputData, typename _FromEncoding, typename _ToEncoding>
+	constexpr auto transcode_batch(_InputOffsets&& __input_offsets, _InputData&& __input_data,
+		_FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding) {
+		default_handler_t __handler {};
+
+		return transcode_batch<_OutputContainer, _OutputOffsets>(::std::forward<_InputOffsets>(__input_offsets),
+			::std::forward<_InputData>(__input_data), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), __handler);
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_TRANSCODE_BATCH_HPP
@@ -0,0 +1,179 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_TRANSCODE_IN_PLACE_HPP
+#define ZTD_TEXT_TRANSCODE_IN_PLACE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/transcode_result.hpp>
+#include <ztd/text/detail/in_place_routines.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		inline constexpr ::std::size_t __in_place_spill_capacity = 256;
+
+		// Walks the input without writing anything, checking that it is valid and that the output, written from
+		// the front, never gets more than the spill can hold ahead of the read position and fits in the end.
+		template <typename _FromEncoding, typename _ToEncoding>
+		encoding_error __utf_in_place_check(
+			const ::std::byte* __first, ::std::size_t __size, ::std::size_t& __read_count) noexcept {
+			::std::byte __encoded[__utf_max_bytes_v<_ToEncoding>] {};
+			::std::size_t __read    = 0;
+			::std::size_t __written = 0;
+			while (__read < __size) {
+				char32_t __code_point = 0;
+				const ::std::size_t __in_bytes
+					= __utf_in_place_read<_FromEncoding>(__first + __read, __size - __read, __code_point);
+				if (__in_bytes == 0) {
+					__read_count = __read;
+					return encoding_error::invalid_sequence;
+				}
+				__read += __in_bytes;
+				__written += __utf_in_place_encode<_ToEncoding>(__code_point, __encoded);
+				if (__written > __read && __written - __read > __in_place_spill_capacity) {
+					__read_count = 0;
+					return encoding_error::insufficient_output_space;
+				}
+			}
+			__read_count = 0;
+			return __written > __size ? encoding_error::insufficient_output_space : encoding_error::ok;
+		}
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_transcode_in_place ztd::text::transcode_in_place
+	/// @brief These functions convert UTF text inside of the buffer it is stored in, without a second buffer for the
+	/// output.
+	/// @{
+
+	//////
+	/// @brief Converts the code units stored in `__buffer` from the `__from_encoding` to the `__to_encoding`, writing
+	/// the output over the input from the front of the same buffer.
+	///
+	/// @param[in, out] __buffer The bytes of the input code units, in native endianness and at any alignment. On
+	/// success, the front of it holds the output code units.
+	/// @param[in] __from_encoding The UTF-8, UTF-16 or UTF-32 encoding the buffer is in.
+	/// @param[in] __to_encoding The UTF-8, UTF-16 or UTF-32 encoding to convert the buffer to.
+	///
+	/// @returns A ztd::text::stateless_transcode_result whose `input` is the part of the buffer that was not read and
+	/// whose `output` is the part of the buffer that was not written: the output is the first `__buffer.size() -
+	/// result.output.size()` bytes of the buffer.
+	///
+	/// @remarks When no code point ever takes more bytes in the `__to_encoding` than in the `__from_encoding` (UTF-32
+	/// to UTF-16 or UTF-8, or to the same encoding), this is known at compile-time to be safe and is done in a single
+	/// pass. If an ill-formed sequence is found, the function stops there with
+	/// ztd::text::encoding_error::invalid_sequence: the output written so far is valid, and `input` starts at the
+	/// ill-formed sequence. For every other pair (such as UTF-16 to UTF-8, which only shrinks below U+0800), the input
+	/// is checked first without writing anything: if it is ill-formed, or the output would ever get more than a
+	/// small, fixed-size spill buffer ahead of the input, or the output would not fit in the buffer, the function
+	/// returns the error with nothing written. Otherwise, the conversion cannot fail and the output is written, with
+	/// the spill buffer holding on to anything that is temporarily ahead of the read position.
+	template <typename _FromEncoding, typename _ToEncoding>
+	auto transcode_in_place(
+		::ztd::span<::std::byte> __buffer, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding) {
+		using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = remove_cvref_t<_ToEncoding>;
+		using _Result        = stateless_transcode_result<::ztd::span<::std::byte>, ::ztd::span<::std::byte>>;
+		using _Spill         = __txt_detail::__in_place_spill<__txt_detail::__in_place_spill_capacity,
+               __txt_detail::__utf_max_bytes_v<_UToEncoding>>;
+		static_assert(__txt_detail::__utf_bulk_width_v<_UFromEncoding> != 0 // cf
+			     && __txt_detail::__utf_bulk_width_v<_UToEncoding> != 0,
+			"in-place transcoding is only available between the UTF-8, UTF-16 and UTF-32 encodings");
+		constexpr bool _IsAlwaysShrinking = __txt_detail::__is_utf_always_shrinking_v<_UFromEncoding, _UToEncoding>;
+		(void)__from_encoding;
+		(void)__to_encoding;
+
+		::std::byte* const __first = __buffer.data();
+		const ::std::size_t __size = __buffer.size();
+		if constexpr (!_IsAlwaysShrinking) {
+			::std::size_t __read_count = 0;
+			const encoding_error __error_code
+				= __txt_detail::__utf_in_place_check<_UFromEncoding, _UToEncoding>(__first, __size, __read_count);
+			if (__error_code != encoding_error::ok) {
+				return _Result(__buffer.subspan(__read_count), __buffer, __error_code);
+			}
+		}
+
+		::std::byte __encoded[__txt_detail::__utf_max_bytes_v<_UToEncoding>] {};
+		_Spill __spill {};
+		::std::size_t __read    = 0;
+		::std::size_t __written = 0;
+		while (__read < __size) {
+			char32_t __code_point = 0;
+			const ::std::size_t __in_bytes = __txt_detail::__utf_in_place_read<_UFromEncoding>(
+				__first + __read, __size - __read, __code_point);
+			if (__in_bytes == 0) {
+				// only reachable for the always-shrinking pairs: everything else was checked up front
+				return _Result(
+					__buffer.subspan(__read), __buffer.subspan(__written), encoding_error::invalid_sequence);
+			}
+			// the code point is out of the buffer now: its own bytes are free to be written over
+			__read += __in_bytes;
+			const ::std::size_t __out_bytes
+				= __txt_detail::__utf_in_place_encode<_UToEncoding>(__code_point, __encoded);
+			if (_IsAlwaysShrinking || (__spill._M_empty() && __written + __out_bytes <= __read)) {
+				::std::memcpy(__first + __written, __encoded, __out_bytes);
+				__written += __out_bytes;
+			}
+			else {
+				__spill._M_push(__encoded, __out_bytes);
+				__written += __spill._M_flush(__first + __written, __read - __written);
+			}
+		}
+		if (!__spill._M_empty()) {
+			__written += __spill._M_flush(__first + __written, __size - __written);
+		}
+		return _Result(__buffer.subspan(__read), __buffer.subspan(__written), encoding_error::ok);
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_TRANSCODE_IN_PLACE_HPP
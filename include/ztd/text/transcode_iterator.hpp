@@ -41,6 +41,7 @@
 #include <ztd/text/detail/encoding_iterator.hpp>
 #include <ztd/text/detail/encoding_iterator_storage.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
 
 #include <ztd/idk/unwrap.hpp>
 #include <ztd/idk/ebco.hpp>
@@ -73,6 +74,8 @@ namespace ztd { namespace text {
 	/// @tparam _ToErrorHandler The error handler for any encode-step failures.
 	/// @tparam _FromState The state type to use for the decode operations to intermediate code points.
 	/// @tparam _ToState The state type to use for the encode operations to intermediate code points.
+	/// @tparam _CacheSize The number of code units the iterator may hold at once. The default of `0` holds exactly
+	/// what one transcode operation can produce.
 	///
 	/// @remarks This type produces proxies as their reference type, and are only readable, not writable iterators. The
 	/// type will also try many different shortcuts for decoding the input and encoding the intermediates,
@@ -83,8 +86,14 @@ namespace ztd { namespace text {
 	/// example, one (1) UTF-16 code unit becomes two (2) UTF-8 code units, it will present each code unit one at a
 	/// time. If you are looking to explicitly know each collection of characters, you will have to use lower-level
 	/// interfaces.
+	///
+	/// @remarks A `_CacheSize` larger than the `_ToEncoding`'s ztd::text::max_code_units_v lets the iterator
+	/// transcode many code units ahead every time its cache runs dry, so most increments only bump a position. Reading
+	/// ahead is only done if neither error handler ever reports an error and the range is not an input or output
+	/// range: otherwise, the iterator still transcodes one step at a time so that the error codes and the underlying
+	/// range() stay exact.
 	template <typename _FromEncoding, typename _ToEncoding, typename _Range, typename _FromErrorHandler,
-		typename _ToErrorHandler, typename _FromState, typename _ToState>
+		typename _ToErrorHandler, typename _FromState, typename _ToState, ::std::size_t _CacheSize = 0>
 	class transcode_iterator
 	: private ebco<remove_cvref_t<_FromEncoding>, 1>,
 	  private ebco<remove_cvref_t<_ToEncoding>, 2>,
@@ -92,7 +101,8 @@ namespace ztd { namespace text {
 	  private ebco<remove_cvref_t<_ToErrorHandler>, 4>,
 	  private __txt_detail::__state_storage<remove_cvref_t<_FromEncoding>, remove_cvref_t<_FromState>, 0>,
 	  private __txt_detail::__state_storage<remove_cvref_t<_ToEncoding>, remove_cvref_t<_ToState>, 1>,
-	  private __txt_detail::__cursor_cache<max_code_units_v<unwrap_remove_cvref_t<_ToEncoding>>,
+	  private __txt_detail::__cursor_cache<
+		  __txt_detail::__iterator_cache_size_v<max_code_units_v<unwrap_remove_cvref_t<_ToEncoding>>, _CacheSize>,
 		  ranges::is_range_input_or_output_range_v<unwrap_remove_cvref_t<_Range>>>,
 	  private __txt_detail::__error_cache<
 		  decode_error_handler_always_returns_ok_v<unwrap_remove_cvref_t<_FromEncoding>,
@@ -111,14 +121,22 @@ namespace ztd { namespace text {
 		using _UToState                                  = unwrap_remove_cvref_t<_ToState>;
 		using _BaseIterator                              = ranges::range_iterator_t<_URange>;
 		using _IntermediateCodePoint                     = code_point_t<_UToEncoding>;
-		inline static constexpr ::std::size_t _MaxValues = max_code_units_v<_UToEncoding>;
-		inline static constexpr bool _IsSingleValueType  = _MaxValues == 1;
-		inline static constexpr bool _IsInputOrOutput    = ranges::is_range_input_or_output_range_v<_URange>;
-		inline static constexpr bool _IsCursorless       = _IsSingleValueType && !_IsInputOrOutput;
+		inline static constexpr ::std::size_t _MaxValues   = max_code_units_v<_UToEncoding>;
+		inline static constexpr ::std::size_t _CacheValues
+			= __txt_detail::__iterator_cache_size_v<_MaxValues, _CacheSize>;
+		inline static constexpr bool _IsSingleValueType    = _CacheValues == 1;
+		inline static constexpr bool _IsInputOrOutput      = ranges::is_range_input_or_output_range_v<_URange>;
+		inline static constexpr bool _IsCursorless         = _IsSingleValueType && !_IsInputOrOutput;
 		inline static constexpr bool _IsErrorless
 			= decode_error_handler_always_returns_ok_v<_UFromEncoding,
 			       _UFromErrorHandler> && encode_error_handler_always_returns_ok_v<_UToEncoding, _UToErrorHandler>;
-		using __base_cursor_cache_t       = __txt_detail::__cursor_cache<_MaxValues, _IsInputOrOutput>;
+		// reading ahead is only done when no error can ever be reported, so the error codes stay exact
+		inline static constexpr bool _IsBatched = _CacheValues > _MaxValues && _IsErrorless && !_IsInputOrOutput;
+		inline static constexpr bool _IsUtfBulkTranscodable
+			= __txt_detail::__utf_bulk_width_v<_UFromEncoding> != 0 // cf
+			&& __txt_detail::__utf_bulk_width_v<_UToEncoding> != 0  // cf
+			&& __txt_detail::__is_contiguous_range_of_v<_URange, code_unit_t<_UFromEncoding>>;
+		using __base_cursor_cache_t       = __txt_detail::__cursor_cache<_CacheValues, _IsInputOrOutput>;
 		using __base_cursor_cache_size_t  = typename __base_cursor_cache_t::_SizeType;
 		using __base_error_cache_t        = __txt_detail::__error_cache<_IsErrorless>;
 		using __base_from_encoding_t      = ebco<remove_cvref_t<_FromEncoding>, 1>;
@@ -534,6 +552,14 @@ namespace ztd { namespace text {
 		}
 
 	private:
+		// reading calls into the encodings and the user's error handlers, which may well throw
+		inline static constexpr bool _IsReadNoexcept = noexcept(transcode_one_into(
+			::std::declval<::std::conditional_t<_IsInputOrOutput, _URange, _URange&>>(),
+			::std::declval<_UFromEncoding&>(), ::std::declval<::ztd::span<value_type, _MaxValues>&>(),
+			::std::declval<_UToEncoding&>(), ::std::declval<_UFromErrorHandler&>(),
+			::std::declval<_UToErrorHandler&>(), ::std::declval<_UFromState&>(), ::std::declval<_UToState&>(),
+			::std::declval<pivot<::ztd::span<_IntermediateCodePoint, max_code_points_v<_UFromEncoding>>>&>()));
+
 		constexpr bool _M_base_is_empty() const noexcept {
 			if constexpr (is_detected_v<ranges::detect_adl_empty, _Range>) {
 				return ranges::ranges_adl::adl_empty(this->__base_range_t::get_value());
@@ -544,7 +570,7 @@ namespace ztd { namespace text {
 			}
 		}
 
-		constexpr void _M_read_one() noexcept {
+		constexpr void _M_read_one() noexcept(_IsReadNoexcept) {
 			if (this->_M_base_is_empty()) {
 				if constexpr (_IsCursorless || (_IsSingleValueType && _IsInputOrOutput)) {
 					this->__base_cursor_cache_t::_M_size
@@ -558,6 +584,10 @@ namespace ztd { namespace text {
 				}
 				return;
 			}
+			if constexpr (_IsBatched) {
+				this->_M_read_many();
+				return;
+			}
 
 			auto& __this_input_range = this->_M_range();
 			auto __this_cache_begin  = this->_M_cache.data();
@@ -597,6 +627,44 @@ namespace ztd { namespace text {
 			}
 		}
 
+		constexpr void _M_read_many() noexcept(_IsReadNoexcept) {
+			value_type* __cache_first = this->_M_cache.data();
+			::std::size_t __written   = 0;
+			_IntermediateCodePoint __intermediate_storage[max_code_points_v<_UFromEncoding>] {};
+			using _Intermediate = ::ztd::span<_IntermediateCodePoint, max_code_points_v<_UFromEncoding>>;
+			for (;;) {
+				if constexpr (_IsUtfBulkTranscodable) {
+					// well-formed input goes straight into the cache: transcode_one only sees what this stops at
+					auto& __this_input_range      = this->_M_range();
+					::std::size_t __read_count    = 0;
+					::std::size_t __written_count = 0;
+					__txt_detail::__utf_bulk_convert<__txt_detail::__utf_bulk_width_v<_UFromEncoding>,
+						__txt_detail::__utf_bulk_width_v<_UToEncoding>>(
+						ranges::ranges_adl::adl_data(__this_input_range),
+						ranges::ranges_adl::adl_size(__this_input_range), __read_count, __cache_first + __written,
+						_CacheValues - __written, __written_count);
+					this->__base_range_t::get_value() = ranges::reconstruct(::std::in_place_type<_URange>,
+						ranges::ranges_adl::adl_begin(__this_input_range) + __read_count,
+						ranges::ranges_adl::adl_end(__this_input_range));
+					__written += __written_count;
+				}
+				if (_CacheValues - __written < _MaxValues || this->_M_base_is_empty()) {
+					break;
+				}
+				::ztd::span<value_type, _MaxValues> __cache_view(__cache_first + __written, _MaxValues);
+				_Intermediate __intermediate(__intermediate_storage);
+				pivot<_Intermediate> __pivot { __intermediate, encoding_error::ok };
+				auto __result = transcode_one_into(this->_M_range(), this->from_encoding(), __cache_view,
+					this->to_encoding(), this->from_handler(), this->to_handler(), this->from_state(),
+					this->to_state(), __pivot);
+				__written     = static_cast<::std::size_t>(
+					::ztd::to_address(ranges::ranges_adl::adl_begin(__result.output)) - __cache_first);
+				this->__base_range_t::get_value() = ::std::move(__result.input);
+			}
+			this->__base_cursor_cache_t::_M_position = static_cast<__base_cursor_cache_size_t>(0);
+			this->__base_cursor_cache_t::_M_size     = static_cast<__base_cursor_cache_size_t>(__written);
+		}
+
 		constexpr _URange& _M_range() noexcept {
 			return this->__base_range_t::get_value();
 		}
@@ -605,7 +673,7 @@ namespace ztd { namespace text {
 			return this->__base_range_t::get_value();
 		}
 
-		::std::array<value_type, _MaxValues> _M_cache;
+		::std::array<value_type, _CacheValues> _M_cache;
 	};
 
 	//////
@@ -0,0 +1,330 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_TRANSCODE_OR_BORROW_HPP
+#define ZTD_TEXT_TRANSCODE_OR_BORROW_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/is_transcoding_compatible.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/validate_and_count_as_transcoded.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/span_or_reconstruct.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/char_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		// Whether a view of the input can outlive the call it was passed to.
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_BORROWED_RANGE)
+		template <typename _Input>
+		inline constexpr bool __is_borrowable_input_v
+			= ::std::is_lvalue_reference_v<_Input> || ::std::ranges::enable_borrowed_range<remove_cvref_t<_Input>>;
+#else
+		template <typename _Input>
+		inline constexpr bool __is_borrowable_input_v
+			= ::std::is_lvalue_reference_v<_Input> || ::ztd::ranges::enable_borrowed_range<remove_cvref_t<_Input>>;
+#endif
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_transcode_or_borrow ztd::text::transcode_or_borrow
+	/// @brief These functions hand back a view of the input itself when it is already valid in the target encoding,
+	/// and only transcode into a new container when they must.
+	/// @{
+
+	//////
+	/// @brief Either a view of code units borrowed from the input of ztd::text::transcode_or_borrow, or a container
+	/// that owns newly transcoded code units.
+	///
+	/// @tparam _Container The container used when the input could not be borrowed.
+	///
+	/// @remarks A borrowed result refers to the original input: it must not outlive it. The container must store its
+	/// code units contiguously.
+	template <typename _Container>
+	class borrowed_or_transcoded {
+	public:
+		//////
+		/// @brief The container used when the input could not be borrowed.
+		using container_type = _Container;
+		//////
+		/// @brief The code unit type.
+		using value_type = ranges::range_value_type_t<_Container>;
+		//////
+		/// @brief The view type over the code units, whichever way they are stored.
+		using view_type = ::ztd::span<const value_type>;
+		//////
+		/// @brief The iterator type.
+		using iterator = typename view_type::iterator;
+
+		//////
+		/// @brief Constructs a result that borrows the given code units.
+		///
+		/// @param[in] __borrowed The code units to refer to.
+		constexpr borrowed_or_transcoded(view_type __borrowed) noexcept(
+			::std::is_nothrow_default_constructible_v<container_type>)
+		: _M_borrowed(__borrowed), _M_container(), _M_is_borrowed(true) {
+		}
+
+		//////
+		/// @brief Constructs a result that owns the given container of code units.
+		///
+		/// @param[in] __container The container of transcoded code units.
+		constexpr borrowed_or_transcoded(container_type&& __container) noexcept(
+			::std::is_nothrow_move_constructible_v<container_type>)
+		: _M_borrowed(), _M_container(::std::move(__container)), _M_is_borrowed(false) {
+		}
+
+		//////
+		/// @brief Whether the code units are borrowed from the input, rather than owned by this result.
+		constexpr bool is_borrowed() const noexcept {
+			return this->_M_is_borrowed;
+		}
+
+		//////
+		/// @brief A view of the code units, whichever way they are stored.
+		constexpr view_type view() const noexcept {
+			if (this->_M_is_borrowed) {
+				return this->_M_borrowed;
+			}
+			return view_type(ranges::ranges_adl::adl_data(this->_M_container),
+				ranges::ranges_adl::adl_size(this->_M_container));
+		}
+
+		//////
+		/// @brief A pointer to the first code unit.
+		constexpr const value_type* data() const noexcept {
+			return this->view().data();
+		}
+
+		//////
+		/// @brief The number of code units.
+		constexpr ::std::size_t size() const noexcept {
+			return this->view().size();
+		}
+
+		//////
+		/// @brief Whether there are no code units.
+		constexpr bool empty() const noexcept {
+			return this->view().empty();
+		}
+
+		//////
+		/// @brief The beginning of the code units.
+		constexpr iterator begin() const noexcept {
+			return this->view().begin();
+		}
+
+		//////
+		/// @brief The end of the code units.
+		constexpr iterator end() const noexcept {
+			return this->view().end();
+		}
+
+		//////
+		/// @brief Moves out the owned container, or copies the borrowed code units into a new one.
+		constexpr container_type to_container() && {
+			if (this->_M_is_borrowed) {
+				return container_type(this->_M_borrowed.begin(), this->_M_borrowed.end());
+			}
+			return ::std::move(this->_M_container);
+		}
+
+	private:
+		view_type _M_borrowed;
+		container_type _M_container;
+		bool _M_is_borrowed;
+	};
+
+	//////
+	/// @brief Borrows the `__input` as code units of the `__to_encoding` if it is already valid in it, or transcodes
+	/// it into a new container otherwise.
+	///
+	/// @tparam _OutputContainer The container to transcode into when the input cannot be borrowed. Defaults the same
+	/// way as in ztd::text::transcode.
+	///
+	/// @param[in] __input The input range of code units.
+	/// @param[in] __from_encoding The encoding the input is in.
+	/// @param[in] __to_encoding The encoding the result should be in.
+	/// @param[in] __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in] __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	///
+	/// @returns A ztd::text::borrowed_or_transcoded that views the input directly if it could be borrowed, or owns the
+	/// transcoded code units otherwise.
+	///
+	/// @remarks The input is borrowed when the two encodings are bitwise compatible (see
+	/// ztd::text::is_bitwise_transcoding_compatible), the input is a contiguous range of code units that will outlive
+	/// the call (an lvalue or a borrowed range), and the input is valid. Validity is checked with
+	/// ztd::text::validate_and_count_as_transcoded, which works straight off of the code units for the UTF encodings;
+	/// if both error handlers are ignorable (see ztd::text::is_ignorable_error_handler), the input is assumed valid
+	/// and not checked at all. The input's code units are only ever viewed as the same type, or as `char`, `unsigned
+	/// char` or `std::byte`, which may look at any object. If the target encoding's code unit is some other type (e.g.
+	/// `char8_t` for a `std::string` input) and no `_OutputContainer` is given, the result is typed as the input's
+	/// code units instead: the input is borrowed as-is, and a transcoded result is copied into a container of the
+	/// input's code unit type. If an `_OutputContainer` of such a type is given, the input is not borrowed. In every
+	/// other case, this calls ztd::text::transcode with the given error handlers.
+	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler>
+	auto transcode_or_borrow(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler) {
+		using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = remove_cvref_t<_ToEncoding>;
+		using _FromCodeUnit  = code_unit_t<_UFromEncoding>;
+		using _WorkingInput  = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input&>;
+		using _ToContainer   = remove_cvref_t<decltype(transcode<_OutputContainer>(
+               ::std::declval<_Input>(), __from_encoding, __to_encoding, __from_error_handler, __to_error_handler))>;
+		using _ToCodeUnit    = ranges::range_value_type_t<_ToContainer>;
+		constexpr bool _IsBitwiseBorrowable = is_bitwise_transcoding_compatible_v<_UFromEncoding, _UToEncoding> // cf
+			&& __txt_detail::__is_contiguous_range_of_v<_WorkingInput, _FromCodeUnit>                          // cf
+			&& sizeof(_FromCodeUnit) == sizeof(_ToCodeUnit)                                                    // cf
+			&& __txt_detail::__is_borrowable_input_v<_Input>;
+		// only the same type, or one of the types which may look at any object, can view the input's code units
+		constexpr bool _IsAliasable = ::std::is_same_v<_ToCodeUnit, _FromCodeUnit>  // cf
+			|| ::std::is_same_v<_ToCodeUnit, char>                                 // cf
+			|| ::std::is_same_v<_ToCodeUnit, unsigned char>                        // cf
+			|| ::std::is_same_v<_ToCodeUnit, ::std::byte>;
+		constexpr bool _IsBorrowedAsInput
+			= _IsBitwiseBorrowable && !_IsAliasable && ::std::is_void_v<_OutputContainer>;
+		using _InputContainer = ::std::conditional_t<is_char_traitable_v<_FromCodeUnit>,
+			::std::basic_string<_FromCodeUnit>, ::std::vector<_FromCodeUnit>>;
+		using _Container      = ::std::conditional_t<_IsBorrowedAsInput, _InputContainer, _ToContainer>;
+		using _Result         = borrowed_or_transcoded<_Container>;
+		using _CodeUnit       = typename _Result::value_type;
+
+		if constexpr (_IsBitwiseBorrowable && (_IsAliasable || _IsBorrowedAsInput)) {
+			constexpr bool _IsAssumedValid = is_ignorable_error_handler_v<remove_cvref_t<_FromErrorHandler>> // cf
+				&& is_ignorable_error_handler_v<remove_cvref_t<_ToErrorHandler>>;
+			_WorkingInput __working_input = __txt_detail::__string_view_or_span_or_reconstruct(__input);
+			bool __is_valid               = _IsAssumedValid;
+			if constexpr (!_IsAssumedValid) {
+				__is_valid
+					= validate_and_count_as_transcoded(__working_input, __from_encoding, __to_encoding).valid;
+			}
+			if (__is_valid) {
+				const _FromCodeUnit* __input_data = ranges::ranges_adl::adl_data(__working_input);
+				const ::std::size_t __input_size  = ranges::ranges_adl::adl_size(__working_input);
+				if constexpr (::std::is_same_v<_CodeUnit, _FromCodeUnit>) {
+					return _Result(typename _Result::view_type(__input_data, __input_size));
+				}
+				else {
+					return _Result(typename _Result::view_type(
+						reinterpret_cast<const _CodeUnit*>(__input_data), __input_size));
+				}
+			}
+			auto __transcoded = transcode<_OutputContainer>(::std::move(__working_input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+				::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler));
+			if constexpr (_IsBorrowedAsInput) {
+				// the same code unit values, just stored as the input's type
+				return _Result(_Container(ranges::ranges_adl::adl_begin(__transcoded),
+					ranges::ranges_adl::adl_end(__transcoded)));
+			}
+			else {
+				return _Result(::std::move(__transcoded));
+			}
+		}
+		else {
+			return _Result(transcode<_OutputContainer>(::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+				::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler)));
+		}
+	}
+
+	//////
+	/// @brief Borrows the `__input` as code units of the `__to_encoding` if it is already valid in it, or transcodes
+	/// it into a new container otherwise.
+	///
+	/// @tparam _OutputContainer The container to transcode into when the input cannot be borrowed.
+	///
+	/// @param[in] __input The input range of code units.
+	/// @param[in] __from_encoding The encoding the input is in.
+	/// @param[in] __to_encoding The encoding the result should be in.
+	/// @param[in] __error_handler The error handler for both the decode and encode steps.
+	///
+	/// @remarks This function makes a copy of the `__error_handler` (if possible) and uses it for both steps.
+	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
+		typename _ErrorHandler>
+	auto transcode_or_borrow(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		_ErrorHandler&& __error_handler) {
+		auto __handler = __txt_detail::__duplicate_or_be_careless(__error_handler);
+		return transcode_or_borrow<_OutputContainer>(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_ErrorHandler>(__error_handler), __handler);
+	}
+
+	//////
+	/// @brief Borrows the `__input` as code units of the `__to_encoding` if it is already valid in it, or transcodes
+	/// it into a new container otherwise.
+	///
+	/// @tparam _OutputContainer The container to transcode into when the input cannot be borrowed.
+	///
+	/// @param[in] __input The input range of code units.
+	/// @param[in] __from_encoding The encoding the input is in.
+	/// @param[in] __to_encoding The encoding the result should be in.
+	///
+	/// @remarks Calls the next overload with an `error_handler` that is similar to ztd::text::default_handler_t.
+	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding>
+	auto transcode_or_borrow(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding) {
+		default_handler_t __handler {};
+		return transcode_or_borrow<_OutputContainer>(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding), __handler);
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_TRANSCODE_OR_BORROW_HPP
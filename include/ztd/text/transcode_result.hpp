@@ -194,6 +194,90 @@ namespace ztd { namespace text {
 		}
 	};
 
+	//////
+	/// @brief What happened to one of the inputs of a batch transcoding operation (such as
+	/// ztd_text_transcode_batch).
+	class transcode_batch_outcome {
+	public:
+		//////
+		/// @brief The kind of error that stopped this input from being transcoded, if any. If it is not
+		/// ztd::text::encoding_error::ok, the input's output range is empty.
+		encoding_error error_code;
+		//////
+		/// @brief How many errors the error handlers were invoked for in this input.
+		::std::size_t handled_errors;
+
+		//////
+		/// @brief Constructs a ztd::text::transcode_batch_outcome.
+		///
+		/// @param[in] __error_code The error code for this input.
+		/// @param[in] __handled_errors The number of errors that were handled for this input.
+		constexpr transcode_batch_outcome(encoding_error __error_code, ::std::size_t __handled_errors) noexcept
+		: error_code(__error_code), handled_errors(__handled_errors) {
+		}
+
+		//////
+		/// @brief Whether or not any errors were handled.
+		///
+		/// @returns Simply checks whether `handled_errors` is greater than 0.
+		constexpr bool errors_were_handled() const noexcept {
+			return this->handled_errors > 0;
+		}
+	};
+
+	//////
+	/// @brief The result of batch transcoding operations (such as ztd_text_transcode_batch), which convert many
+	/// separate inputs into one output with an offsets array.
+	template <typename _Output, typename _OutputOffsets>
+	class transcode_batch_result {
+	public:
+		//////
+		/// @brief The output, holding the transcoded code units of every input one after the other.
+		_Output output;
+		//////
+		/// @brief The offsets into the output. Element `i` and element `i + 1` are the beginning and end of the `i`th
+		/// converted input.
+		_OutputOffsets output_offsets;
+		//////
+		/// @brief The kind of error that stopped the first input that could not be transcoded, if any.
+		encoding_error error_code;
+		//////
+		/// @brief The index of the first input that could not be transcoded. If there was no error, this is the
+		/// number of inputs.
+		::std::size_t error_index;
+		//////
+		/// @brief How many errors the error handlers were invoked for, over all of the inputs.
+		::std::size_t handled_errors;
+
+		//////
+		/// @brief Constructs a ztd::text::transcode_batch_result.
+		///
+		/// @param[in] __output The output to store.
+		/// @param[in] __output_offsets The output offsets to store.
+		/// @param[in] __error_code The error code of the first input that could not be transcoded, if any.
+		/// @param[in] __error_index The index of the first input that could not be transcoded.
+		/// @param[in] __handled_errors The number of errors that were handled.
+		template <typename _ArgOutput, typename _ArgOutputOffsets>
+		constexpr transcode_batch_result(_ArgOutput&& __output, _ArgOutputOffsets&& __output_offsets,
+			encoding_error __error_code, ::std::size_t __error_index,
+			::std::size_t __handled_errors) noexcept(::std::is_nothrow_constructible_v<_Output, _ArgOutput> // cf
+			     && ::std::is_nothrow_constructible_v<_OutputOffsets, _ArgOutputOffsets>)
+		: output(::std::forward<_ArgOutput>(__output))
+		, output_offsets(::std::forward<_ArgOutputOffsets>(__output_offsets))
+		, error_code(__error_code)
+		, error_index(__error_index)
+		, handled_errors(__handled_errors) {
+		}
+
+		//////
+		/// @brief Whether or not any errors were handled.
+		///
+		/// @returns Simply checks whether `handled_errors` is greater than 0.
+		constexpr bool errors_were_handled() const noexcept {
+			return this->handled_errors > 0;
+		}
+	};
+
 	//////
 	/// @}
 	/////
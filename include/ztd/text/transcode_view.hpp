@@ -68,6 +68,8 @@ namespace ztd { namespace text {
 	/// @tparam _ToErrorHandler The error handler for any encode-step failures.
 	/// @tparam _FromState The state type to use for the decode operations to intermediate code points.
 	/// @tparam _ToState The state type to use for the encode operations to intermediate code points.
+	/// @tparam _CacheSize The number of code units each iterator may hold at once. See
+	/// ztd::text::transcode_iterator.
 	///
 	/// @remarks This type produces proxies as their reference type, and are only readable, not writable iterators. The
 	/// type will also try many different shortcuts for decoding the input and encoding the intermediates,
@@ -81,13 +83,14 @@ namespace ztd { namespace text {
 	template <typename _FromEncoding, typename _ToEncoding = utf8_t,
 		typename _Range            = __txt_detail::__default_char_view_t<code_unit_t<_FromEncoding>>,
 		typename _FromErrorHandler = default_handler_t, typename _ToErrorHandler = default_handler_t,
-		typename _FromState = decode_state_t<_FromEncoding>, typename _ToState = encode_state_t<_ToEncoding>>
+		typename _FromState = decode_state_t<_FromEncoding>, typename _ToState = encode_state_t<_ToEncoding>,
+		::std::size_t _CacheSize = 0>
 	class transcode_view {
 	public:
 		//////
 		/// @brief The iterator type for this view.
 		using iterator = transcode_iterator<_FromEncoding, _ToEncoding, _Range, _FromErrorHandler, _ToErrorHandler,
-			_FromState, _ToState>;
+			_FromState, _ToState, _CacheSize>;
 		//////
 		/// @brief The sentinel type for this view.
 		using sentinel = transcode_sentinel_t;
@@ -220,9 +223,10 @@ namespace ztd { namespace text {
 namespace std { namespace ranges {
 
 	template <typename _FromEncoding, typename _ToEncoding, typename _Range, typename _FromErrorHandler,
-		typename _ToErrorHandler, typename _FromState, typename _ToState>
+		typename _ToErrorHandler, typename _FromState, typename _ToState, ::std::size_t _CacheSize>
 	inline constexpr bool enable_borrowed_range<::ztd::text::transcode_view<_FromEncoding, _ToEncoding, _Range,
-		_FromErrorHandler, _ToErrorHandler, _FromState, _ToState>> = ::std::ranges::enable_borrowed_range<_Range>;
+		_FromErrorHandler, _ToErrorHandler, _FromState, _ToState,
+		_CacheSize>> = ::std::ranges::enable_borrowed_range<_Range>;
 
 }} // namespace std::ranges
 
@@ -233,9 +237,10 @@ namespace ztd { namespace ranges {
 	//////
 	/// @brief Mark subranges as appropriately borrowed ranges.
 	template <typename _FromEncoding, typename _ToEncoding, typename _Range, typename _FromErrorHandler,
-		typename _ToErrorHandler, typename _FromState, typename _ToState>
+		typename _ToErrorHandler, typename _FromState, typename _ToState, ::std::size_t _CacheSize>
 	inline constexpr bool enable_borrowed_range<::ztd::text::transcode_view<_FromEncoding, _ToEncoding, _Range,
-		_FromErrorHandler, _ToErrorHandler, _FromState, _ToState>> = ::ztd::ranges::enable_borrowed_range<_Range>;
+		_FromErrorHandler, _ToErrorHandler, _FromState, _ToState,
+		_CacheSize>> = ::ztd::ranges::enable_borrowed_range<_Range>;
 
 }} // namespace ztd::ranges
 
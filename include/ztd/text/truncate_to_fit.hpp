@@ -0,0 +1,292 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_TRUNCATE_TO_FIT_HPP
+#define ZTD_TEXT_TRUNCATE_TO_FIT_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/default_encoding.hpp>
+#include <ztd/text/count_result.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/pivot.hpp>
+#include <ztd/text/transcode_one.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/char_traits.hpp>
+
+#include <cstddef>
+#include <string_view>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		// Keeps a copy of a state from before a step, so the step can be taken back. States that cannot be copied
+		// are simply left as the step made them.
+		template <typename _State,
+			bool = ::std::is_copy_constructible_v<_State> && ::std::is_copy_assignable_v<_State>>
+		class __step_state_backup {
+		private:
+			_State _M_state;
+
+		public:
+			constexpr __step_state_backup(const _State& __state) : _M_state(__state) {
+			}
+
+			constexpr void _M_restore(_State& __state) const {
+				__state = this->_M_state;
+			}
+		};
+
+		template <typename _State>
+		class __step_state_backup<_State, false> {
+		public:
+			constexpr __step_state_backup(const _State&) noexcept {
+			}
+
+			constexpr void _M_restore(_State&) const noexcept {
+			}
+		};
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_truncate_to_fit ztd::text::truncate_to_fit
+	/// @brief These functions find the longest prefix of an input whose transcoded output fits into a given number of
+	/// code units, without ever splitting a code point.
+	/// @{
+
+	//////
+	/// @brief Finds the longest prefix of the `__input` whose output, when transcoded from the `__from_encoding` to
+	/// the `__to_encoding`, takes at most `__max_code_units` code units.
+	///
+	/// @param[in] __input The input range of code units to measure.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to count the output code units with.
+	/// @param[in] __max_code_units The maximum number of output code units the prefix may take.
+	/// @param[in] __from_error_handler The error handler to invoke when the decode portion fails.
+	/// @param[in] __to_error_handler The error handler to invoke when the encode portion fails.
+	/// @param[in, out] __from_state The state to use for the decoding portion.
+	/// @param[in, out] __to_state The state to use for the encoding portion.
+	///
+	/// @returns A ztd::text::count_transcode_result whose `input` is the rest of the input that did not fit (its
+	/// beginning is the split point) and whose `count` is the number of output code units the prefix takes. If an
+	/// error occurs, `input` starts at the sequence that failed and `count` covers everything before it.
+	///
+	/// @remarks A transcode step is never split: if its output would go past `__max_code_units`, the function stops in
+	/// front of it and, where the states can be copied, puts them back to how they were before that step. Between
+	/// the standard UTF encodings over contiguous input, well-formed code units are counted straight off the storage
+	/// (runs of ASCII in UTF-8 are checked a 64-bit word at a time); everything else goes through
+	/// ztd::text::transcode_one_into, one step at a time, into an unseen buffer.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+		typename _ToErrorHandler, typename _FromState, typename _ToState>
+	constexpr auto truncate_to_fit(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		::std::size_t __max_code_units, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state) {
+		using _UInput         = remove_cvref_t<_Input>;
+		using _InputValueType = ranges::range_value_type_t<_UInput>;
+		using _WorkingInput   = ranges::range_reconstruct_t<::std::conditional_t<::std::is_array_v<_UInput>,
+               ::std::conditional_t<is_char_traitable_v<_InputValueType>, ::std::basic_string_view<_InputValueType>,
+                    ::ztd::span<const _InputValueType>>,
+               _UInput>>;
+		using _UFromEncoding  = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding    = remove_cvref_t<_ToEncoding>;
+		using _CodePoint      = code_point_t<_UFromEncoding>;
+		using _CodeUnit       = code_unit_t<_UToEncoding>;
+		using _Result         = count_transcode_result<_WorkingInput, _FromState, _ToState>;
+
+		_WorkingInput __working_input(
+			ranges::reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+
+		_CodePoint __intermediate[max_code_points_v<_UFromEncoding>] {};
+		pivot<::ztd::span<_CodePoint>> __pivot { __intermediate, encoding_error::ok };
+		_CodeUnit __output_storage[max_code_units_v<_UToEncoding>] {};
+		::ztd::span<_CodeUnit, max_code_units_v<_UToEncoding>> __output(__output_storage);
+
+		::std::size_t __count          = 0;
+		::std::size_t __handled_errors = 0;
+		for (;;) {
+			if constexpr (__txt_detail::__is_utf_bulk_countable_v<_UFromEncoding, _UToEncoding, _WorkingInput>) {
+				constexpr ::std::size_t __from_width = __txt_detail::__utf_bulk_width_v<_UFromEncoding>;
+				constexpr ::std::size_t __to_width   = __txt_detail::__utf_bulk_width_v<_UToEncoding>;
+				::std::size_t __read_count           = 0;
+				__count += __txt_detail::__utf_bulk_count_until<__from_width, __to_width>(
+					ranges::ranges_adl::adl_data(__working_input), ranges::ranges_adl::adl_size(__working_input),
+					__max_code_units - __count, __read_count);
+				__working_input = ranges::reconstruct(::std::in_place_type<_WorkingInput>,
+					ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+					ranges::ranges_adl::adl_end(__working_input));
+			}
+			if (__count == __max_code_units) {
+				break;
+			}
+			if (ranges::ranges_adl::adl_empty(__working_input) // cf
+				&& text::is_state_complete(__from_state)      // cf
+				&& text::is_state_complete(__to_state)) {
+				break;
+			}
+			const __txt_detail::__step_state_backup<_FromState> __from_state_backup(__from_state);
+			const __txt_detail::__step_state_backup<_ToState> __to_state_backup(__to_state);
+			auto __transcode_result = transcode_one_into(__working_input, __from_encoding, __output, __to_encoding,
+				__from_error_handler, __to_error_handler, __from_state, __to_state, __pivot);
+			if (__transcode_result.error_code != encoding_error::ok) {
+				return _Result(::std::move(__working_input), __count, __from_state, __to_state,
+					__transcode_result.error_code, __handled_errors + __transcode_result.handled_errors);
+			}
+			const ::std::size_t __step_count
+				= static_cast<::std::size_t>(__transcode_result.output.data() - __output.data());
+			if (__max_code_units - __count < __step_count) {
+				// the output of this step does not fit: stop in front of it
+				__from_state_backup._M_restore(__from_state);
+				__to_state_backup._M_restore(__to_state);
+				break;
+			}
+			__count += __step_count;
+			__handled_errors += __transcode_result.handled_errors;
+			__working_input = ranges::reconstruct(
+				::std::in_place_type<_WorkingInput>, ::std::move(__transcode_result.input));
+		}
+		return _Result(
+			::std::move(__working_input), __count, __from_state, __to_state, encoding_error::ok, __handled_errors);
+	}
+
+	//////
+	/// @brief Finds the longest prefix of the `__input` whose output, when transcoded from the `__from_encoding` to
+	/// the `__to_encoding`, takes at most `__max_code_units` code units.
+	///
+	/// @param[in] __input The input range of code units to measure.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to count the output code units with.
+	/// @param[in] __max_code_units The maximum number of output code units the prefix may take.
+	/// @param[in] __from_error_handler The error handler to invoke when the decode portion fails.
+	/// @param[in] __to_error_handler The error handler to invoke when the encode portion fails.
+	/// @param[in, out] __from_state The state to use for the decoding portion.
+	///
+	/// @returns A ztd::text::stateless_count_result whose `input` is the rest of the input that did not fit and whose
+	/// `count` is the number of output code units the prefix takes.
+	///
+	/// @remarks This functions will call ztd::text::make_encode_state with `__to_encoding` to create a default @p
+	/// encode_state.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+		typename _ToErrorHandler, typename _FromState>
+	constexpr auto truncate_to_fit(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		::std::size_t __max_code_units, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler, _FromState& __from_state) {
+		auto __to_state = ztd::text::make_encode_state(__to_encoding);
+		auto __result   = truncate_to_fit(::std::forward<_Input>(__input),
+			  ::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			  __max_code_units, ::std::forward<_FromErrorHandler>(__from_error_handler),
+			  ::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+		return __txt_detail::__slice_to_stateless(::std::move(__result));
+	}
+
+	//////
+	/// @brief Finds the longest prefix of the `__input` whose output, when transcoded from the `__from_encoding` to
+	/// the `__to_encoding`, takes at most `__max_code_units` code units.
+	///
+	/// @param[in] __input The input range of code units to measure.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to count the output code units with.
+	/// @param[in] __max_code_units The maximum number of output code units the prefix may take.
+	/// @param[in] __from_error_handler The error handler to invoke when the decode portion fails.
+	/// @param[in] __to_error_handler The error handler to invoke when the encode portion fails.
+	///
+	/// @remarks This functions will call ztd::text::make_decode_state with the `__from_encoding` object to create a
+	/// default `decode_state` to use before passing it to the next overload.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+		typename _ToErrorHandler>
+	constexpr auto truncate_to_fit(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		::std::size_t __max_code_units, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler) {
+		auto __from_state = ztd::text::make_decode_state(__from_encoding);
+		return truncate_to_fit(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), __max_code_units,
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state);
+	}
+
+	//////
+	/// @brief Finds the longest prefix of the `__input` whose output, when transcoded from the `__from_encoding` to
+	/// the `__to_encoding`, takes at most `__max_code_units` code units.
+	///
+	/// @param[in] __input The input range of code units to measure.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to count the output code units with.
+	/// @param[in] __max_code_units The maximum number of output code units the prefix may take.
+	/// @param[in] __error_handler The error handler to invoke when either the decode or encode portion fails.
+	///
+	/// @remarks This function makes a copy of the `__error_handler` (if possible) and uses it for both portions of
+	/// the operation.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _ErrorHandler>
+	constexpr auto truncate_to_fit(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		::std::size_t __max_code_units, _ErrorHandler&& __error_handler) {
+		auto __handler = __txt_detail::__duplicate_or_be_careless(__error_handler);
+		return truncate_to_fit(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), __max_code_units,
+			::std::forward<_ErrorHandler>(__error_handler), __handler);
+	}
+
+	//////
+	/// @brief Finds the longest prefix of the `__input` whose output, when transcoded from the `__from_encoding` to
+	/// the `__to_encoding`, takes at most `__max_code_units` code units.
+	///
+	/// @param[in] __input The input range of code units to measure.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to count the output code units with.
+	/// @param[in] __max_code_units The maximum number of output code units the prefix may take.
+	///
+	/// @remarks Calls the next overload with an `error_handler` that is similar to ztd::text::default_handler_t.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding>
+	constexpr auto truncate_to_fit(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		::std::size_t __max_code_units) {
+		default_handler_t __handler {};
+		return truncate_to_fit(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), __max_code_units, __handler);
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_TRUNCATE_TO_FIT_HPP
@@ -42,6 +42,7 @@
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/forward.hpp>
 #include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/is_transcoding_compatible.hpp>
 
 #include <ztd/text/detail/empty_state.hpp>
 
@@ -387,6 +388,16 @@ namespace ztd { namespace text {
 	//////
 	/// @}
 
+	namespace __txt_detail {
+
+		template <typename _LeftUnit, typename _LeftPoint, typename _RightUnit, typename _RightPoint>
+		struct __is_bitwise_transcoding_compatible<basic_utf16<_LeftUnit, _LeftPoint>,
+			basic_utf16<_RightUnit, _RightPoint>>
+		: ::std::integral_constant<bool,
+			  (sizeof(_LeftUnit) == sizeof(_RightUnit)) && (alignof(_LeftUnit) == alignof(_RightUnit))> { };
+
+	} // namespace __txt_detail
+
 
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
 }} // namespace ztd::text
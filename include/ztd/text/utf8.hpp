@@ -584,6 +584,12 @@ namespace ztd { namespace text {
 
 	namespace __txt_detail {
 
+		template <typename _LeftUnit, typename _LeftPoint, typename _RightUnit, typename _RightPoint>
+		struct __is_bitwise_transcoding_compatible<basic_utf8<_LeftUnit, _LeftPoint>,
+			basic_utf8<_RightUnit, _RightPoint>>
+		: ::std::integral_constant<bool,
+			  (sizeof(_LeftUnit) == sizeof(_RightUnit)) && (alignof(_LeftUnit) == alignof(_RightUnit))> { };
+
 		template <typename _UTF8Unit, typename _UTF8Point, typename _WTF8Unit, typename _WTF8Point>
 		struct __is_bitwise_transcoding_compatible<basic_utf8<_UTF8Unit, _UTF8Point>,
 			basic_wtf8<_WTF8Unit, _WTF8Point>>
@@ -0,0 +1,349 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_UTF_OFFSET_MAP_HPP
+#define ZTD_TEXT_UTF_OFFSET_MAP_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+
+#include <ztd/idk/unwrap.hpp>
+#include <ztd/ranges/adl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_ranges Ranges, Views, and Iterators
+	///
+	/// @{
+
+	//////
+	/// @brief A position in some Unicode text, counted three different ways.
+	struct utf_position {
+		//////
+		/// @brief The number of code units of the text's own encoding in front of this position.
+		::std::size_t code_units;
+		//////
+		/// @brief The number of UTF-16 code units the text in front of this position takes up.
+		::std::size_t utf16_code_units;
+		//////
+		/// @brief The number of code points in front of this position.
+		::std::size_t code_points;
+	};
+
+	//////
+	/// @brief Compares two ztd::text::utf_position objects for equality.
+	constexpr bool operator==(const utf_position& __left, const utf_position& __right) noexcept {
+		return __left.code_units == __right.code_units && __left.utf16_code_units == __right.utf16_code_units
+			&& __left.code_points == __right.code_points;
+	}
+
+	//////
+	/// @brief Compares two ztd::text::utf_position objects for inequality.
+	constexpr bool operator!=(const utf_position& __left, const utf_position& __right) noexcept {
+		return !(__left == __right);
+	}
+
+	//////
+	/// @brief A table converting between the code unit offsets, UTF-16 code unit offsets, and code point offsets of
+	/// some UTF-8, UTF-16 or UTF-32 text, such as a document in a language server.
+	///
+	/// @tparam _Encoding The encoding of the text. It must be one of ztd::text::basic_utf8, ztd::text::basic_utf16 or
+	/// ztd::text::basic_utf32.
+	/// @tparam _Allocator The allocator used for the table.
+	///
+	/// @remarks The table records a ztd::text::utf_position at the first code point boundary after every
+	/// `block_size()` code units, so a conversion is a binary search followed by a walk over at most one block. It
+	/// does not keep the text: every call is handed the current text, which must be a contiguous range. Each code
+	/// unit that is not part of a well-formed sequence counts as one code point, and as one UTF-16 code unit (the
+	/// size of a U+FFFD replacement character). After the text is edited, update() rebuilds only the part of the
+	/// table around the edit and shifts the rest.
+	template <typename _Encoding, typename _Allocator = ::std::allocator<utf_position>>
+	class basic_utf_offset_map {
+	private:
+		using _UEncoding                             = unwrap_remove_cvref_t<_Encoding>;
+		using _CodeUnit                              = code_unit_t<_UEncoding>;
+		inline static constexpr ::std::size_t _Width = __txt_detail::__utf_bulk_width_v<_UEncoding>;
+		// the longest well-formed sequence, which is also how far ahead of a boundary one step may look
+		inline static constexpr ::std::size_t _MaxSequence = _Width == 1 ? 4 : (_Width == 2 ? 2 : 1);
+
+		static_assert(_Width != 0, "the encoding must be one of basic_utf8, basic_utf16, or basic_utf32");
+
+	public:
+		//////
+		/// @brief The encoding type of the text.
+		using encoding_type = _Encoding;
+		//////
+		/// @brief The allocator type used for the table.
+		using allocator_type = _Allocator;
+
+		//////
+		/// @brief The number of code units between two table entries when none is given.
+		inline static constexpr ::std::size_t default_block_size = 1024;
+
+		//////
+		/// @brief Constructs the table for an empty text.
+		basic_utf_offset_map() : basic_utf_offset_map(default_block_size) {
+		}
+
+		//////
+		/// @brief Constructs the table for an empty text.
+		///
+		/// @param[in] __block_size The number of code units between two table entries. A value of `0` is treated as
+		/// `1`.
+		/// @param[in] __allocator The allocator used for the table.
+		explicit basic_utf_offset_map(
+			::std::size_t __block_size, const allocator_type& __allocator = allocator_type())
+		: _M_positions(__allocator), _M_block_size(__block_size == 0 ? 1 : __block_size) {
+			this->_M_positions.push_back(utf_position { 0, 0, 0 });
+		}
+
+		//////
+		/// @brief Constructs the table for the given text.
+		///
+		/// @param[in] __text The text.
+		/// @param[in] __block_size The number of code units between two table entries.
+		/// @param[in] __allocator The allocator used for the table.
+		template <typename _Range,
+			::std::enable_if_t<!::std::is_same_v<remove_cvref_t<_Range>, basic_utf_offset_map> // cf
+			     && !::std::is_integral_v<remove_cvref_t<_Range>>>* = nullptr>
+		explicit basic_utf_offset_map(_Range&& __text, ::std::size_t __block_size = default_block_size,
+			const allocator_type& __allocator = allocator_type())
+		: basic_utf_offset_map(__block_size, __allocator) {
+			this->assign(::std::forward<_Range>(__text));
+		}
+
+		//////
+		/// @brief The number of code units between two table entries.
+		::std::size_t block_size() const noexcept {
+			return this->_M_block_size;
+		}
+
+		//////
+		/// @brief The table entries, in order. The first one is always the start of the text.
+		const ::std::vector<utf_position, allocator_type>& positions() const noexcept {
+			return this->_M_positions;
+		}
+
+		//////
+		/// @brief Rebuilds the whole table for the given text.
+		///
+		/// @param[in] __text The text.
+		template <typename _Range>
+		void assign(_Range&& __text) {
+			const _CodeUnit* __data    = ranges::ranges_adl::adl_data(__text);
+			const ::std::size_t __size = ranges::ranges_adl::adl_size(__text);
+			this->_M_positions.resize(1);
+			this->_M_build_from(__data, __size, __size);
+		}
+
+		//////
+		/// @brief Updates the table after an edit.
+		///
+		/// @param[in] __text The text, after the edit.
+		/// @param[in] __offset The code unit offset where the edit starts.
+		/// @param[in] __removed_code_units The number of code units the edit removed at `__offset`.
+		/// @param[in] __inserted_code_units The number of code units the edit inserted at `__offset`.
+		///
+		/// @remarks The entries far enough in front of the edit are kept. The text after the edit is walked only until it
+		/// lines up with an old entry again: from there on the text is the same as before, so the remaining entries are
+		/// shifted instead of recomputed.
+		template <typename _Range>
+		void update(_Range&& __text, ::std::size_t __offset, ::std::size_t __removed_code_units,
+			::std::size_t __inserted_code_units) {
+			const _CodeUnit* __data        = ranges::ranges_adl::adl_data(__text);
+			const ::std::size_t __size     = ranges::ranges_adl::adl_size(__text);
+			const ::std::size_t __old_last = __offset + __removed_code_units;
+			const ::std::size_t __new_last = __offset + __inserted_code_units;
+			// an entry is only kept if no step before it looked into the edit: a sequence cut off by the old text
+			// can be completed by the new one
+			auto __kept_last = ::std::upper_bound(this->_M_positions.begin() + 1, this->_M_positions.end(),
+				__offset, [](::std::size_t __target, const utf_position& __position) {
+					return __target < __position.code_units + _MaxSequence;
+				});
+			auto __tail_first = ::std::lower_bound(__kept_last, this->_M_positions.end(), __old_last,
+				[](const utf_position& __position, ::std::size_t __target) {
+					return __position.code_units < __target;
+				});
+			::std::vector<utf_position, allocator_type> __tail(
+				__tail_first, this->_M_positions.end(), this->_M_positions.get_allocator());
+			this->_M_positions.erase(__kept_last, this->_M_positions.end());
+			const ::std::size_t __tail_index = this->_M_build_from(
+				__data, __size, __new_last, __tail, __removed_code_units, __inserted_code_units);
+			if (__tail_index == __tail.size()) {
+				return;
+			}
+			// the walk landed on an old entry past the edit: the rest of the text is unchanged
+			const utf_position __old_anchor = __tail[__tail_index];
+			const utf_position __new_anchor = this->_M_positions.back();
+			for (::std::size_t __index = __tail_index + 1; __index < __tail.size(); ++__index) {
+				const utf_position& __old = __tail[__index];
+				this->_M_positions.push_back(
+					utf_position { __old.code_units - __old_anchor.code_units + __new_anchor.code_units,
+					     __old.utf16_code_units - __old_anchor.utf16_code_units + __new_anchor.utf16_code_units,
+					     __old.code_points - __old_anchor.code_points + __new_anchor.code_points });
+			}
+		}
+
+		//////
+		/// @brief Converts a code unit offset of the text's own encoding.
+		///
+		/// @param[in] __text The text.
+		/// @param[in] __code_units The code unit offset.
+		///
+		/// @returns The position of the code point the offset is in, or of the end of the text if the offset is
+		/// past it.
+		template <typename _Range>
+		utf_position from_code_units(_Range&& __text, ::std::size_t __code_units) const {
+			return this->_M_find(ranges::ranges_adl::adl_data(__text), ranges::ranges_adl::adl_size(__text),
+				&utf_position::code_units, __code_units);
+		}
+
+		//////
+		/// @brief Converts a UTF-16 code unit offset.
+		///
+		/// @param[in] __text The text.
+		/// @param[in] __utf16_code_units The UTF-16 code unit offset.
+		///
+		/// @returns The position of the code point the offset is in, or of the end of the text if the offset is
+		/// past it. An offset between the two halves of a surrogate pair gives the position of the pair.
+		template <typename _Range>
+		utf_position from_utf16_code_units(_Range&& __text, ::std::size_t __utf16_code_units) const {
+			return this->_M_find(ranges::ranges_adl::adl_data(__text), ranges::ranges_adl::adl_size(__text),
+				&utf_position::utf16_code_units, __utf16_code_units);
+		}
+
+		//////
+		/// @brief Converts a code point offset.
+		///
+		/// @param[in] __text The text.
+		/// @param[in] __code_points The code point offset.
+		///
+		/// @returns The position of that code point, or of the end of the text if the offset is past it.
+		template <typename _Range>
+		utf_position from_code_points(_Range&& __text, ::std::size_t __code_points) const {
+			return this->_M_find(ranges::ranges_adl::adl_data(__text), ranges::ranges_adl::adl_size(__text),
+				&utf_position::code_points, __code_points);
+		}
+
+	private:
+		static void _S_step(const _CodeUnit* __data, ::std::size_t __size, utf_position& __position) noexcept {
+			char32_t __code_point    = 0;
+			::std::size_t __in_count = __txt_detail::__utf_bulk_read<_Width>(
+				__data + __position.code_units, __size - __position.code_units, __code_point);
+			if (__in_count == 0) {
+				// an ill-formed code unit counts as one replacement character
+				__in_count   = 1;
+				__code_point = 0xFFFD;
+			}
+			__position.code_units += __in_count;
+			__position.utf16_code_units += __txt_detail::__utf_bulk_size<2>(__code_point);
+			__position.code_points += 1;
+		}
+
+		// walks from the last entry to the end of the text, adding entries along the way; if an entry of __tail
+		// (shifted by the edit) is landed on at or after __new_last, stops there and returns its index
+		template <typename _Tail = ::std::vector<utf_position, allocator_type>>
+		::std::size_t _M_build_from(const _CodeUnit* __data, ::std::size_t __size, ::std::size_t __new_last,
+			const _Tail& __tail = _Tail(), ::std::size_t __removed_code_units = 0,
+			::std::size_t __inserted_code_units = 0) {
+			utf_position __position          = this->_M_positions.back();
+			::std::size_t __last_entry_units = __position.code_units;
+			::std::size_t __tail_index       = 0;
+			while (__position.code_units < __size) {
+				_S_step(__data, __size, __position);
+				if (__position.code_units >= __new_last) {
+					// old entries the walk stepped over are no longer on a code point boundary
+					while (__tail_index < __tail.size()
+						&& __tail[__tail_index].code_units - __removed_code_units + __inserted_code_units
+						     < __position.code_units) {
+						++__tail_index;
+					}
+					if (__tail_index < __tail.size()
+						&& __tail[__tail_index].code_units - __removed_code_units + __inserted_code_units
+						     == __position.code_units) {
+						this->_M_positions.push_back(__position);
+						return __tail_index;
+					}
+				}
+				if (__position.code_units - __last_entry_units >= this->_M_block_size) {
+					this->_M_positions.push_back(__position);
+					__last_entry_units = __position.code_units;
+				}
+			}
+			return __tail.size();
+		}
+
+		utf_position _M_find(const _CodeUnit* __data, ::std::size_t __size, ::std::size_t utf_position::*__member,
+			::std::size_t __target) const {
+			auto __entry_it = ::std::upper_bound(this->_M_positions.cbegin(), this->_M_positions.cend(), __target,
+				[__member](::std::size_t __value, const utf_position& __position) {
+					return __value < __position.*__member;
+				});
+			--__entry_it;
+			utf_position __position = *__entry_it;
+			while (__position.code_units < __size) {
+				utf_position __next = __position;
+				_S_step(__data, __size, __next);
+				if (__next.*__member > __target) {
+					break;
+				}
+				__position = __next;
+			}
+			return __position;
+		}
+
+		::std::vector<utf_position, allocator_type> _M_positions;
+		::std::size_t _M_block_size;
+	};
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_UTF_OFFSET_MAP_HPP
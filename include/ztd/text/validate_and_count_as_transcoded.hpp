@@ -0,0 +1,307 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_VALIDATE_AND_COUNT_AS_TRANSCODED_HPP
+#define ZTD_TEXT_VALIDATE_AND_COUNT_AS_TRANSCODED_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/default_encoding.hpp>
+#include <ztd/text/validate_result.hpp>
+#include <ztd/text/pass_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/pivot.hpp>
+#include <ztd/text/transcode_one.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/utf_bulk.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/tag.hpp>
+
+#include <string_view>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_validate_and_count_as_transcoded ztd::text::validate_and_count_as_transcoded
+	/// @brief These functions check if the given input of code units can be transcoded without an error and, at the
+	/// same time, count how many code units the transcoded output would have. This is the same as calling
+	/// ztd::text::validate_transcodable_as and then ztd::text::count_as_transcoded, but only goes over the input once.
+	/// @{
+
+	//////
+	/// @brief Validates the code units of the `__input` according to the `__from_encoding` and the `__to_encoding`
+	/// and counts the code units the transcoded output would have, in one go.
+	///
+	/// @param[in] __input The input range of code units to validate and count.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to encode the intermediate code points with.
+	/// @param[in, out] __from_state The state to use for the decoding portion of the check.
+	/// @param[in, out] __to_state The state to use for the encoding portion of the check.
+	/// @param[in, out] __pivot A reference to a descriptor of a (potentially usable) pivot range, usually a range of
+	/// contiguous data from a span provided by the implementation but customizable by the end-user. If decoding the
+	/// input is what failed, then the ztd::text::pivot's `error_code` member will be set to that error. If encoding
+	/// the intermediate code points is what failed, it is left untouched.
+	///
+	/// @returns A ztd::text::validate_count_transcode_result. Its `valid` member is false if either the decode or the
+	/// encode step failed; the `__pivot` says which one. In that case, its `input` starts at the code unit sequence
+	/// whose code point(s) could not be decoded or encoded, and its `count` is the number of output code units for
+	/// every complete code point before it.
+	///
+	/// @remarks This function explicitly does not call any extension points. Between the standard UTF encodings over
+	/// contiguous input, it checks and counts directly on the code units; otherwise, it loops over
+	/// ztd::text::transcode_one_into with an unseen output buffer and stops at the first error.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromState, typename _ToState,
+		typename _PivotRange>
+	constexpr auto basic_validate_and_count_as_transcoded(_Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromState& __from_state, _ToState& __to_state, pivot<_PivotRange>& __pivot) {
+		using _UInput         = remove_cvref_t<_Input>;
+		using _InputValueType = ranges::range_value_type_t<_UInput>;
+		using _WorkingInput   = ranges::range_reconstruct_t<::std::conditional_t<::std::is_array_v<_UInput>,
+               ::std::conditional_t<is_character_v<_InputValueType>, ::std::basic_string_view<_InputValueType>,
+                    ::ztd::span<const _InputValueType>>,
+               _UInput>>;
+		using _UFromEncoding  = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding    = remove_cvref_t<_ToEncoding>;
+		using _Result         = validate_count_transcode_result<_WorkingInput, _FromState, _ToState>;
+
+		_WorkingInput __working_input(
+			ranges::reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+
+		if constexpr (__txt_detail::__is_utf_bulk_countable_v<_UFromEncoding, _UToEncoding, _WorkingInput>) {
+			// nothing stateful or multi-step about the standard UTF encodings: validate and count straight off of
+			// the code units
+			(void)__to_encoding;
+			constexpr ::std::size_t __from_width = __txt_detail::__utf_bulk_width_v<_UFromEncoding>;
+			constexpr ::std::size_t __to_width   = __txt_detail::__utf_bulk_width_v<_UToEncoding>;
+			::std::size_t __read_count           = 0;
+			const ::std::size_t __count          = __txt_detail::__utf_bulk_count<__from_width, __to_width>(
+				ranges::ranges_adl::adl_data(__working_input), ranges::ranges_adl::adl_size(__working_input),
+				__read_count);
+			__working_input = ranges::reconstruct(::std::in_place_type<_WorkingInput>,
+				ranges::ranges_adl::adl_begin(__working_input) + __read_count,
+				ranges::ranges_adl::adl_end(__working_input));
+			const bool __is_valid = ranges::ranges_adl::adl_empty(__working_input);
+			if (!__is_valid) {
+				// only the decode step can fail between these encodings: get the exact error from the encoding
+				// itself, so the pivot reports the same thing the slow path would
+				pass_handler_t __handler {};
+				auto __decode_result = __from_encoding.decode_one(
+					__working_input, __pivot.intermediate, __handler, __from_state);
+				__pivot.error_code = __decode_result.error_code;
+			}
+			return _Result(::std::move(__working_input), __is_valid, __count, __from_state, __to_state);
+		}
+		else {
+			using _CodeUnit = code_unit_t<_UToEncoding>;
+
+			_CodeUnit __output_storage[max_code_units_v<_UToEncoding>] {};
+			::ztd::span<_CodeUnit, max_code_units_v<_UToEncoding>> __output(__output_storage);
+
+			pass_handler_t __handler {};
+			::std::size_t __count = 0;
+
+			for (;;) {
+				auto __transcode_result = transcode_one_into(__working_input, __from_encoding, __output,
+					__to_encoding, __handler, __handler, __from_state, __to_state, __pivot);
+				if (__transcode_result.error_code != encoding_error::ok) {
+					return _Result(::std::move(__working_input), false, __count, __from_state, __to_state);
+				}
+				__count += static_cast<::std::size_t>(__transcode_result.output.data() - __output.data());
+				__working_input = ranges::reconstruct(
+					::std::in_place_type<_WorkingInput>, ::std::move(__transcode_result.input));
+				if (ranges::ranges_adl::adl_empty(__working_input)) {
+					if (!text::is_state_complete(__from_state)) {
+						continue;
+					}
+					if (!text::is_state_complete(__to_state)) {
+						continue;
+					}
+					break;
+				}
+			}
+			return _Result(::std::move(__working_input), true, __count, __from_state, __to_state);
+		}
+	}
+
+	//////
+	/// @brief Validates the code units of the `__input` according to the `__from_encoding` and the `__to_encoding`
+	/// and counts the code units the transcoded output would have, in one go.
+	///
+	/// @param[in] __input The input range of code units to validate and count.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to encode the intermediate code points with.
+	/// @param[in, out] __from_state The state to use for the decoding portion of the check.
+	/// @param[in, out] __to_state The state to use for the encoding portion of the check.
+	/// @param[in, out] __pivot A reference to a descriptor of a (potentially usable) pivot range, usually a range of
+	/// contiguous data from a span provided by the implementation but customizable by the end-user. If decoding the
+	/// input is what failed, then the ztd::text::pivot's `error_code` member will be set to that error. If encoding
+	/// the intermediate code points is what failed, it is left untouched.
+	///
+	/// @remarks This functions checks to see if the extension point `text_validate_and_count_as_transcoded` is
+	/// available taking the available 6 parameters. If so, it calls this. Otherwise, it defers to
+	/// ztd::text::basic_validate_and_count_as_transcoded.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromState, typename _ToState,
+		typename _PivotRange>
+	constexpr auto validate_and_count_as_transcoded(_Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromState& __from_state, _ToState& __to_state, pivot<_PivotRange>& __pivot) {
+		using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = remove_cvref_t<_ToEncoding>;
+		if constexpr (is_detected_v<__txt_detail::__detect_adl_text_validate_and_count_as_transcoded, _Input,
+			              _FromEncoding, _ToEncoding, _FromState, _ToState, _PivotRange>) {
+			return text_validate_and_count_as_transcoded(::ztd::tag<_UFromEncoding, _UToEncoding> {},
+				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+				::std::forward<_ToEncoding>(__to_encoding), __from_state, __to_state, __pivot);
+		}
+		else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_validate_and_count_as_transcoded,
+			                   _Input, _FromEncoding, _ToEncoding, _FromState, _ToState, _PivotRange>) {
+			return __text_validate_and_count_as_transcoded(::ztd::tag<_UFromEncoding, _UToEncoding> {},
+				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+				::std::forward<_ToEncoding>(__to_encoding), __from_state, __to_state, __pivot);
+		}
+		else {
+			return basic_validate_and_count_as_transcoded(::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+				__from_state, __to_state, __pivot);
+		}
+	}
+
+	//////
+	/// @brief Validates the code units of the `__input` according to the `__from_encoding` and the `__to_encoding`
+	/// and counts the code units the transcoded output would have, in one go.
+	///
+	/// @param[in] __input The input range of code units to validate and count.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to encode the intermediate code points with.
+	/// @param[in, out] __from_state The state to use for the decoding portion of the check.
+	/// @param[in, out] __to_state The state to use for the encoding portion of the check.
+	///
+	/// @remarks This function creates a default pivot range from the `__from_encoding`'s code points before calling
+	/// the next overload.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromState, typename _ToState>
+	constexpr auto validate_and_count_as_transcoded(_Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromState& __from_state, _ToState& __to_state) {
+		using _UFromEncoding = ::ztd::remove_cvref_t<_FromEncoding>;
+		using _CodePoint     = code_point_t<_UFromEncoding>;
+		_CodePoint __intermediate[max_code_points_v<_UFromEncoding>] {};
+		pivot<ztd::span<_CodePoint>> __pivot { __intermediate, encoding_error::ok };
+		return validate_and_count_as_transcoded(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			__from_state, __to_state, __pivot);
+	}
+
+	//////
+	/// @brief Validates the code units of the `__input` according to the `__from_encoding` and the `__to_encoding`
+	/// and counts the code units the transcoded output would have, in one go.
+	///
+	/// @param[in] __input The input range of code units to validate and count.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to encode the intermediate code points with.
+	/// @param[in, out] __from_state The state to use for the decoding portion of the check.
+	///
+	/// @remarks This functions will call ztd::text::make_encode_state with `__to_encoding` to create a default @p
+	/// encode_state.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromState>
+	constexpr auto validate_and_count_as_transcoded(
+		_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding, _FromState& __from_state) {
+		auto __to_state = ztd::text::make_encode_state(__to_encoding);
+		auto __result   = validate_and_count_as_transcoded(::std::forward<_Input>(__input),
+			  ::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			  __from_state, __to_state);
+		return __txt_detail::__slice_to_stateless(::std::move(__result));
+	}
+
+	//////
+	/// @brief Validates the code units of the `__input` according to the `__from_encoding` and the `__to_encoding`
+	/// and counts the code units the transcoded output would have, in one go.
+	///
+	/// @param[in] __input The input range of code units to validate and count.
+	/// @param[in] __from_encoding The encoding to decode the input of code units with.
+	/// @param[in] __to_encoding The encoding to encode the intermediate code points with.
+	///
+	/// @remarks This functions will call ztd::text::make_decode_state with the `__from_encoding` object to create a
+	/// default `decode_state` to use before passing it to the next overload.
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding>
+	constexpr auto validate_and_count_as_transcoded(
+		_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding) {
+		auto __from_state = ztd::text::make_decode_state(__from_encoding);
+		return validate_and_count_as_transcoded(::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			__from_state);
+	}
+
+	//////
+	/// @brief Validates the code units of the `__input` and counts the code units the output would have when
+	/// transcoded to the `__to_encoding`, in one go.
+	///
+	/// @param[in] __input The input range of code units to validate and count.
+	/// @param[in] __to_encoding The encoding to encode the intermediate code points with.
+	///
+	/// @remarks Calls ztd::text::validate_and_count_as_transcoded(Input, FromEncoding, ToEncoding) with a
+	/// `from_encoding` that is derived from ztd::text::default_code_unit_encoding.
+	template <typename _Input, typename _ToEncoding>
+	constexpr auto validate_and_count_as_transcoded(_Input&& __input, _ToEncoding&& __to_encoding) {
+		using _UInput   = remove_cvref_t<_Input>;
+		using _CodeUnit = remove_cvref_t<ranges::range_value_type_t<_UInput>>;
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+		if (::std::is_constant_evaluated()) {
+			// Use literal encoding instead, if we meet the right criteria
+			using _FromEncoding = default_consteval_code_unit_encoding_t<_CodeUnit>;
+			_FromEncoding __from_encoding {};
+			return validate_and_count_as_transcoded(
+				::std::forward<_Input>(__input), __from_encoding, ::std::forward<_ToEncoding>(__to_encoding));
+		}
+		else
+#endif
+		{
+			using _FromEncoding = default_code_unit_encoding_t<_CodeUnit>;
+			_FromEncoding __from_encoding {};
+			return validate_and_count_as_transcoded(
+				::std::forward<_Input>(__input), __from_encoding, ::std::forward<_ToEncoding>(__to_encoding));
+		}
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif // ZTD_TEXT_VALIDATE_AND_COUNT_AS_TRANSCODED_HPP
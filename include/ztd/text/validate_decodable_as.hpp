@@ -42,6 +42,7 @@
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/state.hpp>
 #include <ztd/text/pivot.hpp>
+#include <ztd/text/segmented_range.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/validate_count_routines.hpp>
@@ -244,6 +245,25 @@ namespace ztd { namespace text {
 			return __text_validate_decodable_as(::ztd::tag<remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __decode_state);
 		}
+		else if constexpr (is_segmented_range_v<_Input>) {
+			using _UInput    = remove_cvref_t<_Input>;
+			using _UEncoding = remove_cvref_t<_Encoding>;
+			using _Result    = validate_transcode_result<ranges::range_reconstruct_t<_UInput>, _DecodeState,
+				_EncodeState>;
+			bool __valid     = true;
+			auto __process   = [&](auto __units, bool __deferrable) {
+				auto __result = validate_decodable_as(__units, __encoding, __decode_state, __encode_state);
+				const ::std::size_t __size   = ranges::ranges_adl::adl_size(__units);
+				const ::std::size_t __unread = ranges::ranges_adl::adl_size(__result.input);
+				// a failure this close to the end of a segment may just be a sequence cut in half by the seam
+				__valid = __result.valid || (__deferrable && __unread < max_code_units_v<_UEncoding>);
+				return __txt_detail::__segment_step { __size - __unread, !__valid };
+			};
+			__txt_detail::__segment_step __read
+				= __txt_detail::__segmented_drive<max_code_units_v<_UEncoding>>(__input, __process);
+			return _Result(__txt_detail::__segmented_rest(__input, __read._M_consumed), __valid, __decode_state,
+				__encode_state);
+		}
 		else {
 			return basic_validate_decodable_as(::std::forward<_Input>(__input),
 				::std::forward<_Encoding>(__encoding), __decode_state, __encode_state);
@@ -149,6 +149,65 @@ namespace ztd { namespace text {
 		}
 	};
 
+	//////
+	/// @brief The result of a fused validation and counting operation (e.g. from
+	/// ztd_text_validate_and_count_as_transcoded) that specifically does not include a reference to the states.
+	template <typename _Input>
+	class stateless_validate_count_result : public stateless_validate_result<_Input> {
+	private:
+		using __base_t = stateless_validate_result<_Input>;
+
+	public:
+		//////
+		/// @brief The number of code units the output would have for the input read so far. If the input is not
+		/// valid, this is the number of code units for everything before the point of failure.
+		::std::size_t count;
+
+		//////
+		/// @brief Constructs a ztd::text::stateless_validate_count_result.
+		///
+		/// @param[in] __input The input range to store.
+		/// @param[in] __is_valid Whether or not the validation succeeded.
+		/// @param[in] __count The number of code units counted.
+		template <typename _ArgInput>
+		constexpr stateless_validate_count_result(_ArgInput&& __input, bool __is_valid, ::std::size_t __count)
+		: __base_t(::std::forward<_ArgInput>(__input), __is_valid), count(__count) {
+		}
+	};
+
+	//////
+	/// @brief The result of a fused transcoding validation and counting operation (e.g. from
+	/// ztd_text_validate_and_count_as_transcoded).
+	template <typename _Input, typename _DecodeState, typename _EncodeState>
+	class validate_count_transcode_result : public stateless_validate_count_result<_Input> {
+	private:
+		using __base_t = stateless_validate_count_result<_Input>;
+
+	public:
+		//////
+		/// @brief A reference to the state of the associated Encoding used for decoding the input.
+		::ztd::reference_wrapper<_DecodeState> from_state;
+		//////
+		/// @brief A reference to the state of the associated Encoding used for encoding the intermediate code points.
+		::ztd::reference_wrapper<_EncodeState> to_state;
+
+		//////
+		/// @brief Constructs a ztd::text::validate_count_transcode_result.
+		///
+		/// @param[in] __input The input range to store.
+		/// @param[in] __is_valid Whether or not the validation succeeded.
+		/// @param[in] __count The number of code units counted.
+		/// @param[in] __from_state The state related to the encoding that was used to decode.
+		/// @param[in] __to_state The state related to the encoding that was used to encode.
+		template <typename _ArgInput, typename _ArgFromState, typename _ArgToState>
+		constexpr validate_count_transcode_result(_ArgInput&& __input, bool __is_valid, ::std::size_t __count,
+			_ArgFromState&& __from_state, _ArgToState&& __to_state)
+		: __base_t(::std::forward<_ArgInput>(__input), __is_valid, __count)
+		, from_state(::std::forward<_ArgFromState>(__from_state))
+		, to_state(::std::forward<_ArgToState>(__to_state)) {
+		}
+	};
+
 	//////
 	/// @}
 	/////
@@ -169,6 +228,14 @@ namespace ztd { namespace text {
 			return __result;
 		}
 
+		template <typename _Input, typename _DecodeState, typename _EncodeState>
+		constexpr stateless_validate_count_result<_Input>
+		__slice_to_stateless(validate_count_transcode_result<_Input, _DecodeState, _EncodeState>&& __result) noexcept(
+			::std::is_nothrow_constructible_v<stateless_validate_count_result<_Input>,
+			     validate_count_transcode_result<_Input, _DecodeState, _EncodeState>>) {
+			return __result;
+		}
+
 		template <typename _Input, typename _DecodeState, typename _EncodeState>
 		constexpr validate_result<_Input, _DecodeState>
 		__drop_single_state(validate_transcode_result<_Input, _DecodeState, _EncodeState>&& __result) noexcept(
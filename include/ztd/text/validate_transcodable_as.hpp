@@ -41,6 +41,7 @@
 #include <ztd/text/validate_result.hpp>
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/state.hpp>
+#include <ztd/text/segmented_range.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/validate_count_routines.hpp>
@@ -223,6 +224,25 @@ namespace ztd { namespace text {
 				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
 				::std::forward<_ToEncoding>(__to_encoding), __decode_state, __encode_state, __pivot);
 		}
+		else if constexpr (is_segmented_range_v<_Input>) {
+			using _UInput = remove_cvref_t<_Input>;
+			using _Result = validate_transcode_result<ranges::range_reconstruct_t<_UInput>, _DecodeState,
+				_EncodeState>;
+			constexpr ::std::size_t _MaxUnits = max_code_units_v<remove_cvref_t<_FromEncoding>>;
+			bool __valid                      = true;
+			auto __process                    = [&](auto __units, bool __deferrable) {
+				auto __result = validate_transcodable_as(
+					__units, __from_encoding, __to_encoding, __decode_state, __encode_state, __pivot);
+				const ::std::size_t __size   = ranges::ranges_adl::adl_size(__units);
+				const ::std::size_t __unread = ranges::ranges_adl::adl_size(__result.input);
+				// a failure this close to the end of a segment may just be a sequence cut in half by the seam
+				__valid = __result.valid || (__deferrable && __unread < _MaxUnits);
+				return __txt_detail::__segment_step { __size - __unread, !__valid };
+			};
+			__txt_detail::__segment_step __read = __txt_detail::__segmented_drive<_MaxUnits>(__input, __process);
+			return _Result(__txt_detail::__segmented_rest(__input, __read._M_consumed), __valid, __decode_state,
+				__encode_state);
+		}
 		else {
 			return basic_validate_transcodable_as(::std::forward<_Input>(__input),
 				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
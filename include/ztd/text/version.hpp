@@ -100,6 +100,32 @@
 
 #define ZTD_TEXT_PIVOT_TRANSCODE_BUFFER_SIZE_I_(...) (ZTD_TEXT_PIVOT_TRANSCODE_BUFFER_BYTE_SIZE_I_ / sizeof(__VA_ARGS__))
 
+#if defined(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE)
+	#if (ZTD_TEXT_ICONV_DESCRIPTOR_CACHE != 0)
+		#define ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_I_ ZTD_ON
+	#else
+		#define ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_I_ ZTD_OFF
+	#endif
+#else
+	#define ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_I_ ZTD_DEFAULT_OFF
+#endif
+
+#if defined(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE)
+	#define ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE_I_ ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE
+#else
+	#define ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE_I_ 8
+#endif // iconv descriptor cache sizing
+
+#if defined(ZTD_TEXT_LOCALE_ENCODING_CACHE)
+	#if (ZTD_TEXT_LOCALE_ENCODING_CACHE != 0)
+		#define ZTD_TEXT_LOCALE_ENCODING_CACHE_I_ ZTD_ON
+	#else
+		#define ZTD_TEXT_LOCALE_ENCODING_CACHE_I_ ZTD_OFF
+	#endif
+#else
+	#define ZTD_TEXT_LOCALE_ENCODING_CACHE_I_ ZTD_DEFAULT_OFF
+#endif
+
 #if defined(ZTD_TEXT_YES_PLEASE_DESTROY_MY_LITERALS_UTTERLY_I_MEAN_IT)
 	#if (ZTD_TEXT_YES_PLEASE_DESTROY_MY_LITERALS_UTTERLY_I_MEAN_IT != 0)
 		#define ZTD_TEXT_YES_PLEASE_DESTROY_MY_LITERALS_UTTERLY_I_MEAN_IT_I_ ZTD_ON
@@ -168,6 +194,12 @@
 	#define ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_ }
 #endif
 
+#if ZTD_IS_ON(ZTD_COMPILER_VCXX)
+	#define ZTD_TEXT_NOINLINE_I_ __declspec(noinline)
+#else
+	#define ZTD_TEXT_NOINLINE_I_ __attribute__((noinline))
+#endif
+
 // clang-format on
 
 #define ZTD_TEXT_LOSSY_DECODE_MESSAGE_I_                                                                               \
@@ -39,6 +39,9 @@
 #include <ztd/text/impl/wide_execution_iso10646.hpp>
 #include <ztd/text/impl/wide_execution_iconv.hpp>
 #include <ztd/text/impl/wide_execution_cwchar.hpp>
+#include <ztd/text/utf32.hpp>
+#include <ztd/text/is_redundant.hpp>
+#include <ztd/text/is_transcoding_compatible.hpp>
 
 #include <ztd/prologue.hpp>
 
@@ -80,6 +83,40 @@ namespace ztd { namespace text {
 	//////
 	/// @}
 
+#if ZTD_IS_OFF(ZTD_PLATFORM_WINDOWS) && ZTD_IS_ON(ZTD_WCHAR_T_UTF32_COMPATIBLE)
+	namespace __txt_detail {
+		// wchar_t is UTF-32 here, so the wide execution encoding and any UTF-32 encoding whose code units are laid
+		// out like wchar_t hold exactly the same bits: converting between them is a copy.
+		template <typename _CodeUnit>
+		inline constexpr bool __is_wide_execution_utf32_compatible_v
+			= (sizeof(_CodeUnit) == sizeof(wchar_t)) && (alignof(_CodeUnit) == alignof(wchar_t));
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __is_decode_redundant<wide_execution_t, basic_utf32<_CodeUnit, _CodePoint>>
+		: ::std::integral_constant<bool, __is_wide_execution_utf32_compatible_v<_CodeUnit>> { };
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __is_encode_redundant<wide_execution_t, basic_utf32<_CodeUnit, _CodePoint>>
+		: ::std::integral_constant<bool, __is_wide_execution_utf32_compatible_v<_CodeUnit>> { };
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __is_decode_redundant<basic_utf32<_CodeUnit, _CodePoint>, wide_execution_t>
+		: ::std::integral_constant<bool, __is_wide_execution_utf32_compatible_v<_CodeUnit>> { };
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __is_encode_redundant<basic_utf32<_CodeUnit, _CodePoint>, wide_execution_t>
+		: ::std::integral_constant<bool, __is_wide_execution_utf32_compatible_v<_CodeUnit>> { };
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __is_bitwise_transcoding_compatible<wide_execution_t, basic_utf32<_CodeUnit, _CodePoint>>
+		: ::std::integral_constant<bool, __is_wide_execution_utf32_compatible_v<_CodeUnit>> { };
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __is_bitwise_transcoding_compatible<basic_utf32<_CodeUnit, _CodePoint>, wide_execution_t>
+		: ::std::integral_constant<bool, __is_wide_execution_utf32_compatible_v<_CodeUnit>> { };
+	} // namespace __txt_detail
+#endif
+
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
 }} // namespace ztd::text
 
@@ -0,0 +1,95 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/advance_code_points.hpp>
+#include <ztd/text/count_as_decoded.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <string>
+#include <string_view>
+
+TEST_CASE("text/advance_code_points/basic", "advance_code_points skips whole code points and stops at the limit") {
+	const std::u32string_view code_points = U"a\u00E9\u4E2D\U0001F600b";
+	const std::basic_string<ztd::uchar8_t> u8_input
+	     = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf8);
+	const std::u16string u16_input = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf16);
+	SECTION("utf8") {
+		auto none = ztd::text::advance_code_points(u8_input, ztd::text::utf8, 0);
+		REQUIRE(none.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(none.count == 0);
+		REQUIRE(none.input.size() == u8_input.size());
+
+		auto some = ztd::text::advance_code_points(u8_input, ztd::text::utf8, 3);
+		REQUIRE(some.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(some.count == 3);
+		REQUIRE(some.input.size() == 5);
+
+		auto all = ztd::text::advance_code_points(u8_input, ztd::text::utf8, 10);
+		REQUIRE(all.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(all.count == 5);
+		REQUIRE(all.input.empty());
+	}
+	SECTION("utf16") {
+		auto some = ztd::text::advance_code_points(u16_input, ztd::text::utf16, 4);
+		REQUIRE(some.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(some.count == 4);
+		REQUIRE(some.input.size() == 1);
+	}
+	SECTION("ascii") {
+		std::string input(100, 'a');
+		auto result = ztd::text::advance_code_points(input, ztd::text::ascii, 37);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.count == 37);
+		REQUIRE(result.input.size() == 63);
+	}
+	SECTION("truth") {
+		const std::size_t expected
+		     = ztd::text::count_as_decoded(ztd::tests::u8_unicode_sequence_truth_native_endian, ztd::text::utf8)
+		            .count;
+		auto result = ztd::text::advance_code_points(
+		     ztd::tests::u8_unicode_sequence_truth_native_endian, ztd::text::utf8, expected + 1);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.count == expected);
+		REQUIRE(result.input.empty());
+	}
+	SECTION("invalid") {
+		std::basic_string<ztd::uchar8_t> input(100, static_cast<ztd::uchar8_t>('a'));
+		input[50] = static_cast<ztd::uchar8_t>(0xFF);
+		ztd::text::pass_handler_t handler {};
+		auto result = ztd::text::advance_code_points(input, ztd::text::utf8, 80, handler);
+		REQUIRE(result.error_code != ztd::text::encoding_error::ok);
+		REQUIRE(result.count == 50);
+	}
+}
@@ -213,3 +213,21 @@ TEST_CASE("text/decode/any_encoding/encoding_scheme", "decode from byte arrays w
 		}
 	}
 }
+
+TEST_CASE("text/decode/any_encoding/errors", "bulk decode through an erased encoding keeps going past errors") {
+	const std::byte input_storage[] = { std::byte { 'a' }, std::byte { 0xFF }, std::byte { 'b' },
+		std::byte { 0xFF }, std::byte { 'c' } };
+	const std::u32string_view expected = U"a\uFFFDb\uFFFDc";
+
+	ztd::text::any_encoding encoding(ztd::text::utf8);
+	ztd::text::any_encoding::decode_state state = ztd::text::make_decode_state(encoding);
+	char32_t output_storage[16] {};
+	ztd::span<const std::byte> input(input_storage);
+	ztd::span<char32_t> output(output_storage);
+	auto result = ztd::text::decode_into(input, encoding, output, ztd::text::replacement_handler, state);
+	std::u32string_view result_view(output_storage, static_cast<std::size_t>(result.output.data() - output_storage));
+	REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+	REQUIRE(result.handled_errors == 2);
+	REQUIRE(std::size(result.input) == 0);
+	REQUIRE(result_view == expected);
+}
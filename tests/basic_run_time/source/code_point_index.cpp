@@ -0,0 +1,130 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+#include <ztd/text/code_point_index.hpp>
+#include <ztd/text/decode_one.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	template <typename Encoding, typename CodeUnit>
+	std::vector<std::size_t> code_point_offsets(std::basic_string_view<CodeUnit> input, const Encoding& encoding) {
+		std::vector<std::size_t> offsets { 0 };
+		std::basic_string_view<CodeUnit> rest = input;
+		while (!rest.empty()) {
+			auto result = ztd::text::decode_one(rest, encoding, ztd::text::replacement_handler);
+			rest        = result.input;
+			offsets.push_back(input.size() - rest.size());
+		}
+		return offsets;
+	}
+
+	template <typename Encoding, typename CodeUnit>
+	void check_index(std::basic_string_view<CodeUnit> input, const Encoding& encoding, std::size_t stride) {
+		const std::vector<std::size_t> truth = code_point_offsets(input, encoding);
+		const std::size_t code_points        = truth.size() - 1;
+		ztd::text::basic_code_point_index<Encoding> index(stride, encoding);
+		// backwards first so that the far checkpoints are built before the near ones are asked for
+		for (std::size_t n = code_points + 3; n-- > 0;) {
+			auto result                      = index.advance(input, n, ztd::text::replacement_handler);
+			const std::size_t expected_count = n < code_points ? n : code_points;
+			REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+			REQUIRE(result.count == expected_count);
+			REQUIRE(static_cast<std::size_t>(result.input.data() - input.data()) == truth[expected_count]);
+		}
+		for (std::size_t n = 0; n < code_points; n += 3) {
+			auto sub               = index.substr(input, n, 5, ztd::text::replacement_handler);
+			const std::size_t last = n + 5 < code_points ? n + 5 : code_points;
+			REQUIRE(static_cast<std::size_t>(sub.data() - input.data()) == truth[n]);
+			REQUIRE(sub.size() == truth[last] - truth[n]);
+		}
+		// the checkpoints past the change are dropped and built again on demand
+		index.invalidate_from(truth[code_points / 2]);
+		REQUIRE(index.checkpoints().back().code_units <= truth[code_points / 2]);
+		auto result = index.advance(input, code_points, ztd::text::replacement_handler);
+		REQUIRE(result.count == code_points);
+		REQUIRE(result.input.empty());
+	}
+
+	template <typename CodeUnit>
+	std::basic_string<CodeUnit> repeated(const CodeUnit* first, std::size_t first_size, const CodeUnit* second,
+	     std::size_t second_size) {
+		std::basic_string<CodeUnit> text;
+		for (std::size_t i = 0; i < 8; ++i) {
+			text.append(first, first_size);
+			text.append(second, second_size);
+		}
+		return text;
+	}
+} // namespace
+
+TEST_CASE("text/code_point_index", "a code point index finds the same positions as decoding from the start") {
+	SECTION("utf8") {
+		const auto text = repeated(ztd::tests::u8_basic_source_character_set.data(),
+		     ztd::tests::u8_basic_source_character_set.size(),
+		     ztd::tests::u8_unicode_sequence_truth_native_endian.data(),
+		     ztd::tests::u8_unicode_sequence_truth_native_endian.size());
+		const std::basic_string_view<ztd::uchar8_t> input(text.data(), text.size());
+		check_index(input, ztd::text::utf8, 1);
+		check_index(input, ztd::text::utf8, 7);
+		check_index(input, ztd::text::utf8, 64);
+	}
+	SECTION("utf8 with errors") {
+		std::basic_string<ztd::uchar8_t> text;
+		for (std::size_t i = 0; i < 40; ++i) {
+			text.push_back(static_cast<ztd::uchar8_t>('a' + (i % 26)));
+			if (i % 7 == 0) {
+				text.push_back(static_cast<ztd::uchar8_t>(0xFF));
+			}
+			if (i % 11 == 0) {
+				text.push_back(static_cast<ztd::uchar8_t>(0xE2));
+				text.push_back(static_cast<ztd::uchar8_t>(0x82));
+			}
+		}
+		const std::basic_string_view<ztd::uchar8_t> input(text.data(), text.size());
+		check_index(input, ztd::text::utf8, 4);
+	}
+	SECTION("utf16") {
+		const auto text = repeated(ztd::tests::u16_basic_source_character_set.data(),
+		     ztd::tests::u16_basic_source_character_set.size(),
+		     ztd::tests::u16_unicode_sequence_truth_native_endian.data(),
+		     ztd::tests::u16_unicode_sequence_truth_native_endian.size());
+		const std::u16string_view input(text.data(), text.size());
+		check_index(input, ztd::text::utf16, 5);
+		check_index(input, ztd::text::utf16, 128);
+	}
+}
@@ -36,6 +36,10 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <clocale>
+#include <string>
+#include <string_view>
+
 TEST_CASE("text/decode/core", "basic usages of decode function do not explode") {
 	SECTION("execution") {
 		ztd::text::execution_t encoding {};
@@ -49,7 +53,40 @@ TEST_CASE("text/decode/core", "basic usages of decode function do not explode")
 			     ztd::tests::unicode_sequence_truth_native_endian, encoding, ztd::text::replacement_handler);
 			REQUIRE(result1 == ztd::tests::u32_unicode_sequence_truth_native_endian);
 		}
+
+		std::string long_input(5000, 'a');
+		long_input[2500] = '\0';
+		std::u32string long_expected(5000, U'a');
+		long_expected[2500] = U'\0';
+		std::u32string result2 = ztd::text::decode(long_input, encoding, ztd::text::replacement_handler);
+		REQUIRE(result2 == long_expected);
+	}
+#if (ZTD_IS_ON(ZTD_CUCHAR) || ZTD_IS_ON(ZTD_UCHAR)) && ZTD_IS_OFF(ZTD_PLATFORM_MAC_OS)
+	SECTION("execution, finishing a sequence the C library started") {
+		const std::string original_locale = std::setlocale(LC_ALL, nullptr);
+		const char* utf8_locales[]        = { "C.UTF-8", "C.utf8", "en_US.UTF-8", "en_US.utf8" };
+		bool has_utf8_locale              = false;
+		for (const char* candidate : utf8_locales) {
+			if (std::setlocale(LC_ALL, candidate) != nullptr && ztd::is_execution_encoding_utf8()) {
+				has_utf8_locale = true;
+				break;
+			}
+		}
+		if (has_utf8_locale) {
+			ztd::text::execution_t encoding {};
+			auto state              = ztd::text::make_decode_state(encoding);
+			char32_t ignored        = U'\0';
+			std::size_t lead_result = ZTD_UCHAR_ACCESSOR_I_ mbrtoc32(&ignored, "\xC3", 1, &state.__narrow_state);
+			REQUIRE(lead_result == static_cast<std::size_t>(-2));
+			// the rest of U+00E9, which the UTF-8 shortcut would not know the start of
+			std::string_view rest = "\xA9"
+			                        "bc";
+			std::u32string result = ztd::text::decode(rest, encoding, ztd::text::replacement_handler, state);
+			REQUIRE(result == U"\u00E9bc");
+		}
+		std::setlocale(LC_ALL, original_locale.c_str());
 	}
+#endif
 	SECTION("wide_execution") {
 		ztd::text::wide_execution_t encoding {};
 		std::u32string result0
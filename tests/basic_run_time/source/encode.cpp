@@ -47,6 +47,13 @@ TEST_CASE("text/encode/core", "basic usages of encode function do not explode")
 			     ztd::tests::u32_unicode_sequence_truth_native_endian, encoding, ztd::text::replacement_handler);
 			REQUIRE(result1 == ztd::tests::unicode_sequence_truth_native_endian);
 		}
+
+		std::u32string long_input(5000, U'a');
+		long_input[2500] = U'\0';
+		std::string long_expected(5000, 'a');
+		long_expected[2500] = '\0';
+		std::string result2 = ztd::text::encode(long_input, encoding, ztd::text::replacement_handler);
+		REQUIRE(result2 == long_expected);
 	}
 	SECTION("wide_execution") {
 		ztd::text::wide_execution_t encoding {};
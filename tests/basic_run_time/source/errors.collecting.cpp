@@ -0,0 +1,115 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/error_collecting_handler.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+
+TEST_CASE("text/encoding/errors/collecting", "every error is recorded, and the operation keeps going") {
+	std::basic_string<ztd::uchar8_t> input(5000, static_cast<ztd::uchar8_t>('a'));
+	input[10]   = static_cast<ztd::uchar8_t>(0xFF);
+	input[2000] = static_cast<ztd::uchar8_t>(0x80);
+	input[4999] = static_cast<ztd::uchar8_t>(0xFE);
+
+	SECTION("transcode") {
+		ztd::text::error_record records[8] {};
+		ztd::text::error_collecting_handler<> handler(input.size(), records);
+		std::u16string output = ztd::text::transcode(input, ztd::text::utf8, ztd::text::utf16,
+		     handler, ztd::text::replacement_handler);
+		REQUIRE(output.size() == input.size());
+		REQUIRE(output[10] == u'\xFFFD');
+		REQUIRE(output[2000] == u'\xFFFD');
+		REQUIRE(output[4999] == u'\xFFFD');
+		REQUIRE(handler.error_count() == 3);
+		REQUIRE_FALSE(handler.overflowed());
+		auto collected = handler.records();
+		REQUIRE(collected.size() == 3);
+		REQUIRE(collected[0].input_offset == 10);
+		REQUIRE(collected[1].input_offset == 2000);
+		REQUIRE(collected[2].input_offset == 4999);
+		for (const ztd::text::error_record& record : collected) {
+			REQUIRE(record.error_code == ztd::text::encoding_error::invalid_sequence);
+			REQUIRE(record.input_length == 1);
+		}
+	}
+	SECTION("transcode with a single handler") {
+		// the "to" side cannot copy the handler, so its errors (the U+FFFDs and the U+00E9 do not fit in ASCII) are
+		// handled by the default handler and never mixed in with the input's records
+		std::basic_string<ztd::uchar8_t> mixed_input = input;
+		mixed_input[100]                             = static_cast<ztd::uchar8_t>(0xC3);
+		mixed_input[101]                             = static_cast<ztd::uchar8_t>(0xA9);
+		ztd::text::error_record records[8] {};
+		ztd::text::error_collecting_handler<> handler(mixed_input.size(), records);
+		std::string output = ztd::text::transcode(mixed_input, ztd::text::utf8, ztd::text::ascii, handler);
+		REQUIRE(output.size() == mixed_input.size() - 1);
+		REQUIRE(output[10] == '?');
+		REQUIRE(output[100] == '?');
+		REQUIRE(output[1999] == '?');
+		REQUIRE(output[4998] == '?');
+		REQUIRE(handler.error_count() == 3);
+		auto collected = handler.records();
+		REQUIRE(collected.size() == 3);
+		REQUIRE(collected[0].input_offset == 10);
+		REQUIRE(collected[1].input_offset == 2000);
+		REQUIRE(collected[2].input_offset == 4999);
+	}
+	SECTION("decode") {
+		ztd::text::error_record records[8] {};
+		ztd::text::error_collecting_handler<> handler(input.size(), records);
+		std::u32string output = ztd::text::decode(input, ztd::text::utf8, handler);
+		REQUIRE(output.size() == input.size());
+		REQUIRE(handler.error_count() == 3);
+		auto collected = handler.records();
+		REQUIRE(collected.size() == 3);
+		REQUIRE(collected[0].input_offset == 10);
+		REQUIRE(collected[1].input_offset == 2000);
+		REQUIRE(collected[2].input_offset == 4999);
+	}
+	SECTION("full buffer") {
+		ztd::text::error_record records[1] {};
+		ztd::text::error_collecting_handler<> handler(input.size(), records);
+		std::u16string output = ztd::text::transcode(input, ztd::text::utf8, ztd::text::utf16,
+		     handler, ztd::text::replacement_handler);
+		REQUIRE(output.size() == input.size());
+		REQUIRE(handler.error_count() == 3);
+		REQUIRE(handler.overflowed());
+		REQUIRE(handler.records().size() == 1);
+		REQUIRE(handler.records()[0].input_offset == 10);
+
+		handler.reset(input.size());
+		REQUIRE(handler.error_count() == 0);
+		REQUIRE(handler.records().empty());
+	}
+}
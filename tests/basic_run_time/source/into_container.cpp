@@ -0,0 +1,98 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/text.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+TEST_CASE("text/into_container", "conversions append into an existing, allocator-aware container") {
+	std::basic_string<ztd::uchar8_t> input(300, static_cast<ztd::uchar8_t>('a'));
+	input[10] = static_cast<ztd::uchar8_t>(0xC3);
+	input[11] = static_cast<ztd::uchar8_t>(0xA9);
+	std::u32string expected32(299, U'a');
+	expected32[10] = U'\xE9';
+	std::u16string expected16(299, u'a');
+	expected16[10] = u'\xE9';
+
+	alignas(std::max_align_t) std::byte storage[16 * 1024];
+	std::pmr::monotonic_buffer_resource resource(storage, sizeof(storage), std::pmr::null_memory_resource());
+
+	SECTION("decode") {
+		std::pmr::u32string output(U"!", &resource);
+		auto result = ztd::text::decode_into_container(input, ztd::text::utf8, output);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.input.empty());
+		REQUIRE(&result.output.get() == &output);
+		REQUIRE(output.get_allocator().resource() == &resource);
+		REQUIRE(output.size() == expected32.size() + 1);
+		REQUIRE(output[0] == U'!');
+		REQUIRE(std::u32string_view(output).substr(1) == expected32);
+	}
+	SECTION("encode") {
+		std::pmr::u16string output(&resource);
+		auto result = ztd::text::encode_into_container(expected32, ztd::text::utf16, output);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.input.empty());
+		REQUIRE(&result.output.get() == &output);
+		REQUIRE(output.get_allocator().resource() == &resource);
+		REQUIRE(std::u16string_view(output) == expected16);
+	}
+	SECTION("transcode") {
+		std::pmr::u16string output(&resource);
+		auto result = ztd::text::transcode_into_container(input, ztd::text::utf8, output, ztd::text::utf16);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.input.empty());
+		REQUIRE(&result.output.get() == &output);
+		REQUIRE(std::u16string_view(output) == expected16);
+		// appending does not clear what is already there
+		ztd::text::transcode_into_container(input, ztd::text::utf8, output, ztd::text::utf16);
+		REQUIRE(output.size() == expected16.size() * 2);
+		REQUIRE(std::u16string_view(output).substr(expected16.size()) == expected16);
+		REQUIRE(output.get_allocator().resource() == &resource);
+	}
+	SECTION("basic_text") {
+		using pmr_u16text = ztd::text::basic_text<ztd::text::utf16_t, ztd::text::nfkc, std::pmr::u16string>;
+		std::pmr::polymorphic_allocator<char16_t> allocator(&resource);
+		pmr_u16text empty_text(std::allocator_arg, allocator);
+		REQUIRE(empty_text.get_allocator().resource() == &resource);
+		REQUIRE(empty_text.base().empty());
+		pmr_u16text txt(std::allocator_arg, allocator, ztd::ranges::from_range, input, ztd::text::utf8);
+		REQUIRE(txt.get_allocator().resource() == &resource);
+		REQUIRE(std::u16string_view(txt.base()) == expected16);
+	}
+}
@@ -0,0 +1,159 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+#include <ztd/text/decode_view.hpp>
+#include <ztd/text/transcode_view.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace {
+	using u8_view = std::basic_string_view<ztd::uchar8_t>;
+
+	std::basic_string<ztd::uchar8_t> long_input(bool with_errors) {
+		std::basic_string<ztd::uchar8_t> input;
+		for (std::size_t i = 0; i < 12; ++i) {
+			input.append(ztd::tests::u8_basic_source_character_set.data(),
+			     ztd::tests::u8_basic_source_character_set.size());
+			input.append(ztd::tests::u8_unicode_sequence_truth_native_endian.data(),
+			     ztd::tests::u8_unicode_sequence_truth_native_endian.size());
+			if (with_errors) {
+				// a lone continuation byte, then a lead byte cut off by an ASCII letter
+				input.push_back(static_cast<ztd::uchar8_t>(0x80));
+				input.push_back(static_cast<ztd::uchar8_t>(0xE2));
+				input.push_back(static_cast<ztd::uchar8_t>('a'));
+			}
+		}
+		return input;
+	}
+
+	template <std::size_t CacheSize, typename Input>
+	void check_decode_cache(const Input& input) {
+		using state        = ztd::text::decode_state_t<ztd::text::utf8_t>;
+		using default_view = ztd::text::decode_view<ztd::text::utf8_t, u8_view, ztd::text::replacement_handler_t>;
+		using cached_view  = ztd::text::decode_view<ztd::text::utf8_t, u8_view, ztd::text::replacement_handler_t,
+		     state, CacheSize>;
+		default_view truth_view(u8_view(input.data(), input.size()));
+		cached_view result_view(u8_view(input.data(), input.size()));
+		auto truth_it          = truth_view.begin();
+		const auto truth_last  = truth_view.end();
+		auto result_it         = result_view.begin();
+		const auto result_last = result_view.end();
+		for (; result_it != result_last; ++result_it, (void)++truth_it) {
+			REQUIRE(truth_it != truth_last);
+			REQUIRE(*truth_it == *result_it);
+		}
+		REQUIRE(truth_it == truth_last);
+	}
+
+	template <std::size_t CacheSize, typename Input>
+	void check_transcode_cache(const Input& input) {
+		using from_state   = ztd::text::decode_state_t<ztd::text::utf8_t>;
+		using to_state     = ztd::text::encode_state_t<ztd::text::utf16_t>;
+		using default_view = ztd::text::transcode_view<ztd::text::utf8_t, ztd::text::utf16_t, u8_view,
+		     ztd::text::replacement_handler_t, ztd::text::replacement_handler_t>;
+		using cached_view  = ztd::text::transcode_view<ztd::text::utf8_t, ztd::text::utf16_t, u8_view,
+		     ztd::text::replacement_handler_t, ztd::text::replacement_handler_t, from_state, to_state, CacheSize>;
+		default_view truth_view(u8_view(input.data(), input.size()));
+		cached_view result_view(u8_view(input.data(), input.size()));
+		auto truth_it          = truth_view.begin();
+		const auto truth_last  = truth_view.end();
+		auto result_it         = result_view.begin();
+		const auto result_last = result_view.end();
+		for (; result_it != result_last; ++result_it, (void)++truth_it) {
+			REQUIRE(truth_it != truth_last);
+			REQUIRE(*truth_it == *result_it);
+		}
+		REQUIRE(truth_it == truth_last);
+	}
+
+	template <std::size_t CacheSize, typename Input>
+	void check_transcode_cache_throws(const Input& input) {
+		using from_state = ztd::text::decode_state_t<ztd::text::utf8_t>;
+		using to_state   = ztd::text::encode_state_t<ztd::text::utf16_t>;
+		using view       = ztd::text::transcode_view<ztd::text::utf8_t, ztd::text::utf16_t, u8_view,
+		     ztd::text::throw_handler_t, ztd::text::throw_handler_t, from_state, to_state, CacheSize>;
+		view result_view(u8_view(input.data(), input.size()));
+		auto action = [&]() {
+			for (auto result_it = result_view.begin(); result_it != result_view.end(); ++result_it) {
+			}
+		};
+		REQUIRE_THROWS_AS(action(), std::system_error);
+	}
+} // namespace
+
+TEST_CASE("text/iterator_cache", "a larger iterator cache produces the same values as the default one") {
+	SECTION("decode_view") {
+		SECTION("valid") {
+			const auto input = long_input(false);
+			check_decode_cache<2>(input);
+			check_decode_cache<7>(input);
+			check_decode_cache<64>(input);
+			check_decode_cache<256>(input);
+		}
+		SECTION("invalid") {
+			const auto input = long_input(true);
+			check_decode_cache<2>(input);
+			check_decode_cache<7>(input);
+			check_decode_cache<64>(input);
+			check_decode_cache<256>(input);
+		}
+	}
+	SECTION("transcode_view") {
+		SECTION("valid") {
+			const auto input = long_input(false);
+			check_transcode_cache<3>(input);
+			check_transcode_cache<7>(input);
+			check_transcode_cache<64>(input);
+			check_transcode_cache<256>(input);
+		}
+		SECTION("invalid") {
+			const auto input = long_input(true);
+			check_transcode_cache<3>(input);
+			check_transcode_cache<7>(input);
+			check_transcode_cache<64>(input);
+			check_transcode_cache<256>(input);
+		}
+		SECTION("throwing") {
+			// the handlers are called while reading ahead, too: what they throw has to make it out (past the first
+			// read, which happens when the view is made)
+			std::basic_string<ztd::uchar8_t> input(600, static_cast<ztd::uchar8_t>('a'));
+			input += long_input(true);
+			check_transcode_cache_throws<64>(input);
+			check_transcode_cache_throws<256>(input);
+		}
+	}
+}
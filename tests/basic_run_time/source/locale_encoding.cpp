@@ -0,0 +1,52 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/locale_encoding.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/transcode.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <string>
+
+TEST_CASE("text/locale_encoding/refresh",
+     "refreshing the cached locale encoding keeps the answers of the execution encodings stable") {
+	const bool execution_is_unicode      = ztd::text::contains_unicode_encoding(ztd::text::execution);
+	const bool wide_execution_is_unicode = ztd::text::contains_unicode_encoding(ztd::text::wide_execution);
+	ztd::text::refresh_locale_encoding();
+	REQUIRE(ztd::text::contains_unicode_encoding(ztd::text::execution) == execution_is_unicode);
+	REQUIRE(ztd::text::contains_unicode_encoding(ztd::text::wide_execution) == wide_execution_is_unicode);
+
+	std::string result = ztd::text::transcode(
+	     ztd::tests::basic_source_character_set, ztd::text::execution, ztd::text::execution, ztd::text::pass_handler);
+	REQUIRE(result == ztd::tests::basic_source_character_set);
+}
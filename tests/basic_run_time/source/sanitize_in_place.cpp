@@ -0,0 +1,110 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/sanitize_in_place.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+
+TEST_CASE("text/sanitize_in_place/valid", "sanitize_in_place leaves well-formed UTF-8 alone") {
+	std::string input
+	     = "plain ASCII text, long enough to take the word-at-a-time path \xE2\x82\xAC \xF0\x9F\x98\x80";
+	const std::string original = input;
+	SECTION("replacement code unit") {
+		auto result = ztd::text::sanitize_in_place(input, '?');
+		REQUIRE_FALSE(result.errors_were_handled());
+		REQUIRE(result.output.size() == original.size());
+		REQUIRE(input == original);
+	}
+	SECTION("U+FFFD") {
+		auto result = ztd::text::sanitize_in_place(input);
+		REQUIRE_FALSE(result.errors_were_handled());
+		REQUIRE(result.output.data() == input.data());
+		REQUIRE(input == original);
+	}
+}
+
+TEST_CASE("text/sanitize_in_place/span", "sanitize_in_place replaces ill-formed sequences inside of a span") {
+	std::string input = "a\x80"
+	                    "b\xE2\x82"
+	                    "c\xC0\xAF"
+	                    "d";
+	ztd::span<char> buffer(&input[0], input.size());
+	SECTION("question mark") {
+		auto result = ztd::text::sanitize_in_place(buffer);
+		REQUIRE(result.handled_errors == 4);
+		REQUIRE(result.output.data() == buffer.data());
+		REQUIRE(std::string(result.output.data(), result.output.size()) == "a?b?c??d");
+	}
+	SECTION("custom replacement") {
+		auto result = ztd::text::sanitize_in_place(buffer, '_');
+		REQUIRE(result.handled_errors == 4);
+		REQUIRE(std::string(result.output.data(), result.output.size()) == "a_b_c__d");
+	}
+}
+
+TEST_CASE("text/sanitize_in_place/string", "sanitize_in_place shrinks or grows a string to fit the replacements") {
+	SECTION("replacement code unit") {
+		std::string input = "\xF0\x9F\x98"
+		                    "abc\xFF";
+		auto result       = ztd::text::sanitize_in_place(input, '?');
+		REQUIRE(result.handled_errors == 2);
+		REQUIRE(input == "?abc?");
+	}
+	SECTION("U+FFFD shrinking") {
+		std::string input = "x\xF0\x9F\x98"
+		                    "y";
+		auto result       = ztd::text::sanitize_in_place(input);
+		REQUIRE(result.handled_errors == 1);
+		REQUIRE(input == "x\xEF\xBF\xBDy");
+		REQUIRE(result.output.size() == input.size());
+	}
+	SECTION("U+FFFD growing") {
+		// the maximal subparts from table 3-8 of the Unicode Standard
+		std::string input = "\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64";
+		auto result       = ztd::text::sanitize_in_place(input);
+		REQUIRE(result.handled_errors == 6);
+		REQUIRE(input
+		     == "a\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD"
+		        "b\xEF\xBF\xBD"
+		        "c\xEF\xBF\xBD\xEF\xBF\xBD"
+		        "d");
+	}
+	SECTION("all ill-formed") {
+		std::string input(100, '\x80');
+		auto result = ztd::text::sanitize_in_place(input);
+		REQUIRE(result.handled_errors == 100);
+		REQUIRE(input.size() == 300);
+		for (std::size_t i = 0; i < input.size(); i += 3) {
+			REQUIRE(input.compare(i, 3, "\xEF\xBF\xBD") == 0);
+		}
+	}
+}
@@ -0,0 +1,167 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+#include <ztd/text/scratch_memory.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace {
+	struct counting_memory_resource {
+		std::size_t allocations   = 0;
+		std::size_t deallocations = 0;
+		std::size_t bytes         = 0;
+
+		void* allocate(std::size_t size, std::size_t alignment) {
+			++allocations;
+			bytes = size;
+			(void)alignment;
+			return std::allocator<std::max_align_t>().allocate(size / sizeof(std::max_align_t) + 1);
+		}
+
+		void deallocate(void* pointer, std::size_t size, std::size_t alignment) {
+			++deallocations;
+			(void)alignment;
+			std::allocator<std::max_align_t>().deallocate(
+			     static_cast<std::max_align_t*>(pointer), size / sizeof(std::max_align_t) + 1);
+		}
+	};
+
+	constexpr std::byte sentinel = static_cast<std::byte>(0xA5);
+
+	void fill_with_sentinel(ztd::span<std::byte> storage) {
+		std::fill(storage.begin(), storage.end(), sentinel);
+	}
+
+	bool is_untouched(ztd::span<std::byte> storage) {
+		return std::all_of(storage.begin(), storage.end(), [](std::byte b) { return b == sentinel; });
+	}
+
+	// whether a run of the given code points, as they would sit in a pivot buffer, is somewhere in the storage
+	bool holds_code_points(ztd::span<std::byte> storage, const std::u32string& code_points) {
+		const std::byte* first  = reinterpret_cast<const std::byte*>(code_points.data());
+		const std::size_t bytes = code_points.size() * sizeof(char32_t);
+		return std::search(storage.begin(), storage.end(), first, first + bytes) != storage.end();
+	}
+} // namespace
+
+TEST_CASE("text/scratch_memory", "conversions take their pivot and intermediate buffers from scratch memory") {
+	// neither side has a bulk UTF path, so these go through a pivot and (for the *_to forms) an intermediate buffer
+	std::string input(5000, 'a');
+	input[10]   = 'b';
+	input[4000] = '\xFF';
+	std::u16string expected16(5000, u'a');
+	expected16[10]   = u'b';
+	expected16[4000] = u'\uFFFD';
+	std::u32string expected32(5000, U'a');
+	expected32[10]   = U'b';
+	expected32[4000] = U'\uFFFD';
+	const std::u32string pivot_run(16, U'a');
+
+	SECTION("user storage") {
+		alignas(std::max_align_t) static std::byte storage[64 * 1024];
+		fill_with_sentinel(storage);
+		ztd::text::scratch_memory_scope scope(storage);
+		REQUIRE(scope.storage().data() == storage);
+		REQUIRE(scope.storage().size() == sizeof(storage));
+		REQUIRE(scope.buffer_size() == sizeof(storage) / 2);
+		REQUIRE(is_untouched(storage));
+		std::u16string transcoded
+		     = ztd::text::transcode(input, ztd::text::ascii, ztd::text::utf16, ztd::text::replacement_handler);
+		REQUIRE(transcoded == expected16);
+		REQUIRE_FALSE(is_untouched(storage));
+		REQUIRE(holds_code_points(storage, pivot_run));
+
+		fill_with_sentinel(storage);
+		std::u32string decoded = ztd::text::decode(input, ztd::text::ascii, ztd::text::replacement_handler);
+		REQUIRE(decoded == expected32);
+		REQUIRE(holds_code_points(storage, pivot_run));
+	}
+	SECTION("buffer size") {
+		alignas(std::max_align_t) static std::byte storage[64 * 1024];
+		fill_with_sentinel(storage);
+		{
+			// the pivot is as big as the scope says, not as big as the stack buffer would have been
+			ztd::text::scratch_memory_scope scope(storage, 32 * 1024);
+			REQUIRE(scope.buffer_size() == 32 * 1024);
+			std::u16string transcoded
+			     = ztd::text::transcode(input, ztd::text::ascii, ztd::text::utf16, ztd::text::replacement_handler);
+			REQUIRE(transcoded == expected16);
+			REQUIRE(holds_code_points(storage, std::u32string(3000, U'a')));
+		}
+		fill_with_sentinel(storage);
+		{
+			// too small for even one buffer: the stack is used instead
+			ztd::text::scratch_memory_scope scope(storage, 2);
+			std::u16string transcoded
+			     = ztd::text::transcode(input, ztd::text::ascii, ztd::text::utf16, ztd::text::replacement_handler);
+			REQUIRE(transcoded == expected16);
+			std::u32string decoded = ztd::text::decode(input, ztd::text::ascii, ztd::text::replacement_handler);
+			REQUIRE(decoded == expected32);
+			REQUIRE(is_untouched(storage));
+		}
+	}
+	SECTION("memory resource") {
+		counting_memory_resource resource {};
+		{
+			ztd::text::scratch_memory_scope scope(resource, 64 * 1024);
+			REQUIRE(resource.allocations == 1);
+			REQUIRE(resource.bytes == 64 * 1024);
+			REQUIRE(scope.storage().size() == 64 * 1024);
+			fill_with_sentinel(scope.storage());
+			{
+				// nested scopes take over, then hand back
+				alignas(std::max_align_t) static std::byte inner_storage[64 * 1024];
+				fill_with_sentinel(inner_storage);
+				ztd::text::scratch_memory_scope inner_scope(inner_storage);
+				std::u16string transcoded = ztd::text::transcode(
+				     input, ztd::text::ascii, ztd::text::utf16, ztd::text::replacement_handler);
+				REQUIRE(transcoded == expected16);
+				REQUIRE(holds_code_points(inner_storage, pivot_run));
+				REQUIRE(is_untouched(scope.storage()));
+			}
+			std::u16string transcoded
+			     = ztd::text::transcode(input, ztd::text::ascii, ztd::text::utf16, ztd::text::replacement_handler);
+			REQUIRE(transcoded == expected16);
+			REQUIRE(holds_code_points(scope.storage(), pivot_run));
+			REQUIRE(resource.deallocations == 0);
+		}
+		REQUIRE(resource.deallocations == 1);
+		std::u32string decoded = ztd::text::decode(input, ztd::text::ascii, ztd::text::replacement_handler);
+		REQUIRE(decoded == expected32);
+	}
+}
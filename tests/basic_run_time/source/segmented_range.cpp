@@ -0,0 +1,163 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/count_as_decoded.hpp>
+#include <ztd/text/count_as_transcoded.hpp>
+#include <ztd/text/validate_decodable_as.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/ranges/subrange.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace {
+	using u8_view = std::basic_string_view<ztd::uchar8_t>;
+
+	// walks two separately-stored strings as if they were one, like the two halves of a gap buffer
+	struct two_piece_iterator {
+		using value_type        = ztd::uchar8_t;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = const ztd::uchar8_t*;
+		using reference         = const ztd::uchar8_t&;
+		using iterator_category = std::forward_iterator_tag;
+
+		const std::array<u8_view, 2>* pieces;
+		std::size_t piece;
+		std::size_t index;
+
+		reference operator*() const {
+			return (*pieces)[piece][index];
+		}
+
+		two_piece_iterator& operator++() {
+			++index;
+			if (piece == 0 && index == (*pieces)[0].size()) {
+				piece = 1;
+				index = 0;
+			}
+			return *this;
+		}
+
+		two_piece_iterator operator++(int) {
+			two_piece_iterator copy = *this;
+			++(*this);
+			return copy;
+		}
+
+		friend bool operator==(const two_piece_iterator& left, const two_piece_iterator& right) {
+			return left.piece == right.piece && left.index == right.index;
+		}
+
+		friend bool operator!=(const two_piece_iterator& left, const two_piece_iterator& right) {
+			return !(left == right);
+		}
+	};
+
+	using two_piece_range = ztd::ranges::subrange<two_piece_iterator, two_piece_iterator>;
+
+	two_piece_range make_two_piece_range(const std::array<u8_view, 2>& pieces) {
+		two_piece_iterator first { &pieces, pieces[0].empty() ? 1u : 0u, 0 };
+		two_piece_iterator last { &pieces, 1, pieces[1].size() };
+		return two_piece_range(first, last);
+	}
+
+	std::array<ztd::span<const ztd::uchar8_t>, 2> text_segments(const two_piece_range& range) {
+		two_piece_iterator first             = range.begin();
+		two_piece_iterator last              = range.end();
+		const std::array<u8_view, 2>& pieces = *first.pieces;
+		if (first.piece == 1) {
+			return { ztd::span<const ztd::uchar8_t>(pieces[1].data() + first.index, last.index - first.index),
+				ztd::span<const ztd::uchar8_t>() };
+		}
+		return { ztd::span<const ztd::uchar8_t>(pieces[0].data() + first.index, pieces[0].size() - first.index),
+			ztd::span<const ztd::uchar8_t>(pieces[1].data(), last.index) };
+	}
+
+	static_assert(ztd::text::is_segmented_range_v<two_piece_range>);
+
+	void check_split_matches_contiguous(u8_view data) {
+		std::u32string expected_output(data.size() + 1, U'\0');
+		auto expected = ztd::text::transcode_into(data, ztd::text::utf8,
+		     ztd::span<char32_t>(expected_output.data(), expected_output.size()), ztd::text::utf32,
+		     ztd::text::replacement_handler);
+		expected_output.resize(static_cast<std::size_t>(expected.output.data() - expected_output.data()));
+		auto expected_count      = ztd::text::count_as_decoded(data, ztd::text::utf8);
+		auto expected_u16_count  = ztd::text::count_as_transcoded(data, ztd::text::utf8, ztd::text::utf16);
+		auto expected_validation = ztd::text::validate_decodable_as(data, ztd::text::utf8);
+
+		for (std::size_t split = 0; split <= data.size(); ++split) {
+			std::array<u8_view, 2> pieces { data.substr(0, split), data.substr(split) };
+			two_piece_range input = make_two_piece_range(pieces);
+
+			std::u32string output(data.size() + 1, U'\0');
+			auto result = ztd::text::transcode_into(input, ztd::text::utf8,
+			     ztd::span<char32_t>(output.data(), output.size()), ztd::text::utf32,
+			     ztd::text::replacement_handler);
+			output.resize(static_cast<std::size_t>(result.output.data() - output.data()));
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.handled_errors == expected.handled_errors);
+			REQUIRE(output == expected_output);
+			REQUIRE(result.input.begin() == result.input.end());
+
+			auto count = ztd::text::count_as_decoded(input, ztd::text::utf8);
+			REQUIRE(count.error_code == expected_count.error_code);
+			REQUIRE(count.count == expected_count.count);
+
+			auto u16_count = ztd::text::count_as_transcoded(input, ztd::text::utf8, ztd::text::utf16);
+			REQUIRE(u16_count.error_code == expected_u16_count.error_code);
+			REQUIRE(u16_count.count == expected_u16_count.count);
+
+			auto validation = ztd::text::validate_decodable_as(input, ztd::text::utf8);
+			REQUIRE(validation.valid == expected_validation.valid);
+			REQUIRE(static_cast<std::size_t>(std::distance(validation.input.begin(), validation.input.end()))
+			     == expected_validation.input.size());
+		}
+	}
+} // namespace
+
+TEST_CASE("text/segmented_range", "segmented inputs give the same answers as contiguous ones, at every seam") {
+	SECTION("valid") {
+		// "aé€😀b": 1, 2, 3 and 4 code unit sequences, so that every kind of sequence gets cut by the seam
+		const ztd::uchar8_t data[] = { 0x61, 0xC3, 0xA9, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80, 0x62 };
+		check_split_matches_contiguous(u8_view(data, std::size(data)));
+	}
+	SECTION("invalid") {
+		// "a", a truncated "€", then "b", and a stray continuation unit at the end
+		const ztd::uchar8_t data[] = { 0x61, 0xE2, 0x82, 0x62, 0x80 };
+		check_split_matches_contiguous(u8_view(data, std::size(data)));
+	}
+}
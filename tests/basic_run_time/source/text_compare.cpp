@@ -0,0 +1,181 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/text_view.hpp>
+#include <ztd/text/text.hpp>
+#include <ztd/text/transcode.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	// in code point order, which is not UTF-16 code unit order past U+D7FF
+	const std::u32string_view sorted_words[] = {
+		U"",
+		U"a",
+		U"ab",
+		U"b",
+		U"\u00E9",
+		U"\u00E9a",
+		U"\uD7FF",
+		U"\uFF21",
+		U"\uFFFD",
+		U"\U00010000",
+		U"\U0001F600",
+		U"\U0001F600a",
+		U"\U0010FFFF",
+	};
+
+	template <typename Left, typename Right>
+	void check_compare(const Left& left, const Right& right, std::size_t left_index, std::size_t right_index) {
+		REQUIRE((left == right) == (left_index == right_index));
+		REQUIRE((left != right) == (left_index != right_index));
+		REQUIRE((left < right) == (left_index < right_index));
+		REQUIRE((left <= right) == (left_index <= right_index));
+		REQUIRE((left > right) == (left_index > right_index));
+		REQUIRE((left >= right) == (left_index >= right_index));
+	}
+} // namespace
+
+TEST_CASE("text/text_view/compare", "text views compare in code point order, whatever their encodings") {
+	std::vector<std::basic_string<ztd::uchar8_t>> u8_words;
+	std::vector<std::u16string> u16_words;
+	for (std::u32string_view word : sorted_words) {
+		u8_words.push_back(ztd::text::transcode(word, ztd::text::utf32, ztd::text::utf8));
+		u16_words.push_back(ztd::text::transcode(word, ztd::text::utf32, ztd::text::utf16));
+	}
+	const std::size_t word_count = u8_words.size();
+	for (std::size_t left_index = 0; left_index < word_count; ++left_index) {
+		const ztd::text::u8text_view u8_left(u8_words[left_index]);
+		const ztd::text::u16text_view u16_left(u16_words[left_index]);
+		const ztd::text::u32text_view u32_left(sorted_words[left_index]);
+		for (std::size_t right_index = 0; right_index < word_count; ++right_index) {
+			const ztd::text::u8text_view u8_right(u8_words[right_index]);
+			const ztd::text::u16text_view u16_right(u16_words[right_index]);
+			const ztd::text::u32text_view u32_right(sorted_words[right_index]);
+			SECTION("same encoding") {
+				check_compare(u8_left, u8_right, left_index, right_index);
+				check_compare(u16_left, u16_right, left_index, right_index);
+				check_compare(u32_left, u32_right, left_index, right_index);
+			}
+			SECTION("mixed encodings") {
+				check_compare(u8_left, u16_right, left_index, right_index);
+				check_compare(u16_left, u8_right, left_index, right_index);
+				check_compare(u8_left, u32_right, left_index, right_index);
+				check_compare(u32_left, u16_right, left_index, right_index);
+			}
+		}
+	}
+	SECTION("long mixed text") {
+		std::u32string long_word;
+		for (std::size_t i = 0; i < 300; ++i) {
+			long_word += sorted_words[i % word_count];
+		}
+		std::basic_string<ztd::uchar8_t> u8_long = ztd::text::transcode(long_word, ztd::text::utf32, ztd::text::utf8);
+		std::u16string u16_long = ztd::text::transcode(long_word, ztd::text::utf32, ztd::text::utf16);
+		REQUIRE(ztd::text::u8text_view(u8_long) == ztd::text::u16text_view(u16_long));
+		u16_long.back() = u'z';
+		REQUIRE(ztd::text::u8text_view(u8_long) != ztd::text::u16text_view(u16_long));
+		REQUIRE(ztd::text::u8text_view(u8_long) < ztd::text::u16text_view(u16_long));
+	}
+	SECTION("map keys") {
+		std::map<ztd::text::u8text_view, std::size_t> seen;
+		for (std::size_t i = 0; i < word_count * 3; ++i) {
+			seen[ztd::text::u8text_view(u8_words[(i * 7) % word_count])] += 1;
+		}
+		REQUIRE(seen.size() == word_count);
+		std::size_t index = 0;
+		for (const auto& entry : seen) {
+			REQUIRE(entry.first == ztd::text::u8text_view(u8_words[index]));
+			REQUIRE(entry.second == 3);
+			++index;
+		}
+	}
+}
+
+TEST_CASE("text/text_view/compare/errors", "broken text compares as if it was replaced, whatever the handler") {
+	using u8_view          = std::basic_string_view<ztd::uchar8_t>;
+	using passing_u8_view  = ztd::text::basic_text_view<ztd::text::utf8_t, ztd::text::nfkc, u8_view,
+	     ztd::text::pass_handler_t>;
+	using passing_u16_view = ztd::text::basic_text_view<ztd::text::utf16_t, ztd::text::nfkc, std::u16string_view,
+	     ztd::text::pass_handler_t>;
+
+	const ztd::uchar8_t broken_u8_storage[]   = { static_cast<ztd::uchar8_t>('a'), static_cast<ztd::uchar8_t>(0xFF),
+		static_cast<ztd::uchar8_t>('b') };
+	const char16_t broken_u16_storage[]       = { u'a', static_cast<char16_t>(0xD800), u'b' };
+	const ztd::uchar8_t replaced_u8_storage[] = { static_cast<ztd::uchar8_t>('a'), static_cast<ztd::uchar8_t>(0xEF),
+		static_cast<ztd::uchar8_t>(0xBF), static_cast<ztd::uchar8_t>(0xBD), static_cast<ztd::uchar8_t>('b') };
+	const passing_u8_view broken_u8(u8_view(broken_u8_storage, 3));
+	const passing_u16_view broken_u16(std::u16string_view(broken_u16_storage, 3));
+	const passing_u8_view replaced_u8(u8_view(replaced_u8_storage, 5));
+	const passing_u16_view replaced_u16(std::u16string_view(u"a\uFFFDb"));
+	const passing_u16_view cut_off_u16(std::u16string_view(u"a"));
+	const passing_u16_view after_u16(std::u16string_view(u"a\uFFFEb"));
+	const ztd::uchar8_t after_u8_storage[] = { static_cast<ztd::uchar8_t>('a'), static_cast<ztd::uchar8_t>(0xEF),
+		static_cast<ztd::uchar8_t>(0xBF), static_cast<ztd::uchar8_t>(0xBE), static_cast<ztd::uchar8_t>('b') };
+	const passing_u8_view after_u8(u8_view(after_u8_storage, 5));
+
+	REQUIRE(broken_u8 == replaced_u16);
+	REQUIRE(replaced_u16 == broken_u8);
+	REQUIRE(broken_u16 == replaced_u8);
+	REQUIRE(replaced_u8 == broken_u16);
+	REQUIRE(broken_u8 != cut_off_u16);
+	REQUIRE(cut_off_u16 < broken_u8);
+	REQUIRE(broken_u8 < after_u16);
+	REQUIRE(after_u16 > broken_u8);
+
+	// the same encoding on both sides still has to agree with the above
+	REQUIRE(broken_u8 == replaced_u8);
+	REQUIRE(replaced_u8 == broken_u8);
+	REQUIRE_FALSE(broken_u8 < replaced_u8);
+	REQUIRE_FALSE(replaced_u8 < broken_u8);
+	REQUIRE(broken_u8 < after_u8);
+	REQUIRE(after_u8 > broken_u8);
+	REQUIRE(broken_u16 == replaced_u16);
+	REQUIRE_FALSE(broken_u16 < replaced_u16);
+	REQUIRE_FALSE(replaced_u16 < broken_u16);
+}
+
+TEST_CASE("text/text/compare", "texts compare in code point order, whatever their encodings") {
+	const ztd::text::u8text u8_left(std::u32string_view(U"\uFF21"));
+	const ztd::text::u16text u16_left(std::u32string_view(U"\uFF21"));
+	const ztd::text::u8text u8_right(std::u32string_view(U"\U0001F600"));
+	const ztd::text::u16text u16_right(std::u32string_view(U"\U0001F600"));
+	check_compare(u8_left, u8_left, 0, 0);
+	check_compare(u8_left, u16_left, 0, 0);
+	check_compare(u16_left, u16_right, 0, 1);
+	check_compare(u8_left, u16_right, 0, 1);
+	check_compare(u16_right, u8_left, 1, 0);
+}
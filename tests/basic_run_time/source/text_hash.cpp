@@ -0,0 +1,140 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/text_view.hpp>
+#include <ztd/text/text.hpp>
+#include <ztd/text/transcode.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+	const std::u32string_view words[] = {
+		U"",
+		U"a",
+		U"abcdefgh",
+		U"abcdefghi",
+		U"\u00E9",
+		U"\uFF21",
+		U"\U0001F600",
+		U"a\U0001F600b\u00E9c\uFF21d",
+	};
+
+	template <typename View>
+	std::size_t hash_of(const View& view) {
+		return std::hash<View> {}(view);
+	}
+} // namespace
+
+TEST_CASE("text/text_view/hash", "text views holding the same code points hash the same, whatever their encodings") {
+	std::vector<std::u32string> u32_words;
+	for (std::u32string_view word : words) {
+		u32_words.emplace_back(word);
+	}
+	// long enough to go through several blocks on the way into the hash
+	std::u32string long_word;
+	for (std::size_t i = 0; i < 300; ++i) {
+		long_word += words[i % std::size(words)];
+	}
+	u32_words.push_back(long_word);
+
+	std::vector<std::size_t> hashes;
+	for (const std::u32string& word : u32_words) {
+		const std::basic_string<ztd::uchar8_t> u8_word
+		     = ztd::text::transcode(word, ztd::text::utf32, ztd::text::utf8);
+		const std::u16string u16_word = ztd::text::transcode(word, ztd::text::utf32, ztd::text::utf16);
+		const std::size_t u8_hash     = hash_of(ztd::text::u8text_view(u8_word));
+		REQUIRE(hash_of(ztd::text::u16text_view(u16_word)) == u8_hash);
+		REQUIRE(hash_of(ztd::text::u32text_view(word)) == u8_hash);
+		hashes.push_back(u8_hash);
+	}
+	const std::unordered_set<std::size_t> unique_hashes(hashes.begin(), hashes.end());
+	REQUIRE(unique_hashes.size() == hashes.size());
+
+	SECTION("unordered keys") {
+		std::vector<std::basic_string<ztd::uchar8_t>> u8_words;
+		for (const std::u32string& word : u32_words) {
+			u8_words.push_back(ztd::text::transcode(word, ztd::text::utf32, ztd::text::utf8));
+		}
+		std::unordered_set<ztd::text::u8text_view> seen;
+		for (std::size_t i = 0; i < u8_words.size() * 3; ++i) {
+			seen.insert(ztd::text::u8text_view(u8_words[(i * 5) % u8_words.size()]));
+		}
+		REQUIRE(seen.size() == u8_words.size());
+	}
+}
+
+TEST_CASE("text/text_view/hash/errors", "broken text hashes as if it was replaced, whatever the encoding") {
+	using u8_view          = std::basic_string_view<ztd::uchar8_t>;
+	using passing_u8_view  = ztd::text::basic_text_view<ztd::text::utf8_t, ztd::text::nfkc, u8_view,
+	     ztd::text::pass_handler_t>;
+	using passing_u16_view = ztd::text::basic_text_view<ztd::text::utf16_t, ztd::text::nfkc, std::u16string_view,
+	     ztd::text::pass_handler_t>;
+
+	// two bad code units, with a well-formed run between them long enough for a whole word of the hash
+	const ztd::uchar8_t broken_u8_storage[]        = { static_cast<ztd::uchar8_t>('a'),
+		static_cast<ztd::uchar8_t>(0xFF), static_cast<ztd::uchar8_t>('b'), static_cast<ztd::uchar8_t>('c'),
+		static_cast<ztd::uchar8_t>('d'), static_cast<ztd::uchar8_t>('e'), static_cast<ztd::uchar8_t>('f'),
+		static_cast<ztd::uchar8_t>('g'), static_cast<ztd::uchar8_t>('h'), static_cast<ztd::uchar8_t>('i'),
+		static_cast<ztd::uchar8_t>(0xFF), static_cast<ztd::uchar8_t>('j') };
+	const char16_t broken_u16_storage[]            = { u'a', static_cast<char16_t>(0xD800), u'b', u'c', u'd', u'e',
+		u'f', u'g', u'h', u'i', static_cast<char16_t>(0xD800), u'j' };
+	const std::u16string_view replaced_u16_storage = u"a\uFFFDbcdefghi\uFFFDj";
+	const std::basic_string<ztd::uchar8_t> replaced_u8_storage
+	     = ztd::text::transcode(replaced_u16_storage, ztd::text::utf16, ztd::text::utf8);
+	const passing_u8_view broken_u8(u8_view(broken_u8_storage, std::size(broken_u8_storage)));
+	const passing_u16_view broken_u16(std::u16string_view(broken_u16_storage, std::size(broken_u16_storage)));
+	const passing_u8_view replaced_u8(u8_view(replaced_u8_storage));
+	const passing_u16_view replaced_u16(replaced_u16_storage);
+
+	REQUIRE(broken_u8 == replaced_u16);
+	REQUIRE(broken_u8 == replaced_u8);
+	REQUIRE(broken_u16 == replaced_u8);
+	const std::size_t replaced_hash = hash_of(replaced_u16);
+	REQUIRE(hash_of(broken_u8) == replaced_hash);
+	REQUIRE(hash_of(replaced_u8) == replaced_hash);
+	REQUIRE(hash_of(broken_u16) == replaced_hash);
+}
+
+TEST_CASE("text/text/hash", "texts hash the same as views over the same code points") {
+	const std::u32string_view word = U"a\U0001F600b\u00E9c\uFF21d";
+	const ztd::text::u8text u8_word(word);
+	const ztd::text::u16text u16_word(word);
+	const std::size_t view_hash = hash_of(ztd::text::u32text_view(word));
+	REQUIRE(hash_of(u8_word) == view_hash);
+	REQUIRE(hash_of(u16_word) == view_hash);
+}
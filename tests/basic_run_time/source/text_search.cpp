@@ -0,0 +1,246 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/text_view.hpp>
+#include <ztd/text/transcode.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+	std::basic_string<ztd::uchar8_t> to_utf8(std::u32string_view input) {
+		return ztd::text::transcode(input, ztd::text::utf32, ztd::text::utf8);
+	}
+
+	template <typename View>
+	std::vector<std::u32string> split_pieces(const View& pieces) {
+		std::vector<std::u32string> result;
+		for (const auto& piece : pieces) {
+			result.push_back(ztd::text::transcode(piece.base(), ztd::text::utf8, ztd::text::utf32));
+		}
+		return result;
+	}
+
+	template <typename View, typename Iterator>
+	std::size_t offset_of(const View& view, Iterator position) {
+		return static_cast<std::size_t>(position - view.base().begin());
+	}
+
+	template <typename View>
+	std::vector<std::u32string> decoded_pieces(const View& pieces) {
+		std::vector<std::u32string> result;
+		for (const auto& piece : pieces) {
+			std::u32string code_points;
+			for (char32_t code_point : piece.code_points()) {
+				code_points.push_back(code_point);
+			}
+			result.push_back(std::move(code_points));
+		}
+		return result;
+	}
+
+	// A small encoding with a shift state: after 0x0E, the printable ASCII bytes stand for the fullwidth forms
+	// U+FF01-U+FF5E, until 0x0F shifts back. The same byte is a different code point depending on the state.
+	struct shifted_fullwidth {
+		using code_unit  = char;
+		using code_point = char32_t;
+		struct state {
+			bool shifted = false;
+		};
+		static constexpr std::size_t max_code_units  = 2;
+		static constexpr std::size_t max_code_points = 1;
+
+		template <typename Input, typename Output, typename ErrorHandler>
+		constexpr auto decode_one(Input&& input, Output&& output, ErrorHandler&& error_handler, state& s) const {
+			using UInput  = ztd::remove_cvref_t<Input>;
+			using UOutput = ztd::remove_cvref_t<Output>;
+			using Result  = ztd::text::decode_result<ztd::ranges::range_reconstruct_t<UInput>,
+			     ztd::ranges::range_reconstruct_t<UOutput>, state>;
+			auto in_it    = ztd::ranges::ranges_adl::adl_begin(input);
+			auto in_last  = ztd::ranges::ranges_adl::adl_end(input);
+			auto out_it   = ztd::ranges::ranges_adl::adl_begin(output);
+			auto out_last = ztd::ranges::ranges_adl::adl_end(output);
+			for (; in_it != in_last && (*in_it == '\x0E' || *in_it == '\x0F'); ++in_it) {
+				s.shifted = *in_it == '\x0E';
+			}
+			if (in_it == in_last) {
+				return Result(ztd::ranges::reconstruct(std::in_place_type<UInput>, in_it, in_last),
+				     ztd::ranges::reconstruct(std::in_place_type<UOutput>, out_it, out_last), s);
+			}
+			const unsigned char unit = static_cast<unsigned char>(*in_it);
+			++in_it;
+			if (unit >= 0x80 || (s.shifted && (unit < 0x21 || unit > 0x7E))) {
+				return error_handler(*this,
+				     Result(ztd::ranges::reconstruct(std::in_place_type<UInput>, in_it, in_last),
+				          ztd::ranges::reconstruct(std::in_place_type<UOutput>, out_it, out_last), s,
+				          ztd::text::encoding_error::invalid_sequence),
+				     ztd::span<const code_unit>(), ztd::span<const code_point>());
+			}
+			*out_it = s.shifted ? static_cast<char32_t>(0xFF01 + (unit - 0x21)) : static_cast<char32_t>(unit);
+			++out_it;
+			return Result(ztd::ranges::reconstruct(std::in_place_type<UInput>, in_it, in_last),
+			     ztd::ranges::reconstruct(std::in_place_type<UOutput>, out_it, out_last), s);
+		}
+
+		template <typename Input, typename Output, typename ErrorHandler>
+		constexpr auto encode_one(Input&& input, Output&& output, ErrorHandler&& error_handler, state& s) const {
+			using UInput  = ztd::remove_cvref_t<Input>;
+			using UOutput = ztd::remove_cvref_t<Output>;
+			using Result  = ztd::text::encode_result<ztd::ranges::range_reconstruct_t<UInput>,
+			     ztd::ranges::range_reconstruct_t<UOutput>, state>;
+			auto in_it    = ztd::ranges::ranges_adl::adl_begin(input);
+			auto in_last  = ztd::ranges::ranges_adl::adl_end(input);
+			auto out_it   = ztd::ranges::ranges_adl::adl_begin(output);
+			auto out_last = ztd::ranges::ranges_adl::adl_end(output);
+			if (in_it == in_last) {
+				return Result(ztd::ranges::reconstruct(std::in_place_type<UInput>, in_it, in_last),
+				     ztd::ranges::reconstruct(std::in_place_type<UOutput>, out_it, out_last), s);
+			}
+			const char32_t point = *in_it;
+			++in_it;
+			const bool plain     = point < 0x80 && point != 0x0E && point != 0x0F;
+			const bool fullwidth = point >= 0xFF01 && point <= 0xFF5E;
+			if (!plain && !fullwidth) {
+				return error_handler(*this,
+				     Result(ztd::ranges::reconstruct(std::in_place_type<UInput>, in_it, in_last),
+				          ztd::ranges::reconstruct(std::in_place_type<UOutput>, out_it, out_last), s,
+				          ztd::text::encoding_error::invalid_sequence),
+				     ztd::span<const code_point>(), ztd::span<const code_unit>());
+			}
+			if (s.shifted != fullwidth) {
+				s.shifted = fullwidth;
+				*out_it   = fullwidth ? '\x0E' : '\x0F';
+				++out_it;
+			}
+			*out_it = static_cast<char>(fullwidth ? point - 0xFF01 + 0x21 : point);
+			++out_it;
+			return Result(ztd::ranges::reconstruct(std::in_place_type<UInput>, in_it, in_last),
+			     ztd::ranges::reconstruct(std::in_place_type<UOutput>, out_it, out_last), s);
+		}
+	};
+
+	using shifted_text_view
+	     = ztd::text::basic_text_view<shifted_fullwidth, ztd::text::nfkc, std::string_view, ztd::text::pass_handler_t>;
+} // namespace
+
+TEST_CASE("text/text_view/find", "text views find code points and text in encoded form") {
+	SECTION("utf8") {
+		const std::basic_string<ztd::uchar8_t> storage = to_utf8(U"a\U0001F600b,\u00E9,\U0001F600c");
+		const ztd::text::u8text_view view(storage);
+		REQUIRE(offset_of(view, view.find(U'a')) == 0);
+		REQUIRE(offset_of(view, view.find(U'\U0001F600')) == 1);
+		REQUIRE(offset_of(view, view.rfind(U'\U0001F600')) == 10);
+		REQUIRE(offset_of(view, view.find(U',')) == 6);
+		REQUIRE(offset_of(view, view.rfind(U',')) == 9);
+		REQUIRE(offset_of(view, view.find(U'\u00E9')) == 7);
+		REQUIRE(view.find(U'z') == view.base().end());
+		REQUIRE(view.rfind(U'z') == view.base().end());
+		REQUIRE(view.contains(U'\u00E9'));
+		REQUIRE_FALSE(view.contains(U'\u00E8'));
+
+		const std::basic_string<ztd::uchar8_t> needle_storage = to_utf8(U",\U0001F600");
+		const ztd::text::u8text_view needle(needle_storage);
+		REQUIRE(offset_of(view, view.find(needle)) == 9);
+		REQUIRE(offset_of(view, view.rfind(needle)) == 9);
+		REQUIRE(view.contains(needle));
+		REQUIRE_FALSE(needle.contains(view));
+		REQUIRE(offset_of(view, view.find(ztd::text::u8text_view())) == 0);
+		REQUIRE(offset_of(view, view.rfind(ztd::text::u8text_view())) == storage.size());
+	}
+	SECTION("utf16") {
+		const std::u16string storage = u"x\U0001F600y\U0001F600";
+		const ztd::text::u16text_view view(storage);
+		REQUIRE(offset_of(view, view.find(U'\U0001F600')) == 1);
+		REQUIRE(offset_of(view, view.rfind(U'\U0001F600')) == 4);
+		REQUIRE(offset_of(view, view.find(U'y')) == 3);
+		REQUIRE_FALSE(view.contains(U'\U0001F601'));
+	}
+	SECTION("not representable") {
+		const std::string storage = "plain ascii";
+		const ztd::text::basic_text_view<ztd::text::ascii_t> view(storage);
+		REQUIRE(offset_of(view, view.find(U' ')) == 5);
+		REQUIRE(view.find(U'\u00E9') == view.base().end());
+		REQUIRE_FALSE(view.contains(U'\u00E9'));
+	}
+	SECTION("shift state") {
+		// x, then U+FF21 U+FF22 shifted, then B: the second 'B' byte is U+FF22, and only the last one is U'B'
+		const std::string storage = "x\x0E" "AB\x0F" "B";
+		const shifted_text_view view(storage);
+		REQUIRE(offset_of(view, view.find(U'B')) == 4);
+		REQUIRE(offset_of(view, view.rfind(U'B')) == 4);
+		REQUIRE(offset_of(view, view.find(U'\uFF22')) == 3);
+		REQUIRE(view.contains(U'\uFF21'));
+		REQUIRE_FALSE(view.contains(U'A'));
+
+		const std::string needle_storage = "\x0E" "B\x0F" "B";
+		REQUIRE(offset_of(view, view.find(shifted_text_view(needle_storage))) == 3);
+		REQUIRE_FALSE(view.contains(shifted_text_view(std::string_view("\x0E" "A\x0F" "B"))));
+	}
+}
+
+TEST_CASE("text/text_view/split", "text views split lazily on a code point or on text") {
+	SECTION("code point") {
+		const std::basic_string<ztd::uchar8_t> storage = to_utf8(U"a,b\u00E9,,\U0001F600");
+		const ztd::text::u8text_view view(storage);
+		const std::vector<std::u32string> expected { U"a", U"b\u00E9", U"", U"\U0001F600" };
+		REQUIRE(split_pieces(view.split(U',')) == expected);
+	}
+	SECTION("edges") {
+		const std::basic_string<ztd::uchar8_t> empty_storage;
+		const std::basic_string<ztd::uchar8_t> trailing_storage = to_utf8(U"a,");
+		const std::vector<std::u32string> only_empty { U"" };
+		const std::vector<std::u32string> trailing { U"a", U"" };
+		const std::vector<std::u32string> whole { U"a," };
+		REQUIRE(split_pieces(ztd::text::u8text_view(empty_storage).split(U',')) == only_empty);
+		REQUIRE(split_pieces(ztd::text::u8text_view(trailing_storage).split(U',')) == trailing);
+		REQUIRE(split_pieces(ztd::text::u8text_view(trailing_storage).split(ztd::text::u8text_view())) == whole);
+	}
+	SECTION("text") {
+		const std::basic_string<ztd::uchar8_t> storage   = to_utf8(U"one\U0001F600, two, \U0001F600, three");
+		const std::basic_string<ztd::uchar8_t> delimiter = to_utf8(U", ");
+		const ztd::text::u8text_view view(storage);
+		const std::vector<std::u32string> expected { U"one\U0001F600", U"two", U"\U0001F600", U"three" };
+		REQUIRE(split_pieces(view.split(ztd::text::u8text_view(delimiter))) == expected);
+	}
+	SECTION("shift state") {
+		// a, U+FF0C, U+FF42, U+FF0C, then an unshifted ",c": each piece starts in the state the text is in there
+		const std::string storage = "a\x0E,b,\x0F,c";
+		const shifted_text_view view(storage);
+		const std::vector<std::u32string> expected { U"a", U"\uFF42", U",c" };
+		REQUIRE(decoded_pieces(view.split(U'\uFF0C')) == expected);
+		const std::vector<std::u32string> unshifted { U"a\uFF0C\uFF42\uFF0C", U"c" };
+		REQUIRE(decoded_pieces(view.split(U',')) == unshifted);
+	}
+}
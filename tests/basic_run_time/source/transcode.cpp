@@ -110,3 +110,123 @@ TEST_CASE("text/transcode/roundtrip", "transcode can roundtrip") {
 		REQUIRE(result1 == ztd::tests::u32_unicode_sequence_truth_native_endian);
 	}
 }
+
+TEST_CASE("text/transcode/wide_execution", "transcoding from UTF-32 wide_execution goes straight to the target") {
+	ztd::text::wide_execution_t encoding {};
+	if (!ztd::text::contains_unicode_encoding(encoding) || sizeof(wchar_t) != sizeof(char32_t)) {
+		return;
+	}
+	SECTION("utf8") {
+		std::basic_string<ztd::uchar8_t> result0 = ztd::text::transcode(
+		     ztd::tests::w_unicode_sequence_truth_native_endian, encoding, ztd::text::utf8, ztd::text::replacement_handler);
+		REQUIRE(result0 == ztd::tests::u8_unicode_sequence_truth_native_endian);
+	}
+	SECTION("utf16") {
+		std::u16string result0 = ztd::text::transcode(ztd::tests::w_unicode_sequence_truth_native_endian, encoding,
+		     ztd::text::utf16, ztd::text::replacement_handler);
+		REQUIRE(result0 == ztd::tests::u16_unicode_sequence_truth_native_endian);
+	}
+	SECTION("utf32") {
+		std::u32string result0 = ztd::text::transcode(ztd::tests::w_unicode_sequence_truth_native_endian, encoding,
+		     ztd::text::utf32, ztd::text::replacement_handler);
+		REQUIRE(result0 == ztd::tests::u32_unicode_sequence_truth_native_endian);
+		std::u32string result1 = ztd::text::transcode(ztd::tests::w_unicode_sequence_truth_native_endian, encoding,
+		     ztd::text::utf32, ztd::text::assume_valid_handler, ztd::text::assume_valid_handler);
+		REQUIRE(result1 == ztd::tests::u32_unicode_sequence_truth_native_endian);
+	}
+	SECTION("bad code units") {
+		std::wstring long_input(5000, L'a');
+		long_input[2500] = static_cast<wchar_t>(0xD800);
+		long_input[4999] = static_cast<wchar_t>(0x110000);
+		const ztd::uchar8_t replacement[] = { 0xEF, 0xBF, 0xBD };
+		std::basic_string<ztd::uchar8_t> long_expected(5000, static_cast<ztd::uchar8_t>('a'));
+		long_expected.replace(4999, 1, replacement, 3);
+		long_expected.replace(2500, 1, replacement, 3);
+		std::basic_string<ztd::uchar8_t> result0 = ztd::text::transcode(long_input, encoding, ztd::text::utf8,
+		     ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result0 == long_expected);
+	}
+}
+
+TEST_CASE("text/transcode/utf bulk", "transcoding between UTF encodings keeps going after a bad sequence") {
+	const ztd::uchar8_t replacement[] = { 0xEF, 0xBF, 0xBD };
+	std::basic_string<ztd::uchar8_t> input(5000, static_cast<ztd::uchar8_t>('a'));
+	input[1000] = static_cast<ztd::uchar8_t>(0xFF);
+	input[3000] = static_cast<ztd::uchar8_t>(0xC3);
+	input[3001] = static_cast<ztd::uchar8_t>(0xA9);
+	input[4999] = static_cast<ztd::uchar8_t>(0xE2);
+	SECTION("utf8 -> utf16") {
+		std::u16string expected(4999, u'a');
+		expected[1000] = u'\xFFFD';
+		expected[3000] = u'\xE9';
+		expected[4998] = u'\xFFFD';
+		std::u16string result
+		     = ztd::text::transcode(input, ztd::text::utf8, ztd::text::utf16, ztd::text::replacement_handler);
+		REQUIRE(result == expected);
+	}
+	SECTION("utf8 -> utf8") {
+		std::basic_string<ztd::uchar8_t> expected = input;
+		expected.replace(4999, 1, replacement, 3);
+		expected.replace(1000, 1, replacement, 3);
+		std::basic_string<ztd::uchar8_t> result
+		     = ztd::text::transcode(input, ztd::text::utf8, ztd::text::utf8, ztd::text::replacement_handler);
+		REQUIRE(result == expected);
+	}
+	SECTION("utf16 -> utf8") {
+		std::u16string utf16_input(3000, u'a');
+		utf16_input[10]   = static_cast<char16_t>(0xDC00);
+		utf16_input[2000] = static_cast<char16_t>(0xD83D);
+		utf16_input[2001] = static_cast<char16_t>(0xDE00);
+		std::basic_string<ztd::uchar8_t> expected(2999, static_cast<ztd::uchar8_t>('a'));
+		const ztd::uchar8_t smiley[] = { 0xF0, 0x9F, 0x98, 0x80 };
+		expected.replace(2000, 1, smiley, 4);
+		expected.replace(10, 1, replacement, 3);
+		std::basic_string<ztd::uchar8_t> result
+		     = ztd::text::transcode(utf16_input, ztd::text::utf16, ztd::text::utf8, ztd::text::replacement_handler);
+		REQUIRE(result == expected);
+	}
+	SECTION("small output") {
+		std::u16string output(10, u'\0');
+		auto result = ztd::text::transcode_into(input, ztd::text::utf8, ztd::span<char16_t>(output), ztd::text::utf16,
+		     ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result.error_code == ztd::text::encoding_error::insufficient_output_space);
+		REQUIRE(result.input.size() == input.size() - 10);
+		REQUIRE(result.output.empty());
+		REQUIRE(output == std::u16string(10, u'a'));
+	}
+}
+
+TEST_CASE("text/transcode/pivot batch",
+     "transcoding through a batch of code points stops at the same place as going one code point at a time") {
+	std::basic_string<ztd::uchar8_t> input(5000, static_cast<ztd::uchar8_t>('a'));
+	input[3000] = static_cast<ztd::uchar8_t>(0xC3);
+	input[3001] = static_cast<ztd::uchar8_t>(0xA9);
+	SECTION("utf8 -> ascii, replaced") {
+		std::basic_string<ztd::uchar8_t> bad_input = input;
+		bad_input[1000] = static_cast<ztd::uchar8_t>(0xFF);
+		std::string expected(4999, 'a');
+		expected[1000] = '?';
+		expected[3000] = '?';
+		std::string result
+		     = ztd::text::transcode(bad_input, ztd::text::utf8, ztd::text::ascii, ztd::text::replacement_handler);
+		REQUIRE(result == expected);
+	}
+	SECTION("utf8 -> ascii, stopped by the encode side") {
+		std::string output(5000, '\0');
+		auto result = ztd::text::transcode_into(input, ztd::text::utf8, ztd::span<char>(output), ztd::text::ascii,
+		     ztd::text::pass_handler, ztd::text::pass_handler);
+		REQUIRE(result.error_code == ztd::text::encoding_error::invalid_sequence);
+		REQUIRE(result.input.size() == input.size() - 3000);
+		REQUIRE(result.output.size() == output.size() - 3000);
+		REQUIRE(output.substr(0, 3000) == std::string(3000, 'a'));
+	}
+	SECTION("utf8 -> ascii, small output") {
+		std::string output(10, '\0');
+		auto result = ztd::text::transcode_into(input, ztd::text::utf8, ztd::span<char>(output), ztd::text::ascii,
+		     ztd::text::pass_handler, ztd::text::pass_handler);
+		REQUIRE(result.error_code == ztd::text::encoding_error::insufficient_output_space);
+		REQUIRE(result.input.size() == input.size() - 10);
+		REQUIRE(result.output.empty());
+		REQUIRE(output == std::string(10, 'a'));
+	}
+}
@@ -0,0 +1,123 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+#include <ztd/text/transcode_batch.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("text/transcode_batch", "many inputs are transcoded into one output with Arrow-style offsets") {
+	// "cat", "", "é!", "eagle"
+	std::basic_string<ztd::uchar8_t> data { static_cast<ztd::uchar8_t>('c'), static_cast<ztd::uchar8_t>('a'),
+	     static_cast<ztd::uchar8_t>('t'), static_cast<ztd::uchar8_t>(0xC3), static_cast<ztd::uchar8_t>(0xA9),
+	     static_cast<ztd::uchar8_t>('!'), static_cast<ztd::uchar8_t>('e'), static_cast<ztd::uchar8_t>('a'),
+	     static_cast<ztd::uchar8_t>('g'), static_cast<ztd::uchar8_t>('l'), static_cast<ztd::uchar8_t>('e') };
+	std::vector<std::uint32_t> offsets { 0, 3, 3, 6, 11 };
+
+	SECTION("basic") {
+		auto result = ztd::text::transcode_batch(offsets, data, ztd::text::utf8, ztd::text::utf16);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.error_index == 4);
+		REQUIRE_FALSE(result.errors_were_handled());
+		REQUIRE(result.output == u"cat\xE9!eagle");
+		REQUIRE(result.output_offsets == std::vector<std::uint32_t> { 0, 3, 3, 5, 10 });
+	}
+	SECTION("into existing containers") {
+		std::u32string output = U">";
+		std::vector<std::size_t> output_offsets {};
+		auto result = ztd::text::transcode_batch_into_container(
+		     offsets, data, ztd::text::utf8, output, output_offsets, ztd::text::utf32);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(&result.output.get() == &output);
+		REQUIRE(output == U">cat\xE9!eagle");
+		REQUIRE(output_offsets == std::vector<std::size_t> { 1, 4, 4, 6, 11 });
+	}
+	SECTION("errors are reported per input") {
+		std::basic_string<ztd::uchar8_t> bad_data = data;
+		bad_data[4] = static_cast<ztd::uchar8_t>('x'); // breaks the "é" in the input at index 2
+		auto replaced = ztd::text::transcode_batch(
+		     offsets, bad_data, ztd::text::utf8, ztd::text::utf16, ztd::text::replacement_handler);
+		REQUIRE(replaced.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(replaced.error_index == 4);
+		REQUIRE(replaced.handled_errors == 1);
+		REQUIRE(replaced.output == u"cat\xFFFDx!eagle");
+		REQUIRE(replaced.output_offsets == std::vector<std::uint32_t> { 0, 3, 3, 6, 11 });
+
+		// a failed input gets an empty output range, and the rest of the batch carries on
+		auto skipped = ztd::text::transcode_batch(
+		     offsets, bad_data, ztd::text::utf8, ztd::text::utf16, ztd::text::pass_handler);
+		REQUIRE(skipped.error_code == ztd::text::encoding_error::invalid_sequence);
+		REQUIRE(skipped.error_index == 2);
+		REQUIRE(skipped.output == u"cateagle");
+		REQUIRE(skipped.output_offsets == std::vector<std::uint32_t> { 0, 3, 3, 3, 8 });
+	}
+	SECTION("outcomes are recorded per input") {
+		// breaks the "é" in the input at index 2, and the "g" in the input at index 3
+		std::basic_string<ztd::uchar8_t> bad_data = data;
+		bad_data[4] = static_cast<ztd::uchar8_t>('x');
+		bad_data[8] = static_cast<ztd::uchar8_t>(0xFF);
+
+		std::vector<ztd::text::transcode_batch_outcome> outcomes {};
+		auto skipped = ztd::text::transcode_batch(offsets, bad_data, ztd::text::utf8, ztd::text::utf16,
+		     ztd::text::pass_handler, ztd::text::pass_handler, outcomes);
+		REQUIRE(skipped.error_code == ztd::text::encoding_error::invalid_sequence);
+		REQUIRE(skipped.error_index == 2);
+		REQUIRE(skipped.output == u"cat");
+		REQUIRE(skipped.output_offsets == std::vector<std::uint32_t> { 0, 3, 3, 3, 3 });
+		REQUIRE(outcomes.size() == 4);
+		REQUIRE(outcomes[0].error_code == ztd::text::encoding_error::ok);
+		REQUIRE(outcomes[1].error_code == ztd::text::encoding_error::ok);
+		REQUIRE(outcomes[2].error_code == ztd::text::encoding_error::invalid_sequence);
+		REQUIRE(outcomes[3].error_code == ztd::text::encoding_error::invalid_sequence);
+
+		std::u32string output = U">";
+		std::vector<std::size_t> output_offsets {};
+		outcomes.clear();
+		auto replaced = ztd::text::transcode_batch_into_container(offsets, bad_data, ztd::text::utf8, output,
+		     output_offsets, ztd::text::utf32, ztd::text::replacement_handler, ztd::text::replacement_handler,
+		     outcomes);
+		REQUIRE(replaced.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(replaced.error_index == 4);
+		REQUIRE(replaced.handled_errors == 2);
+		REQUIRE(output == U">cat\uFFFDx!ea\uFFFDle");
+		REQUIRE(output_offsets == std::vector<std::size_t> { 1, 4, 4, 7, 12 });
+		REQUIRE(outcomes.size() == 4);
+		REQUIRE_FALSE(outcomes[0].errors_were_handled());
+		REQUIRE_FALSE(outcomes[1].errors_were_handled());
+		REQUIRE(outcomes[2].error_code == ztd::text::encoding_error::ok);
+		REQUIRE(outcomes[2].handled_errors == 1);
+		REQUIRE(outcomes[3].error_code == ztd::text::encoding_error::ok);
+		REQUIRE(outcomes[3].handled_errors == 1);
+	}
+}
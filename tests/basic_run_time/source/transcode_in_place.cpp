@@ -0,0 +1,136 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/transcode_in_place.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+inline namespace ztd_text_tests_basic_run_time_transcode_in_place {
+	template <typename String>
+	ztd::span<std::byte> as_buffer(String& str) {
+		return ztd::span<std::byte>(
+		     reinterpret_cast<std::byte*>(&str[0]), str.size() * sizeof(typename String::value_type));
+	}
+
+	template <typename String, typename Result>
+	bool written_equals(const ztd::span<std::byte>& buffer, const Result& result, const String& expected) {
+		const std::size_t written = buffer.size() - result.output.size();
+		return written == expected.size() * sizeof(typename String::value_type)
+		     && std::memcmp(buffer.data(), expected.data(), written) == 0;
+	}
+} // namespace ztd_text_tests_basic_run_time_transcode_in_place
+
+TEST_CASE("text/transcode_in_place/basic", "transcode_in_place writes the output over the input") {
+	const std::u32string_view code_points = U"a\u00E9\u4E2D\U0001F600";
+	SECTION("utf32 to utf8") {
+		std::u32string input = std::u32string(code_points);
+		const std::basic_string<ztd::uchar8_t> expected
+		     = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf8);
+		ztd::span<std::byte> buffer = as_buffer(input);
+		auto result                 = ztd::text::transcode_in_place(buffer, ztd::text::utf32, ztd::text::utf8);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.input.empty());
+		REQUIRE(written_equals(buffer, result, expected));
+	}
+	SECTION("utf32 to utf16") {
+		std::u32string input          = std::u32string(code_points);
+		const std::u16string expected = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf16);
+		ztd::span<std::byte> buffer   = as_buffer(input);
+		auto result                   = ztd::text::transcode_in_place(buffer, ztd::text::utf32, ztd::text::utf16);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(written_equals(buffer, result, expected));
+	}
+	SECTION("utf16 to utf8") {
+		std::u32string mostly_ascii;
+		for (int i = 0; i < 50; ++i) {
+			mostly_ascii += U"text \u4E2D\u00E9 ";
+		}
+		std::u16string input = ztd::text::transcode(mostly_ascii, ztd::text::utf32, ztd::text::utf16);
+		const std::basic_string<ztd::uchar8_t> expected
+		     = ztd::text::transcode(mostly_ascii, ztd::text::utf32, ztd::text::utf8);
+		ztd::span<std::byte> buffer = as_buffer(input);
+		auto result                 = ztd::text::transcode_in_place(buffer, ztd::text::utf16, ztd::text::utf8);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(written_equals(buffer, result, expected));
+	}
+	SECTION("utf16 to utf8 with the output running ahead of the input") {
+		// each U+0800-U+FFFF code point is 2 bytes in and 3 bytes out: the spill holds on to the output that gets
+		// ahead of the read position until the ASCII after it lets the output catch up
+		for (std::size_t lead : { std::size_t(10), std::size_t(256) }) {
+			std::u32string code_points(lead, U'\u4E2D');
+			code_points.append(lead + 40, U'a');
+			code_points += U"\u00E9\u4E2D\U0001F600";
+			std::u16string input = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf16);
+			const std::basic_string<ztd::uchar8_t> expected
+			     = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf8);
+			ztd::span<std::byte> buffer = as_buffer(input);
+			auto result                 = ztd::text::transcode_in_place(buffer, ztd::text::utf16, ztd::text::utf8);
+			REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+			REQUIRE(result.input.empty());
+			REQUIRE(written_equals(buffer, result, expected));
+		}
+	}
+	SECTION("utf16 to utf8 with the output running too far ahead of the input") {
+		// one more leading code point than the 256-byte spill can make up for
+		std::u32string code_points(257, U'\u4E2D');
+		code_points.append(400, U'a');
+		std::u16string input          = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf16);
+		const std::u16string original = input;
+		ztd::span<std::byte> buffer   = as_buffer(input);
+		auto result                   = ztd::text::transcode_in_place(buffer, ztd::text::utf16, ztd::text::utf8);
+		REQUIRE(result.error_code == ztd::text::encoding_error::insufficient_output_space);
+		REQUIRE(result.output.size() == buffer.size());
+		REQUIRE(input == original);
+	}
+	SECTION("utf16 to utf8 that does not fit") {
+		std::u16string input(1000, u'\u4E2D');
+		const std::u16string original = input;
+		ztd::span<std::byte> buffer   = as_buffer(input);
+		auto result                   = ztd::text::transcode_in_place(buffer, ztd::text::utf16, ztd::text::utf8);
+		REQUIRE(result.error_code == ztd::text::encoding_error::insufficient_output_space);
+		REQUIRE(result.output.size() == buffer.size());
+		REQUIRE(input == original);
+	}
+	SECTION("invalid") {
+		std::u32string input        = U"abc";
+		input[1]                    = static_cast<char32_t>(0xD800);
+		ztd::span<std::byte> buffer = as_buffer(input);
+		auto result                 = ztd::text::transcode_in_place(buffer, ztd::text::utf32, ztd::text::utf8);
+		REQUIRE(result.error_code == ztd::text::encoding_error::invalid_sequence);
+		REQUIRE(result.input.size() == 8);
+		REQUIRE(buffer.size() - result.output.size() == 1);
+	}
+}
@@ -0,0 +1,112 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/transcode_or_borrow.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+TEST_CASE("text/transcode_or_borrow/basic", "transcode_or_borrow only allocates when the input is not valid as-is") {
+	SECTION("utf8 variants") {
+		const std::string input = "caf\xC3\xA9 \xE4\xB8\xAD";
+		auto result             = ztd::text::transcode_or_borrow(input, ztd::text::compat_utf8, ztd::text::utf8);
+		REQUIRE(result.is_borrowed());
+		REQUIRE(static_cast<const void*>(result.data()) == static_cast<const void*>(input.data()));
+		REQUIRE(result.size() == input.size());
+
+		// char8_t may not look at the chars of the input, so then the result keeps the input's code unit type
+		using code_unit = typename decltype(result)::value_type;
+		if constexpr (std::is_same_v<ztd::uchar8_t, unsigned char>) {
+			REQUIRE(std::is_same_v<code_unit, unsigned char>);
+		}
+		else {
+			REQUIRE(std::is_same_v<code_unit, char>);
+		}
+		std::basic_string<code_unit> copy = std::move(result).to_container();
+		REQUIRE(copy.size() == input.size());
+		REQUIRE(std::equal(copy.begin(), copy.end(), input.begin(), input.end(),
+		     [](code_unit l, char r) { return static_cast<unsigned char>(l) == static_cast<unsigned char>(r); }));
+	}
+	SECTION("the target code unit type is used when it can view the input") {
+		const std::basic_string<ztd::uchar8_t> input(3, static_cast<ztd::uchar8_t>('a'));
+		auto result = ztd::text::transcode_or_borrow(input, ztd::text::utf8, ztd::text::compat_utf8);
+		REQUIRE(result.is_borrowed());
+		REQUIRE(std::is_same_v<typename decltype(result)::value_type, char>);
+		REQUIRE(static_cast<const void*>(result.data()) == static_cast<const void*>(input.data()));
+		REQUIRE(result.size() == 3);
+	}
+	SECTION("ascii to utf8") {
+		std::string_view input = "abc";
+		auto result            = ztd::text::transcode_or_borrow(input, ztd::text::ascii, ztd::text::utf8);
+		REQUIRE(result.is_borrowed());
+		REQUIRE(result.size() == 3);
+	}
+	SECTION("same encoding") {
+		const std::u16string input = u"a\u00E9\U0001F600";
+		auto result                = ztd::text::transcode_or_borrow(input, ztd::text::utf16, ztd::text::utf16);
+		REQUIRE(result.is_borrowed());
+		REQUIRE(result.data() == input.data());
+	}
+	SECTION("invalid input is transcoded") {
+		const std::string input = "ab\xFF" "cd";
+		auto result             = ztd::text::transcode_or_borrow(
+		     input, ztd::text::compat_utf8, ztd::text::utf8, ztd::text::replacement_handler);
+		REQUIRE_FALSE(result.is_borrowed());
+		REQUIRE(result.size() == 7);
+		REQUIRE(static_cast<unsigned char>(result.data()[2]) == 0xEF);
+		REQUIRE(static_cast<unsigned char>(result.data()[3]) == 0xBF);
+		REQUIRE(static_cast<unsigned char>(result.data()[4]) == 0xBD);
+	}
+	SECTION("assumed valid input is not checked") {
+		const std::string input = "ab\xFF" "cd";
+		auto result             = ztd::text::transcode_or_borrow(
+		     input, ztd::text::compat_utf8, ztd::text::utf8, ztd::text::assume_valid_handler);
+		REQUIRE(result.is_borrowed());
+		REQUIRE(result.size() == input.size());
+	}
+	SECTION("incompatible encodings") {
+		const std::string input = "caf\xC3\xA9";
+		auto result             = ztd::text::transcode_or_borrow(input, ztd::text::compat_utf8, ztd::text::utf16);
+		REQUIRE_FALSE(result.is_borrowed());
+		const std::u16string expected = u"caf\u00E9";
+		REQUIRE(std::u16string(result.begin(), result.end()) == expected);
+	}
+	SECTION("temporaries are not borrowed") {
+		auto result = ztd::text::transcode_or_borrow(std::string("abc"), ztd::text::compat_utf8, ztd::text::utf8);
+		REQUIRE_FALSE(result.is_borrowed());
+		REQUIRE(result.size() == 3);
+	}
+}
@@ -0,0 +1,101 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/truncate_to_fit.hpp>
+#include <ztd/text/count_as_transcoded.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+TEST_CASE("text/truncate_to_fit/basic", "truncate_to_fit finds the longest prefix that fits without splitting") {
+	const std::u32string_view code_points = U"a\u00E9\u4E2D\U0001F600b";
+	const std::basic_string<ztd::uchar8_t> u8_input
+	     = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf8);
+	const std::u16string u16_input = ztd::text::transcode(code_points, ztd::text::utf32, ztd::text::utf16);
+	SECTION("utf8 to utf16") {
+		// the surrogate pair for the emoji does not fit in the 4th unit
+		auto cut = ztd::text::truncate_to_fit(u8_input, ztd::text::utf8, ztd::text::utf16, 4);
+		REQUIRE(cut.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(cut.count == 3);
+		REQUIRE(cut.input.size() == 5);
+
+		auto fits = ztd::text::truncate_to_fit(u8_input, ztd::text::utf8, ztd::text::utf16, 5);
+		REQUIRE(fits.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(fits.count == 5);
+		REQUIRE(fits.input.size() == 1);
+
+		auto all = ztd::text::truncate_to_fit(u8_input, ztd::text::utf8, ztd::text::utf16, 255);
+		REQUIRE(all.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(all.count == 6);
+		REQUIRE(all.input.empty());
+	}
+	SECTION("utf16 to utf8") {
+		auto cut = ztd::text::truncate_to_fit(u16_input, ztd::text::utf16, ztd::text::utf8, 5);
+		REQUIRE(cut.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(cut.count == 3);
+		REQUIRE(cut.input.size() == 4);
+	}
+	SECTION("ascii") {
+		auto cut = ztd::text::truncate_to_fit(
+		     ztd::tests::basic_source_character_set, ztd::text::ascii, ztd::text::utf16, 10);
+		REQUIRE(cut.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(cut.count == 10);
+		REQUIRE(cut.input.size() == ztd::tests::basic_source_character_set.size() - 10);
+	}
+	SECTION("every limit") {
+		const std::basic_string_view<ztd::uchar8_t> input(ztd::tests::u8_unicode_sequence_truth_native_endian.data(),
+		     ztd::tests::u8_unicode_sequence_truth_native_endian.size());
+		const std::size_t total = ztd::text::count_as_transcoded(input, ztd::text::utf8, ztd::text::utf16).count;
+		for (std::size_t max_units = 0; max_units <= total; ++max_units) {
+			auto result = ztd::text::truncate_to_fit(input, ztd::text::utf8, ztd::text::utf16, max_units);
+			REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+			REQUIRE(result.count <= max_units);
+			REQUIRE(result.count + 1 >= max_units);
+			const std::basic_string_view<ztd::uchar8_t> prefix(input.data(), input.size() - result.input.size());
+			REQUIRE(ztd::text::count_as_transcoded(prefix, ztd::text::utf8, ztd::text::utf16).count == result.count);
+		}
+	}
+	SECTION("invalid") {
+		std::basic_string<ztd::uchar8_t> input(100, static_cast<ztd::uchar8_t>('a'));
+		input[50] = static_cast<ztd::uchar8_t>(0xFF);
+		ztd::text::pass_handler_t handler {};
+		auto result = ztd::text::truncate_to_fit(input, ztd::text::utf8, ztd::text::utf16, 80, handler);
+		REQUIRE(result.error_code != ztd::text::encoding_error::ok);
+		REQUIRE(result.count == 50);
+		REQUIRE(result.input.size() == 50);
+	}
+}
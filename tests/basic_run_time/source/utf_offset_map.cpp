@@ -0,0 +1,141 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+#include <ztd/text/utf_offset_map.hpp>
+#include <ztd/text/count_as_decoded.hpp>
+#include <ztd/text/count_as_transcoded.hpp>
+#include <ztd/text/decode_one.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	using u8_string = std::basic_string<ztd::uchar8_t>;
+	using u8_view   = std::basic_string_view<ztd::uchar8_t>;
+
+	std::vector<ztd::text::utf_position> truth_positions(u8_view input) {
+		std::vector<ztd::text::utf_position> positions { ztd::text::utf_position { 0, 0, 0 } };
+		u8_view rest = input;
+		while (!rest.empty()) {
+			rest = ztd::text::decode_one(rest, ztd::text::utf8, ztd::text::replacement_handler).input;
+			const u8_view before(input.data(), input.size() - rest.size());
+			positions.push_back(ztd::text::utf_position { before.size(),
+			     ztd::text::count_as_transcoded(before, ztd::text::utf8, ztd::text::utf16).count,
+			     ztd::text::count_as_decoded(before, ztd::text::utf8).count });
+		}
+		return positions;
+	}
+
+	u8_string sample_text() {
+		u8_string text;
+		for (std::size_t i = 0; i < 6; ++i) {
+			text.append(ztd::tests::u8_basic_source_character_set.data(),
+			     ztd::tests::u8_basic_source_character_set.size());
+			text.append(ztd::tests::u8_unicode_sequence_truth_native_endian.data(),
+			     ztd::tests::u8_unicode_sequence_truth_native_endian.size());
+		}
+		return text;
+	}
+
+	void check_against_truth(const ztd::text::basic_utf_offset_map<ztd::text::utf8_t>& map, u8_view input) {
+		const std::vector<ztd::text::utf_position> truth = truth_positions(input);
+		for (const ztd::text::utf_position& position : truth) {
+			REQUIRE(map.from_code_units(input, position.code_units) == position);
+			REQUIRE(map.from_utf16_code_units(input, position.utf16_code_units) == position);
+			REQUIRE(map.from_code_points(input, position.code_points) == position);
+		}
+		for (std::size_t index = 1; index < truth.size(); ++index) {
+			// offsets inside of a code point give the start of that code point
+			for (std::size_t units = truth[index - 1].code_units + 1; units < truth[index].code_units; ++units) {
+				REQUIRE(map.from_code_units(input, units) == truth[index - 1]);
+			}
+			if (truth[index].utf16_code_units - truth[index - 1].utf16_code_units == 2) {
+				const std::size_t between_surrogates = truth[index - 1].utf16_code_units + 1;
+				REQUIRE(map.from_utf16_code_units(input, between_surrogates) == truth[index - 1]);
+			}
+		}
+		REQUIRE(map.from_code_points(input, truth.back().code_points + 10) == truth.back());
+	}
+} // namespace
+
+TEST_CASE("text/utf_offset_map/basic", "offsets convert the same way as counting from the start") {
+	const u8_string text = sample_text();
+	const u8_view input(text.data(), text.size());
+	SECTION("block size 1") {
+		ztd::text::basic_utf_offset_map<ztd::text::utf8_t> map(input, 1);
+		check_against_truth(map, input);
+	}
+	SECTION("block size 16") {
+		ztd::text::basic_utf_offset_map<ztd::text::utf8_t> map(input, 16);
+		check_against_truth(map, input);
+	}
+	SECTION("default block size") {
+		ztd::text::basic_utf_offset_map<ztd::text::utf8_t> map(input);
+		check_against_truth(map, input);
+	}
+}
+
+TEST_CASE("text/utf_offset_map/update", "updating after an edit matches rebuilding from scratch") {
+	u8_string text = sample_text();
+	ztd::text::basic_utf_offset_map<ztd::text::utf8_t> map(u8_view(text.data(), text.size()), 8);
+	const u8_string insertions[] = { u8_string(reinterpret_cast<const ztd::uchar8_t*>("\xF0\x9F\x98\x80 new")),
+		u8_string(reinterpret_cast<const ztd::uchar8_t*>("\xC3\xA9")), u8_string() };
+	std::size_t offset = 3;
+	for (std::size_t round = 0; round < 12; ++round) {
+		const u8_string& inserted = insertions[round % 3];
+		// edits always start on a code point boundary, like an editor's would
+		const std::vector<ztd::text::utf_position> before = truth_positions(u8_view(text.data(), text.size()));
+		const std::size_t first   = before[offset % before.size()].code_units;
+		const std::size_t last    = before[(offset + round % 4) % before.size()].code_units;
+		const std::size_t removed = last > first ? last - first : 0;
+		text.replace(first, removed, inserted);
+		const u8_view input(text.data(), text.size());
+		map.update(input, first, removed, inserted.size());
+		check_against_truth(map, input);
+		offset = offset * 7 + 5;
+	}
+}
+
+TEST_CASE("text/utf_offset_map/ill-formed", "every ill-formed code unit counts as one replacement character") {
+	// 'a', a stray continuation byte, a cut-off three-byte sequence, then 'b'
+	const u8_string text(reinterpret_cast<const ztd::uchar8_t*>("a\x80\xE2\x82" "b"));
+	const u8_view input(text.data(), text.size());
+	ztd::text::basic_utf_offset_map<ztd::text::utf8_t> map(input, 2);
+	REQUIRE(map.from_code_units(input, 1) == ztd::text::utf_position { 1, 1, 1 });
+	REQUIRE(map.from_code_units(input, 3) == ztd::text::utf_position { 3, 3, 3 });
+	REQUIRE(map.from_code_points(input, 4) == ztd::text::utf_position { 4, 4, 4 });
+	REQUIRE(map.from_utf16_code_units(input, 5) == ztd::text::utf_position { 5, 5, 5 });
+}
@@ -0,0 +1,122 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/validate_and_count_as_transcoded.hpp>
+#include <ztd/text/count_as_transcoded.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <string>
+
+inline namespace ztd_text_tests_basic_run_time_validate_and_count_as_transcoded {
+	template <typename Input, typename FromEncoding, typename ToEncoding>
+	void validate_and_count_check(Input& input, FromEncoding& from_encoding, ToEncoding& to_encoding) {
+		auto expected = ztd::text::count_as_transcoded(input, from_encoding, to_encoding);
+		REQUIRE(expected.error_code == ztd::text::encoding_error::ok);
+		auto result = ztd::text::validate_and_count_as_transcoded(input, from_encoding, to_encoding);
+		REQUIRE(result.valid);
+		REQUIRE(result.count == expected.count);
+		REQUIRE(result.input.empty());
+	}
+} // namespace ztd_text_tests_basic_run_time_validate_and_count_as_transcoded
+
+TEST_CASE("text/validate_and_count_as_transcoded/basic",
+     "validate_and_count_as_transcoded gives the same answers as validating and then counting") {
+	ztd::text::utf8_t utf8 {};
+	ztd::text::utf16_t utf16 {};
+	ztd::text::utf32_t utf32 {};
+	SECTION("utf8") {
+		validate_and_count_check(ztd::tests::u8_unicode_sequence_truth_native_endian, utf8, utf8);
+		validate_and_count_check(ztd::tests::u8_unicode_sequence_truth_native_endian, utf8, utf16);
+		validate_and_count_check(ztd::tests::u8_unicode_sequence_truth_native_endian, utf8, utf32);
+	}
+	SECTION("utf16") {
+		validate_and_count_check(ztd::tests::u16_unicode_sequence_truth_native_endian, utf16, utf8);
+		validate_and_count_check(ztd::tests::u16_unicode_sequence_truth_native_endian, utf16, utf16);
+		validate_and_count_check(ztd::tests::u16_unicode_sequence_truth_native_endian, utf16, utf32);
+	}
+	SECTION("utf32") {
+		validate_and_count_check(ztd::tests::u32_unicode_sequence_truth_native_endian, utf32, utf8);
+		validate_and_count_check(ztd::tests::u32_unicode_sequence_truth_native_endian, utf32, utf16);
+		validate_and_count_check(ztd::tests::u32_unicode_sequence_truth_native_endian, utf32, utf32);
+	}
+	SECTION("ascii") {
+		ztd::text::ascii_t ascii {};
+		validate_and_count_check(ztd::tests::basic_source_character_set, ascii, utf16);
+	}
+	SECTION("invalid") {
+		std::basic_string<ztd::uchar8_t> input(100, static_cast<ztd::uchar8_t>('a'));
+		input[50] = static_cast<ztd::uchar8_t>(0xFF);
+		auto result = ztd::text::validate_and_count_as_transcoded(input, utf8, utf16);
+		REQUIRE_FALSE(result.valid);
+		REQUIRE(result.count == 50);
+		REQUIRE(result.input.size() == 50);
+
+		std::u32string wide_input(100, U'a');
+		wide_input[20]   = static_cast<char32_t>(0xD800);
+		auto wide_result = ztd::text::validate_and_count_as_transcoded(wide_input, utf32, utf8);
+		REQUIRE_FALSE(wide_result.valid);
+		REQUIRE(wide_result.count == 20);
+		REQUIRE(wide_result.input.size() == 80);
+	}
+	SECTION("pivot reports the failing side") {
+		ztd::text::ascii_t ascii {};
+		char32_t intermediate[ztd::text::max_code_points_v<ztd::text::utf8_t>] {};
+
+		std::basic_string<ztd::uchar8_t> bad_input(20, static_cast<ztd::uchar8_t>('a'));
+		bad_input[10]       = static_cast<ztd::uchar8_t>(0xFF);
+		auto bad_from_state = ztd::text::make_decode_state(utf8);
+		auto bad_to_state   = ztd::text::make_encode_state(utf16);
+		ztd::text::pivot<ztd::span<char32_t>> bad_pivot { intermediate, ztd::text::encoding_error::ok };
+		auto bad_result = ztd::text::validate_and_count_as_transcoded(
+		     bad_input, utf8, utf16, bad_from_state, bad_to_state, bad_pivot);
+		REQUIRE_FALSE(bad_result.valid);
+		REQUIRE(bad_result.count == 10);
+		REQUIRE(bad_result.input.size() == 10);
+		REQUIRE(bad_pivot.error_code == ztd::text::encoding_error::invalid_sequence);
+
+		// U+00E9 decodes fine, but cannot be encoded as ASCII
+		std::basic_string<ztd::uchar8_t> unencodable_input(20, static_cast<ztd::uchar8_t>('a'));
+		unencodable_input[12]       = static_cast<ztd::uchar8_t>(0xC3);
+		unencodable_input[13]       = static_cast<ztd::uchar8_t>(0xA9);
+		auto unencodable_from_state = ztd::text::make_decode_state(utf8);
+		auto unencodable_to_state   = ztd::text::make_encode_state(ascii);
+		ztd::text::pivot<ztd::span<char32_t>> unencodable_pivot { intermediate, ztd::text::encoding_error::ok };
+		auto unencodable_result = ztd::text::validate_and_count_as_transcoded(unencodable_input, utf8, ascii,
+		     unencodable_from_state, unencodable_to_state, unencodable_pivot);
+		REQUIRE_FALSE(unencodable_result.valid);
+		REQUIRE(unencodable_result.count == 12);
+		REQUIRE(unencodable_result.input.size() == 8);
+		REQUIRE(unencodable_pivot.error_code == ztd::text::encoding_error::ok);
+	}
+}
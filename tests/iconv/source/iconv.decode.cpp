@@ -60,4 +60,55 @@ TEST_CASE("text/decode/iconv", "iconv encodings are semi-okay") {
 			REQUIRE(result1 == ztd::tests::u32_unicode_sequence_truth_native_endian);
 		}
 	}
+	SECTION("bulk with errors") {
+		ztd::text::basic_iconv<char, ztd::text::unicode_code_point> encoding("UTF-8");
+		std::string input(300, 'a');
+		input[150] = '\xFF';
+		std::u32string expected(300, U'a');
+		expected[150] = U'\uFFFD';
+		std::u32string output(300, U'\0');
+		auto result = ztd::text::decode_into(ztd::span<const char>(input), encoding,
+		     ztd::span<ztd::text::unicode_code_point>(output), ztd::text::replacement_handler);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.handled_errors == 1);
+		REQUIRE(result.input.empty());
+		REQUIRE(result.output.empty());
+		REQUIRE(output == expected);
+	}
+	SECTION("descriptor reuse") {
+		using encoding_t = ztd::text::basic_iconv<char, ztd::text::unicode_code_point>;
+		encoding_t encoding("UTF-8");
+		ztd::text::purge_iconv_descriptor_cache();
+		ztd::plat::icnv::descriptor first_descriptor = ztd::plat::icnv::failure_descriptor;
+		{
+			ztd::text::decode_state_t<encoding_t> state(encoding);
+			first_descriptor = state._M_conv_descriptor;
+			REQUIRE(first_descriptor != ztd::plat::icnv::failure_descriptor);
+		}
+		{
+			// the descriptor given back by the last state is handed out again...
+			ztd::text::decode_state_t<encoding_t> state(encoding);
+			REQUIRE(state._M_conv_descriptor == first_descriptor);
+			// ... but never to two live states at once
+			ztd::text::decode_state_t<encoding_t> other_state(encoding);
+			REQUIRE(other_state._M_conv_descriptor != ztd::plat::icnv::failure_descriptor);
+			REQUIRE(other_state._M_conv_descriptor != first_descriptor);
+		}
+		for (int i = 0; i < 3; ++i) {
+			std::u32string result = ztd::text::decode(
+			     ztd::tests::basic_source_character_set, encoding, ztd::text::replacement_handler);
+			REQUIRE(result == ztd::tests::u32_basic_source_character_set);
+		}
+		ztd::text::purge_iconv_descriptor_cache();
+		std::u32string result
+		     = ztd::text::decode(ztd::tests::basic_source_character_set, encoding, ztd::text::replacement_handler);
+		REQUIRE(result == ztd::tests::u32_basic_source_character_set);
+	}
+	SECTION("descriptor outliving the cache") {
+		// destroyed after the main thread's cache is: it has to close its descriptor on its own
+		using encoding_t = ztd::text::basic_iconv<char, ztd::text::unicode_code_point>;
+		static encoding_t static_encoding("UTF-8");
+		static ztd::text::decode_state_t<encoding_t> static_state(static_encoding);
+		REQUIRE(static_state._M_conv_descriptor != ztd::plat::icnv::failure_descriptor);
+	}
 }
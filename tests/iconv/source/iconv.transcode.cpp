@@ -35,6 +35,9 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <iterator>
+#include <string>
+
 inline namespace ztd_text_tests_iconv_transcode {
 	template <typename Encoding, typename Input>
 	void check_roundtrip(Encoding& encoding, Input& input) {
@@ -62,4 +65,49 @@ TEST_CASE("text/transcode/iconv", "iconv transcode can roundtrip") {
 			check_roundtrip(encoding, ztd::tests::w_unicode_sequence_truth_native_endian);
 		}
 	}
+	SECTION("iconv to iconv") {
+		ztd::text::basic_iconv<char> latin1("ISO-8859-1");
+		ztd::text::basic_iconv<char> utf8("UTF-8");
+		std::string latin1_input = "caf\xE9";
+		std::string result0      = ztd::text::transcode(
+		          latin1_input, latin1, utf8, ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result0 == "caf\xC3\xA9");
+
+		std::string utf8_input = "caf\xC3\xA9";
+		char output[8] {};
+		auto result1 = ztd::text::transcode_into(ztd::span<const char>(utf8_input), utf8, ztd::span<char>(output),
+		     latin1, ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result1.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result1.handled_errors == 0);
+		REQUIRE(result1.input.empty());
+		const std::size_t written = std::size(output) - result1.output.size();
+		REQUIRE(std::string(output, written) == "caf\xE9");
+	}
+	SECTION("iconv to iconv with an error") {
+		ztd::text::basic_iconv<char> utf8("UTF-8");
+		ztd::text::basic_iconv<char16_t> utf16(ztd::text::iconv_utf16_name.base());
+		std::string utf8_input = "a\xFF"
+		                         "b\xE2\x82\xAC";
+		char16_t output[8] {};
+		auto result = ztd::text::transcode_into(ztd::span<const char>(utf8_input), utf8,
+		     ztd::span<char16_t>(output), utf16, ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.handled_errors == 1);
+		REQUIRE(result.input.empty());
+		const std::size_t written = std::size(output) - result.output.size();
+		REQUIRE(std::u16string(output, written) == u"a\uFFFDb\u20AC");
+	}
+	SECTION("stateful encodings do not share a direct descriptor") {
+		REQUIRE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("ISO-2022-JP"));
+		REQUIRE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("iso2022kr"));
+		REQUIRE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("UTF-7"));
+		REQUIRE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("HZ-GB-2312"));
+		REQUIRE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("UTF-16"));
+		REQUIRE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name(""));
+		REQUIRE_FALSE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("UTF-8"));
+		REQUIRE_FALSE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("UTF-16LE"));
+		REQUIRE_FALSE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("EUC-JP"));
+		REQUIRE_FALSE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("CP936"));
+		REQUIRE_FALSE(ztd::text::__txt_detail::__is_iconv_stateful_encoding_name("ISO-8859-1"));
+	}
 }
@@ -0,0 +1,75 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2022 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/locale_encoding.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/idk/encoding_detection.hpp>
+
+#include <clocale>
+#include <string>
+
+TEST_CASE("text/locale_encoding_cache/setlocale",
+     "the cached locale encoding only follows setlocale after refresh_locale_encoding") {
+	const char* current_locale        = std::setlocale(LC_ALL, nullptr);
+	const std::string original_locale = current_locale == nullptr ? "C" : current_locale;
+	ztd::text::refresh_locale_encoding();
+	const bool original_is_unicode = ztd::text::contains_unicode_encoding(ztd::text::execution);
+
+	// find an installed locale whose encoding the C library reports differently from the current one
+	const char* const candidates[] = { "C", "POSIX", "C.UTF-8", "C.utf8", "en_US.UTF-8", "en_US.utf8" };
+	bool switched                  = false;
+	for (const char* candidate : candidates) {
+		if (std::setlocale(LC_ALL, candidate) == nullptr) {
+			continue;
+		}
+		if (ztd::is_execution_encoding_unicode() != original_is_unicode) {
+			switched = true;
+			break;
+		}
+	}
+	if (!switched) {
+		std::setlocale(LC_ALL, original_locale.c_str());
+		ztd::text::refresh_locale_encoding();
+		SKIP("no installed locale has an encoding that differs from the current one");
+	}
+
+	// the cached answer is kept until it is refreshed...
+	REQUIRE(ztd::text::contains_unicode_encoding(ztd::text::execution) == original_is_unicode);
+	// ... and then follows the new locale
+	ztd::text::refresh_locale_encoding();
+	REQUIRE(ztd::text::contains_unicode_encoding(ztd::text::execution) != original_is_unicode);
+
+	std::setlocale(LC_ALL, original_locale.c_str());
+	ztd::text::refresh_locale_encoding();
+	REQUIRE(ztd::text::contains_unicode_encoding(ztd::text::execution) == original_is_unicode);
+}